@@ -385,12 +385,19 @@ proc generate {os_handle} {
 	file copy -force [file join src Source list.c] ./src
 	file copy -force [file join src Source timers.c] ./src
 	file copy -force [file join src Source event_groups.c] ./src
-	file copy -force [file join src Source portable MemMang heap_4.c] ./src
+	set heap_type [common::get_property CONFIG.heap_type $os_handle]
+	if { $heap_type != "heap_6" } {
+		set heap_type "heap_4"
+	}
+	file copy -force [file join src Source portable MemMang $heap_type.c] ./src
         set stream_buffer_enabled [common::get_property CONFIG.stream_buffer $os_handle]
         set message_buffer_enabled [common::get_property CONFIG.message_buffer $os_handle]
         if {$stream_buffer_enabled == "true" || $message_buffer_enabled == "true"} {
 		file copy -force [file join src Source stream_buffer.c] ./src
 	}
+	if { $proctype != "microblaze" } {
+		file copy -force [file join src Source object_pool.c] ./src
+	}
 
 	if { $proctype == "psu_cortexr5" || $proctype == "psv_cortexr5"} {
 		file copy -force [file join src Source portable GCC ARM_CR5 port.c] ./src
@@ -398,6 +405,8 @@ proc generate {os_handle} {
 		file copy -force [file join src Source portable GCC ARM_CR5 port_asm_vectors.S] ./src
 		file copy -force [file join src Source portable GCC ARM_CR5 portmacro.h] ./src
 		file copy -force [file join src Source portable GCC ARM_CR5 portZynqUltrascale.c] ./src
+		file copy -force [file join src Source portable GCC ARM_TTC_Tickless portTtcTickless.c] ./src
+		file copy -force [file join src Source portable GCC ARM_TTC_Tickless portTtcTickless.h] ./src
 	}
 	if { $proctype == "psu_cortexa53" || $proctype == "psv_cortexa72"} {
 		file copy -force [file join src Source portable GCC ARM_CA53 port.c] ./src
@@ -405,6 +414,8 @@ proc generate {os_handle} {
 		file copy -force [file join src Source portable GCC ARM_CA53 port_asm_vectors.S] ./src
 		file copy -force [file join src Source portable GCC ARM_CA53 portmacro.h] ./src
 		file copy -force [file join src Source portable GCC ARM_CA53 portZynqUltrascale.c] ./src
+		file copy -force [file join src Source portable GCC ARM_TTC_Tickless portTtcTickless.c] ./src
+		file copy -force [file join src Source portable GCC ARM_TTC_Tickless portTtcTickless.h] ./src
 	}
 
 	if { $proctype == "ps7_cortexa9" } {
@@ -724,6 +735,13 @@ proc generate {os_handle} {
 	set total_heap_size [common::get_property CONFIG.total_heap_size $os_handle]
 	xput_define $config_file "configTOTAL_HEAP_SIZE"  "( ( size_t ) ( $total_heap_size ) )"
 
+	set heap_type [common::get_property CONFIG.heap_type $os_handle]
+	if { $heap_type == "heap_6" } {
+		xput_define $config_file "configUSE_HEAP_CLASS_STATS"  "1"
+	} else {
+		xput_define $config_file "configUSE_HEAP_CLASS_STATS"  "0"
+	}
+
 	set max_task_name_len [common::get_property CONFIG.max_task_name_len $os_handle]
 	xput_define $config_file "configMAX_TASK_NAME_LEN"  $max_task_name_len
 
@@ -854,7 +872,18 @@ proc generate {os_handle} {
 		xput_define $config_file "configUSE_PORT_OPTIMISED_TASK_SELECTION"  "1"
 	}
 
-	puts $config_file "#define configUSE_TICKLESS_IDLE	0"
+	set val [common::get_property CONFIG.use_tickless_idle $os_handle]
+	if {$val == "true"} {
+		if { $proctype != "psu_cortexr5" && $proctype != "psu_cortexa53" } {
+			error "ERROR: use_tickless_idle is only supported on psu_cortexr5 and psu_cortexa53"
+		}
+		if { $is_xiltimer_enabled != 0 || [common::get_property CONFIG.generate_runtime_stats $os_handle] == 1 } {
+			error "ERROR: use_tickless_idle needs the TTC tick timer and generate_runtime_stats set to 0"
+		}
+		puts $config_file "#define configUSE_TICKLESS_IDLE	1"
+	} else {
+		puts $config_file "#define configUSE_TICKLESS_IDLE	0"
+	}
 	puts $config_file "#define configTASK_RETURN_ADDRESS    prvTaskExitError"
 	puts $config_file "#define INCLUDE_vTaskPrioritySet             1"
 	puts $config_file "#define INCLUDE_uxTaskPriorityGet            1"
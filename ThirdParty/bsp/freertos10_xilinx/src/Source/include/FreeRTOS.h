@@ -870,6 +870,10 @@
     #define configAPPLICATION_ALLOCATED_HEAP    0
 #endif
 
+#ifndef configUSE_HEAP_CLASS_STATS
+    #define configUSE_HEAP_CLASS_STATS    0
+#endif
+
 #ifndef configUSE_TASK_NOTIFICATIONS
     #define configUSE_TASK_NOTIFICATIONS    1
 #endif
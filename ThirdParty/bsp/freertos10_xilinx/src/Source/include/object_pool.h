@@ -0,0 +1,205 @@
+/*
+ * FreeRTOS Kernel V10.4.6
+ * Copyright (C) 2026 Xilinx, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Object pools hand out fixed size objects from a caller supplied storage
+ * area without taking the kernel critical section.
+ *
+ * The free objects of a pool are kept in a singly linked list, updated with
+ * interrupts masked up to configMAX_API_CALL_INTERRUPT_PRIORITY, so
+ * allocating or freeing an object is a list push or pop.
+ *
+ * The kernel runs on a single core, so masking interrupts is enough to
+ * protect a pool.  Pools must not be shared with code running on another
+ * core.
+ *
+ * uxPortSetInterruptMask() only masks interrupts up to
+ * configMAX_API_CALL_INTERRUPT_PRIORITY, so the API functions can be called
+ * from tasks and from interrupts whose priority is at or below that level
+ * only.  Interrupts of a higher priority are not masked and must never use a
+ * pool, they could interrupt an update of the free list.
+ */
+
+#ifndef OBJECT_POOL_H
+#define OBJECT_POOL_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h must appear in source files before include object_pool.h"
+#endif
+
+#include "queue.h"
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/*
+ * The size actually used for each object of a pool created for xObjectSize
+ * bytes objects.  Objects are at least one pointer large and are a multiple
+ * of portBYTE_ALIGNMENT bytes.
+ */
+#define poolOBJECT_SIZE( xObjectSize )                                                                       \
+    ( ( ( ( ( xObjectSize ) > sizeof( void * ) ) ? ( xObjectSize ) : sizeof( void * ) ) + portBYTE_ALIGNMENT_MASK ) \
+      & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) )
+
+/*
+ * The number of bytes of storage needed by a pool of uxObjectCount objects of
+ * xObjectSize bytes.
+ */
+#define poolSTORAGE_SIZE( xObjectSize, uxObjectCount )    ( poolOBJECT_SIZE( xObjectSize ) * ( size_t ) ( uxObjectCount ) )
+
+/*
+ * The size of the pool objects needed by xObjectPoolQueueCreate() for queues of
+ * uxQueueLength items of uxItemSize bytes.
+ */
+#define poolQUEUE_OBJECT_SIZE( uxQueueLength, uxItemSize )    ( sizeof( StaticQueue_t ) + ( ( size_t ) ( uxQueueLength ) * ( size_t ) ( uxItemSize ) ) )
+
+/*
+ * The pool itself.  The members are private, ObjectPool_t is only exposed so
+ * pools can be allocated statically.
+ */
+typedef struct xOBJECT_POOL
+{
+    void * pvFreeList; /*<< The first free object, NULL when the pool is empty. */
+    uint8_t * pucStorage;
+    size_t xObjectSize;
+    UBaseType_t uxObjectCount;
+} ObjectPool_t;
+
+/**
+ * object_pool.h
+ *
+ * @code{c}
+ * void vObjectPoolInitialise( ObjectPool_t * pxPool, void * pvStorage, size_t xObjectSize, UBaseType_t uxObjectCount );
+ * @endcode
+ *
+ * Sets up a pool of uxObjectCount objects of xObjectSize bytes, all of which
+ * are free.  Must be called before the pool is used by any
+ * other task or interrupt.
+ *
+ * @param pxPool The pool to set up.
+ *
+ * @param pvStorage Storage for the objects, at least
+ * poolSTORAGE_SIZE( xObjectSize, uxObjectCount ) bytes aligned to
+ * portBYTE_ALIGNMENT.
+ *
+ * @param xObjectSize The size of each object in bytes.
+ *
+ * @param uxObjectCount The number of objects.
+ */
+void vObjectPoolInitialise( ObjectPool_t * pxPool,
+                            void * pvStorage,
+                            size_t xObjectSize,
+                            UBaseType_t uxObjectCount ) PRIVILEGED_FUNCTION;
+
+/**
+ * object_pool.h
+ *
+ * @code{c}
+ * void * pvObjectPoolAlloc( ObjectPool_t * pxPool );
+ * @endcode
+ *
+ * Takes an object from the free list of the pool.
+ *
+ * @param pxPool The pool to allocate from.
+ *
+ * @return The object, or NULL if the pool is empty.
+ */
+void * pvObjectPoolAlloc( ObjectPool_t * pxPool ) PRIVILEGED_FUNCTION;
+
+/**
+ * object_pool.h
+ *
+ * @code{c}
+ * void vObjectPoolFree( ObjectPool_t * pxPool, void * pvObject );
+ * @endcode
+ *
+ * Returns an object to the free list of the pool.
+ *
+ * @param pxPool The pool the object was allocated from.
+ *
+ * @param pvObject The object to free.
+ */
+void vObjectPoolFree( ObjectPool_t * pxPool,
+                      void * pvObject ) PRIVILEGED_FUNCTION;
+
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+/**
+ * object_pool.h
+ *
+ * @code{c}
+ * QueueHandle_t xObjectPoolQueueCreate( ObjectPool_t * pxPool, UBaseType_t uxQueueLength, UBaseType_t uxItemSize );
+ * @endcode
+ *
+ * Creates a queue with xQueueCreateStatic() whose queue structure and storage
+ * area are a single object of pxPool, so queues can be created and deleted
+ * at run time without using the FreeRTOS heap.  The pool objects must be at
+ * least poolQUEUE_OBJECT_SIZE( uxQueueLength, uxItemSize ) bytes.
+ *
+ * @param pxPool The pool to take the queue memory from.
+ *
+ * @param uxQueueLength The maximum number of items the queue can hold.
+ *
+ * @param uxItemSize The size in bytes of each item.
+ *
+ * @return The queue handle, or NULL if the pool is empty or its objects are
+ * too small.
+ */
+    QueueHandle_t xObjectPoolQueueCreate( ObjectPool_t * pxPool,
+                                          UBaseType_t uxQueueLength,
+                                          UBaseType_t uxItemSize ) PRIVILEGED_FUNCTION;
+
+/**
+ * object_pool.h
+ *
+ * @code{c}
+ * void vObjectPoolQueueDelete( ObjectPool_t * pxPool, QueueHandle_t xQueue );
+ * @endcode
+ *
+ * Deletes a queue created by xObjectPoolQueueCreate() and returns its memory
+ * to the pool.
+ *
+ * @param pxPool The pool the queue was created from.
+ *
+ * @param xQueue The queue to delete.
+ */
+    void vObjectPoolQueueDelete( ObjectPool_t * pxPool,
+                                 QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* !defined( OBJECT_POOL_H ) */
@@ -150,6 +150,16 @@ typedef struct xHeapStats
     size_t xNumberOfSuccessfulFrees;        /* The number of calls to vPortFree() that has successfully freed a block of memory. */
 } HeapStats_t;
 
+/* Used to pass information about one first level size class of heap_6.c out
+ * of uxPortGetHeapClassStats(). */
+typedef struct xHeapClassStats
+{
+    size_t xMinimumBlockSizeInBytes;       /* The size, header included, of the smallest block that belongs to the class.  Blocks of the next class are at least twice as large. */
+    size_t xNumberOfFreeBlocks;            /* The number of free blocks of the class at the time uxPortGetHeapClassStats() is called. */
+    size_t xNumberOfSuccessfulAllocations; /* The number of calls to pvPortMalloc() that have been served from the class. */
+    size_t xNumberOfFailedAllocations;     /* The number of calls to pvPortMalloc() that have failed as no block of the class, or of a larger class, was free. */
+} HeapClassStats_t;
+
 /*
  * Used to define multiple heap regions for use by heap_5.c.  This function
  * must be called before any calls to pvPortMalloc() - not creating a task,
@@ -169,6 +179,17 @@ void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions ) PRIVILEG
  */
 void vPortGetHeapStats( HeapStats_t * pxHeapStats );
 
+/*
+ * Fills up to uxMaxClasses HeapClassStats_t structures, one for each first
+ * level size class, and returns the number of structures filled.  Only
+ * provided by heap_6.c, which sets configUSE_HEAP_CLASS_STATS to 1 in the
+ * generated FreeRTOSConfig.h.
+ */
+#if ( configUSE_HEAP_CLASS_STATS == 1 )
+    UBaseType_t uxPortGetHeapClassStats( HeapClassStats_t * pxClassStats,
+                                         UBaseType_t uxMaxClasses );
+#endif
+
 /*
  * Map to the memory management routines required for the port.
  */
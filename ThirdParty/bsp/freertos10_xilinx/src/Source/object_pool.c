@@ -0,0 +1,187 @@
+/*
+ * FreeRTOS Kernel V10.4.6
+ * Copyright (C) 2026 Xilinx, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <stdint.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "object_pool.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* The free list is protected by masking interrupts up to
+ * configMAX_API_CALL_INTERRUPT_PRIORITY, which works from both tasks and
+ * interrupts at or below that priority. */
+#if defined( __aarch64__ )
+    #define poolMASK_INTERRUPTS()               uxPortSetInterruptMask()
+    #define poolUNMASK_INTERRUPTS( uxMask )     vPortClearInterruptMask( uxMask )
+#elif defined( __arm__ )
+    #define poolMASK_INTERRUPTS()               ulPortSetInterruptMask()
+    #define poolUNMASK_INTERRUPTS( uxMask )     vPortClearInterruptMask( uxMask )
+#else
+    #error object_pool.c is only supported by the Cortex-A53, Cortex-A9 and Cortex-R5 ports
+#endif
+
+/* A free object, linked to the next free object. */
+typedef struct xPOOL_FREE_OBJECT
+{
+    struct xPOOL_FREE_OBJECT * pxNextFree;
+} PoolFreeObject_t;
+
+/*-----------------------------------------------------------*/
+
+void vObjectPoolInitialise( ObjectPool_t * pxPool,
+                            void * pvStorage,
+                            size_t xObjectSize,
+                            UBaseType_t uxObjectCount )
+{
+    PoolFreeObject_t * pxObject;
+    UBaseType_t uxObject;
+
+    configASSERT( pxPool );
+    configASSERT( pvStorage );
+    configASSERT( ( ( ( size_t ) pvStorage ) & ( size_t ) portBYTE_ALIGNMENT_MASK ) == 0 );
+
+    pxPool->pucStorage = ( uint8_t * ) pvStorage;
+    pxPool->xObjectSize = poolOBJECT_SIZE( xObjectSize );
+    pxPool->uxObjectCount = uxObjectCount;
+    pxPool->pvFreeList = NULL;
+
+    /* Link the objects in address order, so the first allocations are
+     * contiguous. */
+    for( uxObject = uxObjectCount; uxObject > 0; uxObject-- )
+    {
+        pxObject = ( PoolFreeObject_t * ) ( pxPool->pucStorage + ( ( size_t ) ( uxObject - 1 ) * pxPool->xObjectSize ) );
+        pxObject->pxNextFree = ( PoolFreeObject_t * ) pxPool->pvFreeList;
+        pxPool->pvFreeList = pxObject;
+    }
+}
+/*-----------------------------------------------------------*/
+
+void * pvObjectPoolAlloc( ObjectPool_t * pxPool )
+{
+    PoolFreeObject_t * pxObject;
+    UBaseType_t uxSavedInterruptStatus;
+
+    configASSERT( pxPool );
+
+    uxSavedInterruptStatus = ( UBaseType_t ) poolMASK_INTERRUPTS();
+    {
+        pxObject = ( PoolFreeObject_t * ) pxPool->pvFreeList;
+
+        if( pxObject != NULL )
+        {
+            pxPool->pvFreeList = pxObject->pxNextFree;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    poolUNMASK_INTERRUPTS( uxSavedInterruptStatus );
+
+    return pxObject;
+}
+/*-----------------------------------------------------------*/
+
+void vObjectPoolFree( ObjectPool_t * pxPool,
+                      void * pvObject )
+{
+    PoolFreeObject_t * pxObject = ( PoolFreeObject_t * ) pvObject;
+    UBaseType_t uxSavedInterruptStatus;
+
+    configASSERT( pxPool );
+    configASSERT( ( ( uint8_t * ) pvObject >= pxPool->pucStorage ) &&
+                  ( ( uint8_t * ) pvObject < pxPool->pucStorage + ( ( size_t ) pxPool->uxObjectCount * pxPool->xObjectSize ) ) );
+
+    uxSavedInterruptStatus = ( UBaseType_t ) poolMASK_INTERRUPTS();
+    {
+        pxObject->pxNextFree = ( PoolFreeObject_t * ) pxPool->pvFreeList;
+        pxPool->pvFreeList = pxObject;
+    }
+    poolUNMASK_INTERRUPTS( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+    QueueHandle_t xObjectPoolQueueCreate( ObjectPool_t * pxPool,
+                                          UBaseType_t uxQueueLength,
+                                          UBaseType_t uxItemSize )
+    {
+        QueueHandle_t xReturn = NULL;
+        uint8_t * pucObject;
+
+        configASSERT( pxPool );
+
+        if( ( uxQueueLength > 0 ) &&
+            ( poolQUEUE_OBJECT_SIZE( uxQueueLength, uxItemSize ) <= pxPool->xObjectSize ) )
+        {
+            pucObject = ( uint8_t * ) pvObjectPoolAlloc( pxPool );
+
+            if( pucObject != NULL )
+            {
+                /* The storage area follows the queue structure, the queue
+                 * handle is the address of the queue structure. */
+                xReturn = xQueueCreateStatic( uxQueueLength, uxItemSize, pucObject + sizeof( StaticQueue_t ), ( StaticQueue_t * ) pucObject );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    void vObjectPoolQueueDelete( ObjectPool_t * pxPool,
+                                 QueueHandle_t xQueue )
+    {
+        configASSERT( pxPool );
+        configASSERT( xQueue );
+
+        /* The queue was created statically so vQueueDelete() does not free
+         * its memory. */
+        vQueueDelete( xQueue );
+        vObjectPoolFree( pxPool, ( void * ) xQueue );
+    }
+
+#endif /* configSUPPORT_STATIC_ALLOCATION */
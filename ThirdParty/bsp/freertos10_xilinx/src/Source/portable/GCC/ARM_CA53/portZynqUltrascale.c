@@ -33,6 +33,9 @@
 #include "xscugic.h"
 #ifndef XPAR_XILTIMER_ENABLED
 #include "xttcps.h"
+#if( configUSE_TICKLESS_IDLE == 1 )
+#include "portTtcTickless.h"
+#endif
 #else
 #include "xiltimer.h"
 #endif
@@ -106,6 +109,10 @@ const uint8_t ucLevelSensitive = 1;
 	XTtcPs_SetInterval( &xTimerInstance, usInterval );
 	XTtcPs_SetPrescaler( &xTimerInstance, ucPrescale );
 
+#if( configUSE_TICKLESS_IDLE == 1 )
+	vPortTtcTicklessInit( &xTimerInstance, usInterval );
+#endif
+
 	xPortInstallInterruptHandler(configTIMER_INTERRUPT_ID,
 					( Xil_InterruptHandler ) FreeRTOS_Tick_Handler,
 					( void * ) &xTimerInstance);
@@ -158,6 +165,9 @@ void FreeRTOS_ClearTickInterrupt( void )
 	XTtcPs_ClearInterruptStatus( &xTimerInstance, XTtcPs_GetInterruptStatus( &xTimerInstance ) );
 	__asm volatile( "DSB SY" );
 	__asm volatile( "ISB SY" );
+#if( configUSE_TICKLESS_IDLE == 1 )
+	vPortTtcTicklessTickCleared();
+#endif
 #else
 	XTimer_ClearTickInterrupt();
 #endif
@@ -149,11 +149,27 @@ extern void vPortInstallFreeRTOSVectorTable( void );
 	__asm volatile ( "ISB SY" );
 #endif
 
+/* Turn interrupts off in the CPU itself, named as in the Cortex-R5 port so the
+shared TTC tickless code builds for both. */
+#define portCPU_IRQ_DISABLE()		portDISABLE_INTERRUPTS()
+#define portCPU_IRQ_ENABLE()		portENABLE_INTERRUPTS()
+
 /* These macros do not globally disable/enable interrupts.  They do mask off
 interrupts that have a priority below configMAX_API_CALL_INTERRUPT_PRIORITY. */
 #define portENTER_CRITICAL()		vPortEnterCritical();
 #define portEXIT_CRITICAL()			vPortExitCritical();
 
+#if( configUSE_TICKLESS_IDLE == 1 )
+	/* The tick is suppressed by moving the match point of the TTC used for the
+	tick, which is done in portTtcTickless.c. */
+	#if defined( XPAR_XILTIMER_ENABLED ) || ( configGENERATE_RUN_TIME_STATS == 1 )
+		#error configUSE_TICKLESS_IDLE needs the TTC tick timer and configGENERATE_RUN_TIME_STATS set to 0
+	#endif
+
+	extern void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime );
+	#define portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime )	vPortSuppressTicksAndSleep( xExpectedIdleTime )
+#endif
+
 /*-----------------------------------------------------------*/
 
 /* Task function macros as described on the FreeRTOS.org WEB site.  These are
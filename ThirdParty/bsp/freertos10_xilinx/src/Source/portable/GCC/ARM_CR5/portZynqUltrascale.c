@@ -37,6 +37,9 @@
 #include "xscugic.h"
 #ifndef XPAR_XILTIMER_ENABLED
 #include "xttcps.h"
+#if( configUSE_TICKLESS_IDLE == 1 )
+#include "portTtcTickless.h"
+#endif
 #else
 #include "xiltimer.h"
 #endif
@@ -135,6 +138,10 @@ XScuGic_Config *pxInterruptControllerConfig;
 #endif
 	XTtcPs_SetInterval( &xTimerInstance, usInterval );
 	XTtcPs_SetPrescaler( &xTimerInstance, ucPrescaler );
+
+#if( configUSE_TICKLESS_IDLE == 1 )
+	vPortTtcTicklessInit( &xTimerInstance, usInterval );
+#endif
 	/* Enable the interrupt for timer. */
 	XScuGic_EnableIntr( configINTERRUPT_CONTROLLER_BASE_ADDRESS, configTIMER_INTERRUPT_ID );
 	XTtcPs_EnableInterrupts( &xTimerInstance, XTTCPS_IXR_INTERVAL_MASK );
@@ -178,6 +185,9 @@ void FreeRTOS_ClearTickInterrupt( void )
 {
 #ifndef XPAR_XILTIMER_ENABLED
 	XTtcPs_ClearInterruptStatus( &xTimerInstance, XTtcPs_GetInterruptStatus( &xTimerInstance ) );
+#if( configUSE_TICKLESS_IDLE == 1 )
+	vPortTtcTicklessTickCleared();
+#endif
 #else
 	XTimer_ClearTickInterrupt();
 #endif
@@ -0,0 +1,194 @@
+/*
+ * FreeRTOS Kernel V10.4.6
+ * Copyright (C) 2026 Xilinx, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Tickless idle for the ports whose tick comes from a TTC, shared by the
+ * Cortex-R5 and Cortex-A53 ports.  The TTC is never stopped or reloaded, only
+ * its interval (match) register is moved, so the tick keeps its phase however
+ * often the core sleeps.
+ */
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Xilinx includes. */
+#include "xparameters.h"
+
+#if( configUSE_TICKLESS_IDLE == 1 ) && !defined( XPAR_XILTIMER_ENABLED )
+
+#include "xil_io.h"
+#include "xscugic_hw.h"
+#include "xttcps.h"
+#include "portTtcTickless.h"
+
+/* Timer used to generate the tick interrupt. */
+static XTtcPs *pxTimerInstance = NULL;
+
+/* Number of timer counts in one tick period, and the number of tick periods
+that fit in the interval register. */
+static uint32_t ulTimerCountsForOneTick = 0;
+static TickType_t xMaximumPossibleSuppressedTicks = 0;
+
+/* Tick periods since the counter last restarted which were already added to
+the tick count.  Non zero only while the interval register
+spans several tick periods after a sleep. */
+static volatile uint32_t ulSteppedPeriods = 0;
+/*-----------------------------------------------------------*/
+
+void vPortTtcTicklessInit( XTtcPs *pxTimer, XInterval xCountsForOneTick )
+{
+	pxTimerInstance = pxTimer;
+	ulTimerCountsForOneTick = ( uint32_t ) xCountsForOneTick;
+	xMaximumPossibleSuppressedTicks = ( TickType_t ) ( XTTCPS_MAX_INTERVAL_COUNT / ulTimerCountsForOneTick ) - 1;
+}
+/*-----------------------------------------------------------*/
+
+void vPortTtcTicklessTickCleared( void )
+{
+	if( ( ulSteppedPeriods != 0U ) && ( ( uint32_t ) XTtcPs_GetCounterValue( pxTimerInstance ) < ulTimerCountsForOneTick ) )
+	{
+		/* The counter restarted from 0 on the match which raised this
+		interrupt, so the single tick period is restored in phase. */
+		XTtcPs_SetInterval( pxTimerInstance, ( XInterval ) ulTimerCountsForOneTick );
+		ulSteppedPeriods = 0;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvTickInterruptPending( void )
+{
+uint32_t ulPending;
+
+	ulPending = Xil_In32( configINTERRUPT_CONTROLLER_BASE_ADDRESS + XSCUGIC_PENDING_SET_OFFSET + ( ( configTIMER_INTERRUPT_ID / 32U ) * 4U ) );
+
+	return ( ( ulPending & ( 1UL << ( configTIMER_INTERRUPT_ID % 32U ) ) ) != 0U ) ? pdTRUE : pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime )
+{
+uint32_t ulCounterAtSleep, ulCounter, ulPrevious, ulCompleteTicks, ulNextMatch, ulLateTick;
+BaseType_t xExpired = pdFALSE;
+TickType_t xModifiableIdleTime;
+
+	if( xExpectedIdleTime > ( xMaximumPossibleSuppressedTicks - ulSteppedPeriods ) )
+	{
+		xExpectedIdleTime = xMaximumPossibleSuppressedTicks - ulSteppedPeriods;
+	}
+
+	/* The tick interrupt has the lowest priority so a critical section would
+	stop it from waking the core.  Turn interrupts off in the CPU instead, WFI
+	still returns when an interrupt is pending. */
+	portCPU_IRQ_DISABLE();
+
+	if( eTaskConfirmSleepModeStatus() == eAbortSleep )
+	{
+		portCPU_IRQ_ENABLE();
+		return;
+	}
+
+	/* The TTC keeps counting from the last tick boundary, only its match
+	point is moved to the end of the idle period.  The timer is never stopped
+	or reloaded, so no counts are lost and the tick does not drift however
+	often the core sleeps. */
+	ulCounterAtSleep = ( uint32_t ) XTtcPs_GetCounterValue( pxTimerInstance );
+	XTtcPs_SetInterval( pxTimerInstance, ( XInterval ) ( ulTimerCountsForOneTick * ( ulSteppedPeriods + ( uint32_t ) xExpectedIdleTime ) ) );
+	ulCounter = ( uint32_t ) XTtcPs_GetCounterValue( pxTimerInstance );
+
+	if( ( ulCounter < ulCounterAtSleep ) || ( prvTickInterruptPending() != pdFALSE ) )
+	{
+		/* A tick is already pending, or the counter reached the tick boundary
+		before the new match point was written.  Put the previous match point
+		back and let the tick interrupt run. */
+		XTtcPs_SetInterval( pxTimerInstance, ( XInterval ) ( ulTimerCountsForOneTick * ( ulSteppedPeriods + 1U ) ) );
+		portCPU_IRQ_ENABLE();
+		return;
+	}
+
+	xModifiableIdleTime = xExpectedIdleTime;
+	configPRE_SLEEP_PROCESSING( xModifiableIdleTime );
+	if( xModifiableIdleTime > 0 )
+	{
+		__asm volatile ( "DSB SY" ::: "memory" );
+		__asm volatile ( "WFI" );
+		__asm volatile ( "ISB SY" );
+	}
+	configPOST_SLEEP_PROCESSING( xExpectedIdleTime );
+
+	/* The counter only restarts from 0 when the whole idle period has passed,
+	which also leaves the tick interrupt pending.  Otherwise another interrupt
+	woke the core and the counter gives the number of complete tick periods.
+	Either way the match point is moved to the next tick boundary, retrying if
+	the counter passes it before the write lands. */
+	ulPrevious = ulCounterAtSleep;
+	for( ;; )
+	{
+		ulCounter = ( uint32_t ) XTtcPs_GetCounterValue( pxTimerInstance );
+		if( ( ulCounter < ulPrevious ) || ( prvTickInterruptPending() != pdFALSE ) )
+		{
+			xExpired = pdTRUE;
+		}
+
+		ulCompleteTicks = ulCounter / ulTimerCountsForOneTick;
+		ulNextMatch = ( ulCompleteTicks + 1UL ) * ulTimerCountsForOneTick;
+		XTtcPs_SetInterval( pxTimerInstance, ( XInterval ) ulNextMatch );
+
+		ulPrevious = ulCounter;
+		ulCounter = ( uint32_t ) XTtcPs_GetCounterValue( pxTimerInstance );
+		if( ( ulCounter >= ulPrevious ) && ( ulCounter < ulNextMatch ) )
+		{
+			break;
+		}
+	}
+
+	if( xExpired != pdFALSE )
+	{
+		/* The pending tick interrupt accounts for the last tick period of the
+		idle time.  Periods counted after it only occur if waking up took
+		longer than a tick.  vTaskStepTick() cannot move the tick count past
+		the next unblock time, so they are added as pended ticks instead,
+		which xTaskResumeAll() processes like ticks that occurred while the
+		scheduler was suspended. */
+		vTaskStepTick( xExpectedIdleTime - 1 );
+		for( ulLateTick = 0; ulLateTick < ulCompleteTicks; ulLateTick++ )
+		{
+			( void ) xTaskIncrementTick();
+		}
+	}
+	else
+	{
+		vTaskStepTick( ( TickType_t ) ( ulCompleteTicks - ulSteppedPeriods ) );
+	}
+	ulSteppedPeriods = ulCompleteTicks;
+
+	portCPU_IRQ_ENABLE();
+}
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_TICKLESS_IDLE */
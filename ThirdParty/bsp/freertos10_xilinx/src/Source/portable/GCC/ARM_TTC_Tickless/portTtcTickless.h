@@ -0,0 +1,40 @@
+/*
+ * FreeRTOS Kernel V10.4.6
+ * Copyright (C) 2026 Xilinx, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef PORT_TTC_TICKLESS_H
+#define PORT_TTC_TICKLESS_H
+
+#include "xttcps.h"
+
+/* Hooks of the TTC tick used by the shared tickless idle implementation in
+portTtcTickless.c.  vPortTtcTicklessInit() is called once the tick interval is
+set, vPortTtcTicklessTickCleared() from FreeRTOS_ClearTickInterrupt(). */
+void vPortTtcTicklessInit( XTtcPs *pxTimer, XInterval xCountsForOneTick );
+void vPortTtcTicklessTickCleared( void );
+
+#endif /* PORT_TTC_TICKLESS_H */
@@ -0,0 +1,807 @@
+/*
+ * FreeRTOS Kernel V10.4.6
+ * Copyright (C) 2026 Xilinx, Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * A sample implementation of pvPortMalloc() and vPortFree() with a bounded
+ * execution time, based on the two level segregated fit (TLSF) algorithm.
+ *
+ * Free blocks are kept in segregated lists, one list per size class.  The
+ * first level splits sizes by powers of two, the second level splits each
+ * power of two range linearly into heapSL_INDEX_COUNT classes.  A bitmap for
+ * each level records which lists are not empty, so a suitable free block is
+ * found with two find-first-set operations instead of a walk of the free list
+ * as done by heap_4.c and heap_5.c.  Each block also records the block that
+ * precedes it in memory, so a block being freed is combined (coalesced)
+ * with its neighbours without searching for them.  pvPortMalloc() and
+ * vPortFree() therefore take the same time regardless of the number of free
+ * blocks.
+ *
+ * See heap_1.c, heap_2.c, heap_3.c, heap_4.c and heap_5.c for alternative
+ * implementations, and the memory management pages of https://www.FreeRTOS.org
+ * for more information.
+ *
+ * Usage notes:
+ *
+ * The heap can be spread over multiple non-contiguous blocks of memory, as
+ * done by heap_5.c.  The blocks are defined by passing an array of
+ * HeapRegion_t structures, terminated by a NULL zero sized region, to
+ * vPortDefineHeapRegions() before the first call to pvPortMalloc().  Unlike
+ * heap_5.c the regions may appear in any order.
+ *
+ * If vPortDefineHeapRegions() is not called then the heap is a single
+ * configTOTAL_HEAP_SIZE bytes array, as done by heap_4.c, which is set up on
+ * the first call to pvPortMalloc().
+ *
+ * Memory is handed out with "good fit" rather than "best fit" semantics - the
+ * requested size is rounded up to the next size class, so at most one part in
+ * heapSL_INDEX_COUNT of a large block can be left unused at its end.
+ *
+ * When configUSE_HEAP_CLASS_STATS is 1, uxPortGetHeapClassStats() returns
+ * statistics for each first level size class, in addition to those returned
+ * by vPortGetHeapStats().
+ *
+ */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+    #error This file must not be used if configSUPPORT_DYNAMIC_ALLOCATION is 0
+#endif
+
+/* The log2 of the number of second level classes in each first level class.
+ * Larger values waste less memory at the end of blocks but need larger
+ * bitmaps, the second level bitmap must fit in a uint32_t. */
+#ifndef configHEAP_TLSF_SL_INDEX_COUNT_LOG2
+    #define configHEAP_TLSF_SL_INDEX_COUNT_LOG2    4
+#endif
+
+#if ( configHEAP_TLSF_SL_INDEX_COUNT_LOG2 > 5 )
+    #error configHEAP_TLSF_SL_INDEX_COUNT_LOG2 must not be greater than 5
+#endif
+
+/* The log2 of the byte alignment, the blocks smaller than
+ * heapSMALL_BLOCK_SIZE are split into classes of portBYTE_ALIGNMENT bytes. */
+#if ( portBYTE_ALIGNMENT == 32 )
+    #define heapALIGNMENT_LOG2    5
+#elif ( portBYTE_ALIGNMENT == 16 )
+    #define heapALIGNMENT_LOG2    4
+#elif ( portBYTE_ALIGNMENT == 8 )
+    #define heapALIGNMENT_LOG2    3
+#elif ( portBYTE_ALIGNMENT == 4 )
+    #define heapALIGNMENT_LOG2    2
+#else
+    #error heap_6.c requires portBYTE_ALIGNMENT to be 4, 8, 16 or 32
+#endif
+
+/* Size class geometry.  All blocks smaller than heapSMALL_BLOCK_SIZE share the
+ * first first level class.  Blocks must be smaller than heapMAX_BLOCK_SIZE. */
+#define heapSL_INDEX_COUNT        ( 1U << configHEAP_TLSF_SL_INDEX_COUNT_LOG2 )
+#define heapFL_INDEX_SHIFT        ( configHEAP_TLSF_SL_INDEX_COUNT_LOG2 + heapALIGNMENT_LOG2 )
+#define heapFL_INDEX_MAX          ( 31U )
+#define heapFL_INDEX_COUNT        ( heapFL_INDEX_MAX - heapFL_INDEX_SHIFT + 1U )
+#define heapSMALL_BLOCK_SIZE      ( ( size_t ) 1U << heapFL_INDEX_SHIFT )
+#define heapMAX_BLOCK_SIZE        ( ( size_t ) 1U << heapFL_INDEX_MAX )
+
+/* Set in the xBlockSize member of a block that is in a free list.  Block sizes
+ * are always a multiple of portBYTE_ALIGNMENT so the bit is otherwise zero. */
+#define heapBLOCK_FREE_BIT        ( ( size_t ) 1U )
+#define heapBLOCK_SIZE_MASK       ( ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) )
+
+/* Find last set and find first set, the argument must not be zero. */
+#ifndef heapFLS
+    #define heapFLS( x )    ( 31U - ( uint32_t ) __builtin_clz( ( uint32_t ) ( x ) ) )
+#endif
+#ifndef heapFFS
+    #define heapFFS( x )    ( ( uint32_t ) __builtin_ctz( ( uint32_t ) ( x ) ) )
+#endif
+
+/* Define the block header.  Only pxPreviousPhysicalBlock and xBlockSize are
+ * present in an allocated block, the free list links overlap the memory that
+ * is handed to the application. */
+typedef struct A_TLSF_BLOCK
+{
+    struct A_TLSF_BLOCK * pxPreviousPhysicalBlock; /*<< The block that precedes this one in memory, NULL for the first block of a region. */
+    size_t xBlockSize;                             /*<< The size of the block, header included, and heapBLOCK_FREE_BIT. */
+    struct A_TLSF_BLOCK * pxNextFreeBlock;         /*<< The next block in the same free list, free blocks only. */
+    struct A_TLSF_BLOCK * pxPreviousFreeBlock;     /*<< The previous block in the same free list, free blocks only. */
+} TlsfBlock_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Sets up the heap as a single configTOTAL_HEAP_SIZE bytes region if
+ * vPortDefineHeapRegions() was not called before the first allocation.
+ */
+static void prvHeapInit( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Adds a region of memory to the heap as a single free block followed by an
+ * end marker.  Returns the number of bytes made available, zero if the region
+ * is too small to be used.
+ */
+static size_t prvAddRegion( uint8_t * pucRegion,
+                            size_t xRegionSize ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the first and second level indexes of the class that holds blocks
+ * of xBlockSize bytes.
+ */
+static void prvMappingInsert( size_t xBlockSize,
+                              uint32_t * pulFirstLevel,
+                              uint32_t * pulSecondLevel ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the first and second level indexes of the smallest class in which
+ * every block can hold xBlockSize bytes.
+ */
+static void prvMappingSearch( size_t xBlockSize,
+                              uint32_t * pulFirstLevel,
+                              uint32_t * pulSecondLevel ) PRIVILEGED_FUNCTION;
+
+/*
+ * Removes and returns the first block of the first non-empty free list at or
+ * above the class given by the indexes, NULL if there is none.
+ */
+static TlsfBlock_t * prvTakeSuitableBlock( uint32_t ulFirstLevel,
+                                           uint32_t ulSecondLevel ) PRIVILEGED_FUNCTION;
+
+/*
+ * Inserts a block into, or removes a block from, the free list of its class.
+ */
+static void prvInsertFreeBlock( TlsfBlock_t * pxBlock ) PRIVILEGED_FUNCTION;
+static void prvRemoveFreeBlock( TlsfBlock_t * pxBlock ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+/* The size of the part of the block header that is present in allocated
+ * blocks, rounded up so the memory handed out is correctly aligned. */
+static const size_t xHeapStructSize = ( offsetof( TlsfBlock_t, pxNextFreeBlock ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+/* Free blocks must be large enough to hold the complete block header. */
+static const size_t xMinimumBlockSize = ( sizeof( TlsfBlock_t ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+#if ( configAPPLICATION_ALLOCATED_HEAP == 1 )
+
+/* The application writer has already defined the array used for the RTOS
+* heap - probably so it can be placed in a special segment or address. */
+    extern uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+#else
+    PRIVILEGED_DATA static uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+#endif /* configAPPLICATION_ALLOCATED_HEAP */
+
+/* Bitmaps of the non-empty free lists, and the heads of the free lists. */
+PRIVILEGED_DATA static uint32_t ulFirstLevelBitmap = 0U;
+PRIVILEGED_DATA static uint32_t ulSecondLevelBitmap[ heapFL_INDEX_COUNT ];
+PRIVILEGED_DATA static TlsfBlock_t * pxFreeLists[ heapFL_INDEX_COUNT ][ heapSL_INDEX_COUNT ];
+
+/* Set once the heap regions have been defined. */
+PRIVILEGED_DATA static BaseType_t xHeapInitialised = pdFALSE;
+
+/* Keeps track of the number of calls to allocate and free memory as well as the
+ * number of free bytes remaining, but says nothing about fragmentation. */
+PRIVILEGED_DATA static size_t xFreeBytesRemaining = 0U;
+PRIVILEGED_DATA static size_t xMinimumEverFreeBytesRemaining = 0U;
+PRIVILEGED_DATA static size_t xNumberOfFreeBlocks = 0U;
+PRIVILEGED_DATA static size_t xNumberOfSuccessfulAllocations = 0;
+PRIVILEGED_DATA static size_t xNumberOfSuccessfulFrees = 0;
+
+#if ( configUSE_HEAP_CLASS_STATS == 1 )
+    /* Per first level class counters returned by uxPortGetHeapClassStats(). */
+    PRIVILEGED_DATA static size_t xClassFreeBlocks[ heapFL_INDEX_COUNT ];
+    PRIVILEGED_DATA static size_t xClassSuccessfulAllocations[ heapFL_INDEX_COUNT ];
+    PRIVILEGED_DATA static size_t xClassFailedAllocations[ heapFL_INDEX_COUNT ];
+#endif
+
+/*-----------------------------------------------------------*/
+
+void * pvPortMalloc( size_t xWantedSize )
+{
+    TlsfBlock_t * pxBlock, * pxNewBlock, * pxNextBlock;
+    uint32_t ulFirstLevel, ulSecondLevel;
+    void * pvReturn = NULL;
+
+    vTaskSuspendAll();
+    {
+        /* If this is the first call to malloc then the heap will require
+         * initialisation to setup the free lists. */
+        if( xHeapInitialised == pdFALSE )
+        {
+            prvHeapInit();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* The wanted size is increased so it can contain the block header in
+         * addition to the requested amount of bytes, and is rounded up to keep
+         * blocks aligned.  Requests that would reach heapMAX_BLOCK_SIZE cannot
+         * be met, which also protects the calculation from overflowing. */
+        if( ( xWantedSize > 0 ) && ( xWantedSize < ( heapMAX_BLOCK_SIZE - xHeapStructSize - portBYTE_ALIGNMENT ) ) )
+        {
+            xWantedSize = ( xWantedSize + xHeapStructSize + portBYTE_ALIGNMENT_MASK ) & heapBLOCK_SIZE_MASK;
+
+            if( xWantedSize < xMinimumBlockSize )
+            {
+                xWantedSize = xMinimumBlockSize;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            prvMappingSearch( xWantedSize, &ulFirstLevel, &ulSecondLevel );
+
+            if( ulFirstLevel < heapFL_INDEX_COUNT )
+            {
+                pxBlock = prvTakeSuitableBlock( ulFirstLevel, ulSecondLevel );
+
+                if( pxBlock != NULL )
+                {
+                    /* If the block is larger than required it can be split into
+                     * two, the part after the wanted size goes back to the free
+                     * lists. */
+                    if( ( pxBlock->xBlockSize - xWantedSize ) >= xMinimumBlockSize )
+                    {
+                        pxNewBlock = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xWantedSize );
+                        pxNewBlock->xBlockSize = pxBlock->xBlockSize - xWantedSize;
+                        pxNewBlock->pxPreviousPhysicalBlock = pxBlock;
+
+                        pxNextBlock = ( void * ) ( ( ( uint8_t * ) pxNewBlock ) + pxNewBlock->xBlockSize );
+                        pxNextBlock->pxPreviousPhysicalBlock = pxNewBlock;
+
+                        pxBlock->xBlockSize = xWantedSize;
+                        prvInsertFreeBlock( pxNewBlock );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    xFreeBytesRemaining -= pxBlock->xBlockSize;
+
+                    if( xFreeBytesRemaining < xMinimumEverFreeBytesRemaining )
+                    {
+                        xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    /* Return the memory space pointed to - jumping over the
+                     * block header at its start. */
+                    pvReturn = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xHeapStructSize );
+                    xNumberOfSuccessfulAllocations++;
+
+                    #if ( configUSE_HEAP_CLASS_STATS == 1 )
+                    {
+                        xClassSuccessfulAllocations[ ulFirstLevel ]++;
+                    }
+                    #endif
+                }
+                else
+                {
+                    #if ( configUSE_HEAP_CLASS_STATS == 1 )
+                    {
+                        xClassFailedAllocations[ ulFirstLevel ]++;
+                    }
+                    #else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                    #endif
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceMALLOC( pvReturn, xWantedSize );
+    }
+    ( void ) xTaskResumeAll();
+
+    #if ( configUSE_MALLOC_FAILED_HOOK == 1 )
+        {
+            if( pvReturn == NULL )
+            {
+                extern void vApplicationMallocFailedHook( void );
+                vApplicationMallocFailedHook();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    #endif /* if ( configUSE_MALLOC_FAILED_HOOK == 1 ) */
+
+    configASSERT( ( ( ( size_t ) pvReturn ) & ( size_t ) portBYTE_ALIGNMENT_MASK ) == 0 );
+    return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void * pv )
+{
+    uint8_t * puc = ( uint8_t * ) pv;
+    TlsfBlock_t * pxBlock, * pxNeighbour, * pxNextBlock;
+
+    if( pv != NULL )
+    {
+        /* The memory being freed will have a block header immediately before
+         * it. */
+        puc -= xHeapStructSize;
+
+        /* This casting is to keep the compiler from issuing warnings. */
+        pxBlock = ( void * ) puc;
+
+        /* Check the block is actually allocated. */
+        configASSERT( ( pxBlock->xBlockSize & heapBLOCK_FREE_BIT ) == 0 );
+
+        if( ( pxBlock->xBlockSize & heapBLOCK_FREE_BIT ) == 0 )
+        {
+            vTaskSuspendAll();
+            {
+                xFreeBytesRemaining += pxBlock->xBlockSize;
+                traceFREE( pv, pxBlock->xBlockSize );
+
+                /* Combine the block with the block that follows it in memory if
+                 * that one is free.  The end marker of a region is never free. */
+                pxNeighbour = ( void * ) ( puc + pxBlock->xBlockSize );
+
+                if( ( pxNeighbour->xBlockSize & heapBLOCK_FREE_BIT ) != 0 )
+                {
+                    prvRemoveFreeBlock( pxNeighbour );
+                    pxBlock->xBlockSize += pxNeighbour->xBlockSize & heapBLOCK_SIZE_MASK;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                /* Combine the block with the block that precedes it in memory if
+                 * that one is free. */
+                pxNeighbour = pxBlock->pxPreviousPhysicalBlock;
+
+                if( ( pxNeighbour != NULL ) && ( ( pxNeighbour->xBlockSize & heapBLOCK_FREE_BIT ) != 0 ) )
+                {
+                    prvRemoveFreeBlock( pxNeighbour );
+                    pxNeighbour->xBlockSize += pxBlock->xBlockSize;
+                    pxBlock = pxNeighbour;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                pxNextBlock = ( void * ) ( ( ( uint8_t * ) pxBlock ) + pxBlock->xBlockSize );
+                pxNextBlock->pxPreviousPhysicalBlock = pxBlock;
+
+                prvInsertFreeBlock( pxBlock );
+                xNumberOfSuccessfulFrees++;
+            }
+            ( void ) xTaskResumeAll();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetFreeHeapSize( void )
+{
+    return xFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetMinimumEverFreeHeapSize( void )
+{
+    return xMinimumEverFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+void vPortInitialiseBlocks( void )
+{
+    /* This just exists to keep the linker quiet. */
+}
+/*-----------------------------------------------------------*/
+
+static void prvMappingInsert( size_t xBlockSize,
+                              uint32_t * pulFirstLevel,
+                              uint32_t * pulSecondLevel )
+{
+    uint32_t ulMostSignificantBit;
+
+    if( xBlockSize < heapSMALL_BLOCK_SIZE )
+    {
+        *pulFirstLevel = 0U;
+        *pulSecondLevel = ( uint32_t ) ( xBlockSize >> heapALIGNMENT_LOG2 );
+    }
+    else
+    {
+        ulMostSignificantBit = heapFLS( xBlockSize );
+        *pulSecondLevel = ( uint32_t ) ( xBlockSize >> ( ulMostSignificantBit - configHEAP_TLSF_SL_INDEX_COUNT_LOG2 ) ) ^ heapSL_INDEX_COUNT;
+        *pulFirstLevel = ulMostSignificantBit - ( heapFL_INDEX_SHIFT - 1U );
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvMappingSearch( size_t xBlockSize,
+                              uint32_t * pulFirstLevel,
+                              uint32_t * pulSecondLevel )
+{
+    /* Round the size up to the start of the next class, unless it already is
+     * the start of a class, so any block found in the class is large enough.
+     * The caller has made sure this cannot overflow. */
+    if( xBlockSize >= heapSMALL_BLOCK_SIZE )
+    {
+        xBlockSize += ( ( size_t ) 1U << ( heapFLS( xBlockSize ) - configHEAP_TLSF_SL_INDEX_COUNT_LOG2 ) ) - 1U;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    prvMappingInsert( xBlockSize, pulFirstLevel, pulSecondLevel );
+}
+/*-----------------------------------------------------------*/
+
+static TlsfBlock_t * prvTakeSuitableBlock( uint32_t ulFirstLevel,
+                                           uint32_t ulSecondLevel )
+{
+    TlsfBlock_t * pxBlock = NULL;
+    uint32_t ulBitmap;
+
+    /* Look for a non-empty list in the same first level class first, then in
+     * the larger first level classes, where any list will do. */
+    ulBitmap = ulSecondLevelBitmap[ ulFirstLevel ] & ( ~0UL << ulSecondLevel );
+
+    if( ulBitmap == 0U )
+    {
+        ulBitmap = ( ulFirstLevel + 1U < heapFL_INDEX_COUNT ) ? ( ulFirstLevelBitmap & ( ~0UL << ( ulFirstLevel + 1U ) ) ) : 0U;
+
+        if( ulBitmap != 0U )
+        {
+            ulFirstLevel = heapFFS( ulBitmap );
+            ulBitmap = ulSecondLevelBitmap[ ulFirstLevel ];
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    if( ulBitmap != 0U )
+    {
+        ulSecondLevel = heapFFS( ulBitmap );
+        pxBlock = pxFreeLists[ ulFirstLevel ][ ulSecondLevel ];
+        prvRemoveFreeBlock( pxBlock );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return pxBlock;
+}
+/*-----------------------------------------------------------*/
+
+static void prvInsertFreeBlock( TlsfBlock_t * pxBlock )
+{
+    uint32_t ulFirstLevel, ulSecondLevel;
+    TlsfBlock_t * pxHead;
+
+    prvMappingInsert( pxBlock->xBlockSize, &ulFirstLevel, &ulSecondLevel );
+
+    pxHead = pxFreeLists[ ulFirstLevel ][ ulSecondLevel ];
+    pxBlock->pxNextFreeBlock = pxHead;
+    pxBlock->pxPreviousFreeBlock = NULL;
+
+    if( pxHead != NULL )
+    {
+        pxHead->pxPreviousFreeBlock = pxBlock;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    pxFreeLists[ ulFirstLevel ][ ulSecondLevel ] = pxBlock;
+    ulFirstLevelBitmap |= 1UL << ulFirstLevel;
+    ulSecondLevelBitmap[ ulFirstLevel ] |= 1UL << ulSecondLevel;
+
+    pxBlock->xBlockSize |= heapBLOCK_FREE_BIT;
+    xNumberOfFreeBlocks++;
+
+    #if ( configUSE_HEAP_CLASS_STATS == 1 )
+    {
+        xClassFreeBlocks[ ulFirstLevel ]++;
+    }
+    #endif
+}
+/*-----------------------------------------------------------*/
+
+static void prvRemoveFreeBlock( TlsfBlock_t * pxBlock )
+{
+    uint32_t ulFirstLevel, ulSecondLevel;
+
+    pxBlock->xBlockSize &= ~heapBLOCK_FREE_BIT;
+    prvMappingInsert( pxBlock->xBlockSize, &ulFirstLevel, &ulSecondLevel );
+
+    if( pxBlock->pxNextFreeBlock != NULL )
+    {
+        pxBlock->pxNextFreeBlock->pxPreviousFreeBlock = pxBlock->pxPreviousFreeBlock;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    if( pxBlock->pxPreviousFreeBlock != NULL )
+    {
+        pxBlock->pxPreviousFreeBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
+    }
+    else
+    {
+        /* The block was the head of its list, clear the bitmaps if the list
+         * is now empty. */
+        pxFreeLists[ ulFirstLevel ][ ulSecondLevel ] = pxBlock->pxNextFreeBlock;
+
+        if( pxBlock->pxNextFreeBlock == NULL )
+        {
+            ulSecondLevelBitmap[ ulFirstLevel ] &= ~( 1UL << ulSecondLevel );
+
+            if( ulSecondLevelBitmap[ ulFirstLevel ] == 0U )
+            {
+                ulFirstLevelBitmap &= ~( 1UL << ulFirstLevel );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+    xNumberOfFreeBlocks--;
+
+    #if ( configUSE_HEAP_CLASS_STATS == 1 )
+    {
+        xClassFreeBlocks[ ulFirstLevel ]--;
+    }
+    #endif
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvAddRegion( uint8_t * pucRegion,
+                            size_t xRegionSize )
+{
+    TlsfBlock_t * pxFirstBlock, * pxEndMarker;
+    size_t xAddress, xBlockSize;
+
+    /* Ensure the region starts on a correctly aligned boundary. */
+    xAddress = ( size_t ) pucRegion;
+
+    if( ( xAddress & portBYTE_ALIGNMENT_MASK ) != 0 )
+    {
+        xAddress += ( portBYTE_ALIGNMENT - 1 );
+        xAddress &= ~portBYTE_ALIGNMENT_MASK;
+
+        if( ( xAddress - ( size_t ) pucRegion ) >= xRegionSize )
+        {
+            return 0;
+        }
+
+        xRegionSize -= xAddress - ( size_t ) pucRegion;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    /* Space is needed at the end of the region for the end marker, and the
+     * free block must not reach heapMAX_BLOCK_SIZE. */
+    xRegionSize &= heapBLOCK_SIZE_MASK;
+
+    if( xRegionSize < ( xMinimumBlockSize + xHeapStructSize ) )
+    {
+        return 0;
+    }
+
+    xBlockSize = xRegionSize - xHeapStructSize;
+
+    if( xBlockSize >= heapMAX_BLOCK_SIZE )
+    {
+        xBlockSize = heapMAX_BLOCK_SIZE - portBYTE_ALIGNMENT;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    pxFirstBlock = ( void * ) xAddress;
+    pxFirstBlock->pxPreviousPhysicalBlock = NULL;
+    pxFirstBlock->xBlockSize = xBlockSize;
+
+    /* The end marker is a zero sized block that is never free, so a block
+     * being freed is never combined past the end of its region. */
+    pxEndMarker = ( void * ) ( xAddress + xBlockSize );
+    pxEndMarker->pxPreviousPhysicalBlock = pxFirstBlock;
+    pxEndMarker->xBlockSize = 0;
+
+    prvInsertFreeBlock( pxFirstBlock );
+
+    return xBlockSize;
+}
+/*-----------------------------------------------------------*/
+
+static void prvHeapInit( void )
+{
+    HeapRegion_t xHeapRegions[ 2 ];
+
+    xHeapRegions[ 0 ].pucStartAddress = ucHeap;
+    xHeapRegions[ 0 ].xSizeInBytes = configTOTAL_HEAP_SIZE;
+    xHeapRegions[ 1 ].pucStartAddress = NULL;
+    xHeapRegions[ 1 ].xSizeInBytes = 0;
+
+    vPortDefineHeapRegions( xHeapRegions );
+}
+/*-----------------------------------------------------------*/
+
+void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions )
+{
+    const HeapRegion_t * pxHeapRegion;
+    size_t xTotalHeapSize = 0;
+
+    /* Can only call once, and before the first allocation! */
+    configASSERT( xHeapInitialised == pdFALSE );
+
+    for( pxHeapRegion = pxHeapRegions; pxHeapRegion->xSizeInBytes > 0; pxHeapRegion++ )
+    {
+        xTotalHeapSize += prvAddRegion( pxHeapRegion->pucStartAddress, pxHeapRegion->xSizeInBytes );
+    }
+
+    xMinimumEverFreeBytesRemaining = xTotalHeapSize;
+    xFreeBytesRemaining = xTotalHeapSize;
+    xHeapInitialised = pdTRUE;
+
+    /* Check something was actually defined before it is accessed. */
+    configASSERT( xTotalHeapSize );
+}
+/*-----------------------------------------------------------*/
+
+void vPortGetHeapStats( HeapStats_t * pxHeapStats )
+{
+    TlsfBlock_t * pxBlock;
+    size_t xBlockSize, xMaxSize = 0, xMinSize = portMAX_DELAY; /* portMAX_DELAY used as a portable way of getting the maximum value. */
+    uint32_t ulFirstLevel, ulSecondLevel;
+
+    vTaskSuspendAll();
+    {
+        /* The smallest and largest free blocks are in the lowest and highest
+         * non-empty lists, only those two lists need to be walked. */
+        if( ulFirstLevelBitmap != 0U )
+        {
+            ulFirstLevel = heapFFS( ulFirstLevelBitmap );
+            ulSecondLevel = heapFFS( ulSecondLevelBitmap[ ulFirstLevel ] );
+
+            for( pxBlock = pxFreeLists[ ulFirstLevel ][ ulSecondLevel ]; pxBlock != NULL; pxBlock = pxBlock->pxNextFreeBlock )
+            {
+                xBlockSize = pxBlock->xBlockSize & heapBLOCK_SIZE_MASK;
+
+                if( xBlockSize < xMinSize )
+                {
+                    xMinSize = xBlockSize;
+                }
+            }
+
+            ulFirstLevel = heapFLS( ulFirstLevelBitmap );
+            ulSecondLevel = heapFLS( ulSecondLevelBitmap[ ulFirstLevel ] );
+
+            for( pxBlock = pxFreeLists[ ulFirstLevel ][ ulSecondLevel ]; pxBlock != NULL; pxBlock = pxBlock->pxNextFreeBlock )
+            {
+                xBlockSize = pxBlock->xBlockSize & heapBLOCK_SIZE_MASK;
+
+                if( xBlockSize > xMaxSize )
+                {
+                    xMaxSize = xBlockSize;
+                }
+            }
+        }
+        else
+        {
+            xMinSize = 0;
+        }
+
+        pxHeapStats->xSizeOfLargestFreeBlockInBytes = xMaxSize;
+        pxHeapStats->xSizeOfSmallestFreeBlockInBytes = xMinSize;
+        pxHeapStats->xNumberOfFreeBlocks = xNumberOfFreeBlocks;
+        pxHeapStats->xAvailableHeapSpaceInBytes = xFreeBytesRemaining;
+        pxHeapStats->xNumberOfSuccessfulAllocations = xNumberOfSuccessfulAllocations;
+        pxHeapStats->xNumberOfSuccessfulFrees = xNumberOfSuccessfulFrees;
+        pxHeapStats->xMinimumEverFreeBytesRemaining = xMinimumEverFreeBytesRemaining;
+    }
+    ( void ) xTaskResumeAll();
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_HEAP_CLASS_STATS == 1 )
+
+    UBaseType_t uxPortGetHeapClassStats( HeapClassStats_t * pxClassStats,
+                                         UBaseType_t uxMaxClasses )
+    {
+        UBaseType_t uxClass;
+
+        if( uxMaxClasses > ( UBaseType_t ) heapFL_INDEX_COUNT )
+        {
+            uxMaxClasses = ( UBaseType_t ) heapFL_INDEX_COUNT;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        vTaskSuspendAll();
+        {
+            for( uxClass = 0; uxClass < uxMaxClasses; uxClass++ )
+            {
+                pxClassStats[ uxClass ].xMinimumBlockSizeInBytes = ( uxClass == 0 ) ? 0 : ( heapSMALL_BLOCK_SIZE << ( uxClass - 1 ) );
+                pxClassStats[ uxClass ].xNumberOfFreeBlocks = xClassFreeBlocks[ uxClass ];
+                pxClassStats[ uxClass ].xNumberOfSuccessfulAllocations = xClassSuccessfulAllocations[ uxClass ];
+                pxClassStats[ uxClass ].xNumberOfFailedAllocations = xClassFailedAllocations[ uxClass ];
+            }
+        }
+        ( void ) xTaskResumeAll();
+
+        return uxMaxClasses;
+    }
+
+#endif /* configUSE_HEAP_CLASS_STATS */
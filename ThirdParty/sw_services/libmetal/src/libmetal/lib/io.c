@@ -9,6 +9,17 @@
 #include <metal/io.h>
 #include <metal/sys.h>
 
+/*
+ * Block transfers of normal memory use 64-bit accesses, aligned on the
+ * I/O region side, unrolled to move METAL_IO_BLOCK_SIZE bytes per
+ * iteration.
+ */
+#define METAL_IO_WORD_SIZE	sizeof(uint64_t)
+#define METAL_IO_BLOCK_SIZE	(4 * METAL_IO_WORD_SIZE)
+
+/* Width used when a block is transferred through the region accessors */
+#define METAL_IO_OPS_WIDTH	sizeof(uint32_t)
+
 void metal_io_init(struct metal_io_region *io, void *virt,
 	      const metal_phys_addr_t *physmap, size_t size,
 	      unsigned int page_shift, unsigned int mem_flags,
@@ -35,11 +46,80 @@ void metal_io_init(struct metal_io_region *io, void *virt,
 	metal_list_init(&io->list);
 }
 
+/**
+ * Transfer a block through the read accessor of the region, for regions
+ * which only allow accesses of a given width. The aligned part of the
+ * block is read with METAL_IO_OPS_WIDTH accesses, the rest byte by byte.
+ */
+static void metal_io_ops_block_read(struct metal_io_region *io,
+				    unsigned long offset,
+				    unsigned char *dest, int len)
+{
+	uint32_t val;
+
+	for (; len && (offset % METAL_IO_OPS_WIDTH); offset++, dest++, len--)
+		*dest = (unsigned char)(*io->ops.read)(io, offset,
+						      memory_order_seq_cst, 1);
+	for (; len >= (int)METAL_IO_OPS_WIDTH; offset += METAL_IO_OPS_WIDTH,
+					dest += METAL_IO_OPS_WIDTH,
+					len -= METAL_IO_OPS_WIDTH) {
+		val = (uint32_t)(*io->ops.read)(io, offset,
+						memory_order_seq_cst,
+						METAL_IO_OPS_WIDTH);
+		memcpy(dest, &val, sizeof(val));
+	}
+	for (; len != 0; offset++, dest++, len--)
+		*dest = (unsigned char)(*io->ops.read)(io, offset,
+						      memory_order_seq_cst, 1);
+}
+
+static void metal_io_ops_block_write(struct metal_io_region *io,
+				     unsigned long offset,
+				     const unsigned char *source, int len)
+{
+	uint32_t val;
+
+	for (; len && (offset % METAL_IO_OPS_WIDTH); offset++, source++, len--)
+		(*io->ops.write)(io, offset, *source, memory_order_seq_cst, 1);
+	for (; len >= (int)METAL_IO_OPS_WIDTH; offset += METAL_IO_OPS_WIDTH,
+					source += METAL_IO_OPS_WIDTH,
+					len -= METAL_IO_OPS_WIDTH) {
+		memcpy(&val, source, sizeof(val));
+		(*io->ops.write)(io, offset, val, memory_order_seq_cst,
+				 METAL_IO_OPS_WIDTH);
+	}
+	for (; len != 0; offset++, source++, len--)
+		(*io->ops.write)(io, offset, *source, memory_order_seq_cst, 1);
+}
+
+static void metal_io_ops_block_set(struct metal_io_region *io,
+				   unsigned long offset,
+				   unsigned char value, int len)
+{
+	uint32_t cint = value;
+	unsigned int i;
+
+	for (i = 1; i < METAL_IO_OPS_WIDTH; i++)
+		cint |= ((uint32_t)value << (CHAR_BIT * i));
+
+	for (; len && (offset % METAL_IO_OPS_WIDTH); offset++, len--)
+		(*io->ops.write)(io, offset, value, memory_order_seq_cst, 1);
+	for (; len >= (int)METAL_IO_OPS_WIDTH; offset += METAL_IO_OPS_WIDTH,
+					len -= METAL_IO_OPS_WIDTH)
+		(*io->ops.write)(io, offset, cint, memory_order_seq_cst,
+				 METAL_IO_OPS_WIDTH);
+	for (; len != 0; offset++, len--)
+		(*io->ops.write)(io, offset, value, memory_order_seq_cst, 1);
+}
+
 int metal_io_block_read(struct metal_io_region *io, unsigned long offset,
 	       void *restrict dst, int len)
 {
 	unsigned char *ptr = metal_io_virt(io, offset);
 	unsigned char *dest = dst;
+	uint64_t *d;
+	const uint64_t *s;
+	uint64_t val;
 	int retlen;
 
 	if (!ptr)
@@ -50,21 +130,41 @@ int metal_io_block_read(struct metal_io_region *io, unsigned long offset,
 	if (io->ops.block_read) {
 		retlen = (*io->ops.block_read)(
 			io, offset, dst, memory_order_seq_cst, len);
+	} else if (io->ops.read) {
+		metal_io_ops_block_read(io, offset, dest, len);
 	} else {
 		atomic_thread_fence(memory_order_seq_cst);
-		while ( len && (
-			((uintptr_t)dest % sizeof(int)) ||
-			((uintptr_t)ptr % sizeof(int)))) {
+		/* Align the accesses to the I/O region */
+		while ( len && ((uintptr_t)ptr % METAL_IO_WORD_SIZE)) {
 			*(unsigned char *)dest =
 				*(const unsigned char *)ptr;
 			dest++;
 			ptr++;
 			len--;
 		}
-		for (; len >= (int)sizeof(int); dest += sizeof(int),
-					ptr += sizeof(int),
-					len -= sizeof(int))
-			*(unsigned int *)dest = *(const unsigned int *)ptr;
+		s = (const uint64_t *)ptr;
+		if (!((uintptr_t)dest % METAL_IO_WORD_SIZE)) {
+			d = (uint64_t *)dest;
+			for (; len >= (int)METAL_IO_BLOCK_SIZE; d += 4, s += 4,
+					len -= METAL_IO_BLOCK_SIZE) {
+				d[0] = s[0];
+				d[1] = s[1];
+				d[2] = s[2];
+				d[3] = s[3];
+			}
+			for (; len >= (int)METAL_IO_WORD_SIZE; d++, s++,
+					len -= METAL_IO_WORD_SIZE)
+				*d = *s;
+			dest = (unsigned char *)d;
+		} else {
+			for (; len >= (int)METAL_IO_WORD_SIZE; s++,
+					dest += METAL_IO_WORD_SIZE,
+					len -= METAL_IO_WORD_SIZE) {
+				val = *s;
+				memcpy(dest, &val, sizeof(val));
+			}
+		}
+		ptr = (unsigned char *)s;
 		for (; len != 0; dest++, ptr++, len--)
 			*(unsigned char *)dest =
 				*(const unsigned char *)ptr;
@@ -77,6 +177,9 @@ int metal_io_block_write(struct metal_io_region *io, unsigned long offset,
 {
 	unsigned char *ptr = metal_io_virt(io, offset);
 	const unsigned char *source = src;
+	uint64_t *d;
+	const uint64_t *s;
+	uint64_t val;
 	int retlen;
 
 	if (!ptr)
@@ -87,20 +190,40 @@ int metal_io_block_write(struct metal_io_region *io, unsigned long offset,
 	if (io->ops.block_write) {
 		retlen = (*io->ops.block_write)(
 			io, offset, src, memory_order_seq_cst, len);
+	} else if (io->ops.write) {
+		metal_io_ops_block_write(io, offset, source, len);
 	} else {
-		while ( len && (
-			((uintptr_t)ptr % sizeof(int)) ||
-			((uintptr_t)source % sizeof(int)))) {
+		/* Align the accesses to the I/O region */
+		while ( len && ((uintptr_t)ptr % METAL_IO_WORD_SIZE)) {
 			*(unsigned char *)ptr =
 				*(const unsigned char *)source;
 			ptr++;
 			source++;
 			len--;
 		}
-		for (; len >= (int)sizeof(int); ptr += sizeof(int),
-					source += sizeof(int),
-					len -= sizeof(int))
-			*(unsigned int *)ptr = *(const unsigned int *)source;
+		d = (uint64_t *)ptr;
+		if (!((uintptr_t)source % METAL_IO_WORD_SIZE)) {
+			s = (const uint64_t *)source;
+			for (; len >= (int)METAL_IO_BLOCK_SIZE; d += 4, s += 4,
+					len -= METAL_IO_BLOCK_SIZE) {
+				d[0] = s[0];
+				d[1] = s[1];
+				d[2] = s[2];
+				d[3] = s[3];
+			}
+			for (; len >= (int)METAL_IO_WORD_SIZE; d++, s++,
+					len -= METAL_IO_WORD_SIZE)
+				*d = *s;
+			source = (const unsigned char *)s;
+		} else {
+			for (; len >= (int)METAL_IO_WORD_SIZE; d++,
+					source += METAL_IO_WORD_SIZE,
+					len -= METAL_IO_WORD_SIZE) {
+				memcpy(&val, source, sizeof(val));
+				*d = val;
+			}
+		}
+		ptr = (unsigned char *)d;
 		for (; len != 0; ptr++, source++, len--)
 			*(unsigned char *)ptr =
 				*(const unsigned char *)source;
@@ -123,22 +246,33 @@ int metal_io_block_set(struct metal_io_region *io, unsigned long offset,
 	if (io->ops.block_set) {
 		(*io->ops.block_set)(
 			io, offset, value, memory_order_seq_cst, len);
+	} else if (io->ops.write) {
+		metal_io_ops_block_set(io, offset, value, len);
 	} else {
-		unsigned int cint = value;
+		uint64_t cint = value;
+		uint64_t *d;
 		unsigned int i;
 
-		for (i = 1; i < sizeof(int); i++)
-			cint |= ((unsigned int)value << (CHAR_BIT * i));
+		for (i = 1; i < METAL_IO_WORD_SIZE; i++)
+			cint |= ((uint64_t)value << (CHAR_BIT * i));
 
-		for (; len && ((uintptr_t)ptr % sizeof(int)); ptr++, len--)
+		for (; len && ((uintptr_t)ptr % METAL_IO_WORD_SIZE); ptr++, len--)
 			*(unsigned char *)ptr = (unsigned char) value;
-		for (; len >= (int)sizeof(int); ptr += sizeof(int),
-						len -= sizeof(int))
-			*(unsigned int *)ptr = cint;
+		d = (uint64_t *)ptr;
+		for (; len >= (int)METAL_IO_BLOCK_SIZE; d += 4,
+						len -= METAL_IO_BLOCK_SIZE) {
+			d[0] = cint;
+			d[1] = cint;
+			d[2] = cint;
+			d[3] = cint;
+		}
+		for (; len >= (int)METAL_IO_WORD_SIZE; d++,
+						len -= METAL_IO_WORD_SIZE)
+			*d = cint;
+		ptr = (unsigned char *)d;
 		for (; len != 0; ptr++, len--)
 			*(unsigned char *)ptr = (unsigned char) value;
 		atomic_thread_fence(memory_order_seq_cst);
 	}
 	return retlen;
 }
-
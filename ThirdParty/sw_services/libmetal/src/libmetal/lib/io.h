@@ -333,6 +333,8 @@ metal_io_write(struct metal_io_region *io, unsigned long offset,
 
 /**
  * @brief	Read a block from an I/O region.
+ *		Regions with a read accessor but no block operation
+ *		are accessed through the accessor, 32 bits at a time.
  * @param[in]	io	I/O region handle.
  * @param[in]	offset	Offset into I/O region.
  * @param[in]	dst	destination to store the read data.
@@ -344,6 +346,8 @@ int metal_io_block_read(struct metal_io_region *io, unsigned long offset,
 
 /**
  * @brief	Write a block into an I/O region.
+ *		Regions with a write accessor but no block operation
+ *		are accessed through the accessor, 32 bits at a time.
  * @param[in]	io	I/O region handle.
  * @param[in]	offset	Offset into I/O region.
  * @param[in]	src	source to write.
@@ -355,6 +359,8 @@ int metal_io_block_write(struct metal_io_region *io, unsigned long offset,
 
 /**
  * @brief	fill a block of an I/O region.
+ *		Regions with a write accessor but no block operation
+ *		are accessed through the accessor, 32 bits at a time.
  * @param[in]	io	I/O region handle.
  * @param[in]	offset	Offset into I/O region.
  * @param[in]	value	value to fill into the block
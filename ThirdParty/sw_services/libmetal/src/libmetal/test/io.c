@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026, Xilinx Inc. and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+
+#include "metal-test.h"
+#include <metal/io.h>
+#include <metal/log.h>
+#include <metal/sys.h>
+
+#define IO_TEST_SIZE	256
+#define IO_TEST_ALIGN	8
+
+static unsigned char io_mem[IO_TEST_SIZE]
+	__attribute__ ((aligned(IO_TEST_ALIGN)));
+static unsigned char io_buf[IO_TEST_SIZE + IO_TEST_ALIGN]
+	__attribute__ ((aligned(IO_TEST_ALIGN)));
+static unsigned char io_ref[IO_TEST_SIZE];
+static int io_bad_width;
+static int io_ops_calls;
+
+static uint64_t io_test_read(struct metal_io_region *io, unsigned long offset,
+			     memory_order order, int width)
+{
+	uint32_t val = 0;
+
+	(void)order;
+	io_ops_calls++;
+	if (width != 1 && (width != 4 || offset % 4))
+		io_bad_width++;
+	memcpy(&val, (unsigned char *)io->virt + offset, width);
+	return val;
+}
+
+static void io_test_write(struct metal_io_region *io, unsigned long offset,
+			  uint64_t value, memory_order order, int width)
+{
+	uint32_t val = (uint32_t)value;
+
+	(void)order;
+	io_ops_calls++;
+	if (width != 1 && (width != 4 || offset % 4))
+		io_bad_width++;
+	memcpy((unsigned char *)io->virt + offset, &val, width);
+}
+
+static void io_fill_pattern(unsigned char *buf, int len, int seed)
+{
+	int i;
+
+	for (i = 0; i < len; i++)
+		buf[i] = (unsigned char)(seed + i * 7);
+}
+
+/* Check block read, write and set for all sizes and alignments */
+static int io_check_blocks(struct metal_io_region *io)
+{
+	int ofs, al, len, ret;
+
+	for (ofs = 0; ofs < IO_TEST_ALIGN; ofs++) {
+		for (al = 0; al < IO_TEST_ALIGN; al++) {
+			for (len = 0; len <= IO_TEST_SIZE - IO_TEST_ALIGN;
+			     len += (len < 72 ? 1 : 61)) {
+				io_fill_pattern(io_ref, IO_TEST_SIZE, len);
+				memset(io_mem, 0xa5, IO_TEST_SIZE);
+				io_fill_pattern(io_buf + al, len, len);
+				ret = metal_io_block_write(io, ofs, io_buf + al,
+							   len);
+				if (ret != len ||
+				    memcmp(io_mem + ofs, io_ref, len) ||
+				    (ofs && io_mem[ofs - 1] != 0xa5) ||
+				    io_mem[ofs + len] != 0xa5) {
+					metal_log(METAL_LOG_DEBUG,
+						  "block write %d/%d/%d failed\n",
+						  ofs, al, len);
+					return -1;
+				}
+
+				memset(io_buf, 0, sizeof(io_buf));
+				ret = metal_io_block_read(io, ofs, io_buf + al,
+							  len);
+				if (ret != len || memcmp(io_buf + al, io_ref, len) ||
+				    io_buf[al + len] != 0) {
+					metal_log(METAL_LOG_DEBUG,
+						  "block read %d/%d/%d failed\n",
+						  ofs, al, len);
+					return -1;
+				}
+
+				memset(io_ref, 0x3c, len);
+				ret = metal_io_block_set(io, ofs, 0x3c, len);
+				if (ret != len || memcmp(io_mem + ofs, io_ref, len) ||
+				    io_mem[ofs + len] != 0xa5) {
+					metal_log(METAL_LOG_DEBUG,
+						  "block set %d/%d/%d failed\n",
+						  ofs, al, len);
+					return -1;
+				}
+			}
+		}
+	}
+
+	/* Blocks are clipped to the end of the region */
+	ret = metal_io_block_set(io, IO_TEST_SIZE - 3, 0, 16);
+	return ret == 3 ? 0 : -1;
+}
+
+static int io(void)
+{
+	struct metal_io_region io;
+	struct metal_io_ops ops;
+	metal_phys_addr_t phys = 0;
+	int error;
+
+	metal_io_init(&io, io_mem, &phys, IO_TEST_SIZE, -1, 0, NULL);
+	error = io_check_blocks(&io);
+	if (error)
+		return error;
+
+	/* Region with width restricted accessors and no block operations */
+	memset(&ops, 0, sizeof(ops));
+	ops.read = io_test_read;
+	ops.write = io_test_write;
+	io_bad_width = 0;
+	io_ops_calls = 0;
+	metal_io_init(&io, io_mem, &phys, IO_TEST_SIZE, -1, 0, &ops);
+	error = io_check_blocks(&io);
+	if (!error && (io_bad_width || !io_ops_calls)) {
+		metal_log(METAL_LOG_DEBUG, "accessors unused or %d of wrong width\n",
+			  io_bad_width);
+		error = -1;
+	}
+
+	return error;
+}
+METAL_ADD_TEST(io);
@@ -607,6 +607,19 @@ proc generate_lwip_opts {libhandle} {
 
 	# workaround for lwip mem_malloc bug
 	# puts $lwipopts_fd "\#define MEM_LIBC_MALLOC 1"
+
+	set use_object_pools [common::get_property CONFIG.use_object_pools $libhandle]
+	if {$use_object_pools == true} {
+		if {$api_mode != "SOCKET_API" || $processor_type == "microblaze"} {
+			error "ERROR: use_object_pools is only supported in socket mode on ARM processors" "" "mdt_error"
+		}
+		puts $lwipopts_fd "\#define LWIP_USE_OBJECT_POOLS 1"
+		puts $lwipopts_fd "\#define MEM_LIBC_MALLOC 1"
+		puts $lwipopts_fd "\#define MEMP_MEM_MALLOC 1"
+		puts $lwipopts_fd "\#define mem_clib_malloc sys_arch_pools_malloc"
+		puts $lwipopts_fd "\#define mem_clib_calloc sys_arch_pools_calloc"
+		puts $lwipopts_fd "\#define mem_clib_free sys_arch_pools_free"
+	}
 	puts $lwipopts_fd ""
 
 	# seq api
@@ -64,6 +64,14 @@ typedef unsigned long sys_prot_t;
 #define sys_mbox_set_invalid( x ) ( ( *x ) = NULL )
 #define sys_sem_valid( x ) ( ( ( *x ) == NULL) ? pdFALSE : pdTRUE )
 #define sys_sem_set_invalid( x ) ( ( *x ) = NULL )
+
+#if LWIP_USE_OBJECT_POOLS
+/* Allocator used as mem_clib_malloc/free/calloc, see sys_arch_pools.c */
+void sys_arch_pools_init(void);
+void *sys_arch_pools_malloc(size_t size);
+void *sys_arch_pools_calloc(size_t count, size_t size);
+void sys_arch_pools_free(void *mem);
+#endif /* LWIP_USE_OBJECT_POOLS */
 #endif /* !NO_SYS */
 
 #ifdef __cplusplus
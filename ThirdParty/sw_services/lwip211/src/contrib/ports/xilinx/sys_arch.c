@@ -557,6 +557,9 @@ void sys_sem_free( sys_sem_t *pxSemaphore )
  *---------------------------------------------------------------------------*/
 void sys_init(void)
 {
+#if LWIP_USE_OBJECT_POOLS
+	sys_arch_pools_init();
+#endif
 }
 
 u32_t sys_now(void)
@@ -0,0 +1,277 @@
+/*
+ * Copyright (C) 2026 Xilinx, Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote products
+ *    derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+ * SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT
+ * OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY
+ * OF SUCH DAMAGE.
+ *
+ * This file is part of the lwIP TCP/IP stack.
+ *
+ */
+
+/* sys_arch_pools.c -
+ *	backs mem_malloc() and memp_malloc() with FreeRTOS object pools
+ *
+ *	With LWIP_USE_OBJECT_POOLS, lwipopts.h sets MEMP_MEM_MALLOC and
+ *	MEM_LIBC_MALLOC and maps the C library allocator to the functions
+ *	below, so every lwIP allocation is served by an object pool free list
+ *	instead of taking the lwIP protection for the memp free lists.
+ *
+ *	There is one size class for each distinct element size of the memp
+ *	pools, holding the elements of all the pools of that size as set by
+ *	the MEMP_NUM_xxx and PBUF_POOL_SIZE options. MEM_SIZE, which backs the
+ *	PBUF_RAM pbufs, is split into a class for header only pbufs, one per
+ *	MEMP_NUM_TCP_SEG, and a class for pbufs of a full TCP_MSS segment which
+ *	gets the rest. Class sizes are only rounded up to MEM_ALIGNMENT. The
+ *	storage is taken from the FreeRTOS heap by sys_init().
+ *
+ *	A request larger than the largest class, such as a PBUF_RAM pbuf
+ *	above TCP_MSS, is served by the FreeRTOS heap. The heap is not
+ *	interrupt safe, so such blocks must be allocated and freed from tasks
+ *	only.
+ *
+ *	The pools mask interrupts only up to configMAX_API_CALL_INTERRUPT_PRIORITY,
+ *	so, as for the rest of lwIP, interrupts of a higher priority must not
+ *	allocate or free lwIP memory.
+ */
+
+#include "lwipopts.h"
+
+#if !NO_SYS && LWIP_USE_OBJECT_POOLS
+
+#include <string.h>
+
+#include "arch/sys_arch.h"
+#include "object_pool.h"
+
+#include "lwip/opt.h"
+#include "lwip/def.h"
+#include "lwip/mem.h"
+#include "lwip/memp.h"
+#include "lwip/sys.h"
+
+/* Everything needed for the size calculation of memp_std.h, as in memp.c */
+#include "lwip/pbuf.h"
+#include "lwip/raw.h"
+#include "lwip/udp.h"
+#include "lwip/tcp.h"
+#include "lwip/priv/tcp_priv.h"
+#include "lwip/altcp.h"
+#include "lwip/ip4_frag.h"
+#include "lwip/netbuf.h"
+#include "lwip/api.h"
+#include "lwip/priv/tcpip_priv.h"
+#include "lwip/priv/api_msg.h"
+#include "lwip/priv/sockets_priv.h"
+#include "lwip/etharp.h"
+#include "lwip/igmp.h"
+#include "lwip/timeouts.h"
+#include "netif/ppp/ppp_opts.h"
+#include "lwip/netdb.h"
+#include "lwip/dns.h"
+#include "lwip/priv/nd6_priv.h"
+#include "lwip/ip6_frag.h"
+#include "lwip/mld6.h"
+
+#if MEM_ALIGNMENT % portBYTE_ALIGNMENT
+#error "lwIP object pools require MEM_ALIGNMENT to be a multiple of portBYTE_ALIGNMENT"
+#endif
+
+/* mem_malloc() stores the size in front of the block for the statistics */
+#if LWIP_STATS && MEM_STATS
+#define SYS_POOL_STATS_SIZE	LWIP_MEM_ALIGN_SIZE(sizeof(mem_size_t))
+#else
+#define SYS_POOL_STATS_SIZE	0
+#endif
+
+/* Size of a memp element, as requested by memp_malloc() */
+#define SYS_POOL_MEMP_SIZE(size)	\
+	(SYS_POOL_STATS_SIZE + MEMP_SIZE + MEMP_ALIGN_SIZE(size))
+
+/* Size of a PBUF_RAM pbuf, as requested by pbuf_alloc() */
+#define SYS_POOL_PBUF_SIZE(offset, length)				\
+	(SYS_POOL_STATS_SIZE + LWIP_MEM_ALIGN_SIZE(sizeof(struct pbuf)) +	\
+	 LWIP_MEM_ALIGN_SIZE(offset) + LWIP_MEM_ALIGN_SIZE(length))
+
+/* Headers in front of the TCP header, and the largest TCP header */
+#define SYS_POOL_HDR_OFFSET	(PBUF_LINK_ENCAPSULATION_HLEN + PBUF_LINK_HLEN + PBUF_IP_HLEN)
+#define SYS_POOL_TCP_HLEN	(TCP_HLEN + 40)
+
+/* The memp classes, and two classes carved out of MEM_SIZE */
+#define SYS_POOL_CLASSES	(MEMP_MAX + 2)
+
+struct sys_pool_usage {
+	u32_t size;
+	u32_t num;
+};
+
+/* Element size and count of each memp pool */
+static const struct sys_pool_usage sys_memp_usage[] = {
+#define LWIP_MEMPOOL(name,num,size,desc) { SYS_POOL_MEMP_SIZE(size), (num) },
+#include "lwip/priv/memp_std.h"
+};
+
+/* Classes in increasing size */
+static struct sys_pool_usage sys_pool_class[SYS_POOL_CLASSES];
+static int sys_pool_num_classes;
+
+static ObjectPool_t sys_pools[SYS_POOL_CLASSES];
+static u8_t *sys_pool_base[SYS_POOL_CLASSES];
+static u8_t *sys_pool_end[SYS_POOL_CLASSES];
+
+/*---------------------------------------------------------------------------*
+ * Routine:  sys_arch_pools_add
+ *---------------------------------------------------------------------------*
+ * Description:
+ *      Adds num objects of size bytes to the class of that size, creating
+ *      the class if needed
+ *---------------------------------------------------------------------------*/
+static void sys_arch_pools_add(u32_t size, u32_t num)
+{
+	int c, i;
+
+	if (num == 0)
+		return;
+
+	size = LWIP_MEM_ALIGN_SIZE(size);
+	for (c = 0; c < sys_pool_num_classes; c++) {
+		if (sys_pool_class[c].size == size) {
+			sys_pool_class[c].num += num;
+			return;
+		}
+		if (sys_pool_class[c].size > size)
+			break;
+	}
+
+	for (i = sys_pool_num_classes; i > c; i--)
+		sys_pool_class[i] = sys_pool_class[i - 1];
+	sys_pool_class[c].size = size;
+	sys_pool_class[c].num = num;
+	sys_pool_num_classes++;
+}
+
+/*---------------------------------------------------------------------------*
+ * Routine:  sys_arch_pools_init
+ *---------------------------------------------------------------------------*
+ * Description:
+ *      Sizes the classes and allocates their storage from the FreeRTOS heap
+ *---------------------------------------------------------------------------*/
+void sys_arch_pools_init(void)
+{
+	u32_t hdr_size, seg_size, hdr_num, mem_left;
+	size_t size;
+	u8_t *storage;
+	u32_t i;
+	int c;
+
+	for (i = 0; i < LWIP_ARRAYSIZE(sys_memp_usage); i++)
+		sys_arch_pools_add(sys_memp_usage[i].size, sys_memp_usage[i].num);
+
+	/* MEM_SIZE: header pbufs of the queued TCP segments, capped at a
+	 * quarter of MEM_SIZE, then full segments */
+	hdr_size = LWIP_MEM_ALIGN_SIZE(SYS_POOL_PBUF_SIZE(SYS_POOL_HDR_OFFSET,
+							  SYS_POOL_TCP_HLEN));
+	seg_size = LWIP_MEM_ALIGN_SIZE(SYS_POOL_PBUF_SIZE(SYS_POOL_HDR_OFFSET +
+							  SYS_POOL_TCP_HLEN,
+							  TCP_MSS));
+	hdr_num = LWIP_MIN((u32_t)MEMP_NUM_TCP_SEG, (MEM_SIZE / 4) / hdr_size);
+	mem_left = MEM_SIZE - hdr_num * hdr_size;
+	sys_arch_pools_add(hdr_size, hdr_num);
+	sys_arch_pools_add(seg_size, mem_left / seg_size);
+
+	for (c = 0; c < sys_pool_num_classes; c++) {
+		size = poolSTORAGE_SIZE(sys_pool_class[c].size,
+					sys_pool_class[c].num);
+		storage = pvPortMalloc(size + MEM_ALIGNMENT);
+		LWIP_ASSERT("no FreeRTOS heap for the lwIP object pools",
+			    storage != NULL);
+		if (storage == NULL)
+			continue;
+		storage = (u8_t *)LWIP_MEM_ALIGN(storage);
+		vObjectPoolInitialise(&sys_pools[c], storage,
+				      sys_pool_class[c].size,
+				      sys_pool_class[c].num);
+		sys_pool_base[c] = storage;
+		sys_pool_end[c] = storage + size;
+	}
+}
+
+/*---------------------------------------------------------------------------*
+ * Routine:  sys_arch_pools_malloc
+ *---------------------------------------------------------------------------*
+ * Description:
+ *      Allocates from the smallest class that fits and has a free object.
+ *      A request larger than every class is allocated from the FreeRTOS
+ *      heap. A request that fits a class but finds all the fitting classes
+ *      empty fails, so the pools bound the memory used by lwIP in
+ *      interrupt context.
+ *---------------------------------------------------------------------------*/
+void *sys_arch_pools_malloc(size_t size)
+{
+	void *mem;
+	int c;
+
+	if (sys_pool_num_classes == 0 ||
+	    size > sys_pool_class[sys_pool_num_classes - 1].size)
+		return pvPortMalloc(size);
+
+	for (c = 0; c < sys_pool_num_classes; c++) {
+		if (size > sys_pool_class[c].size || sys_pool_base[c] == NULL)
+			continue;
+		mem = pvObjectPoolAlloc(&sys_pools[c]);
+		if (mem != NULL)
+			return mem;
+	}
+
+	return NULL;
+}
+
+void *sys_arch_pools_calloc(size_t count, size_t size)
+{
+	void *mem;
+
+	if (size && count > (size_t)-1 / size)
+		return NULL;
+	mem = sys_arch_pools_malloc(count * size);
+	if (mem != NULL)
+		memset(mem, 0, count * size);
+
+	return mem;
+}
+
+void sys_arch_pools_free(void *mem)
+{
+	int c;
+
+	for (c = 0; c < sys_pool_num_classes; c++) {
+		if ((u8_t *)mem >= sys_pool_base[c] &&
+		    (u8_t *)mem < sys_pool_end[c]) {
+			vObjectPoolFree(&sys_pools[c], mem);
+			return;
+		}
+	}
+
+	/* Larger than every class, see sys_arch_pools_malloc() */
+	vPortFree(mem);
+}
+
+#endif /* !NO_SYS && LWIP_USE_OBJECT_POOLS */
@@ -34,6 +34,15 @@ extern "C" {
 
 /* Loader feature macros */
 #define SUPPORT_SEEK 1UL
+/* Image data is accessed in place, loading it to RPROC_LOAD_ANYADDR does
+ * not copy it. Segments already present in target memory are not reloaded.
+ */
+#define SUPPORT_DIRECT_ACCESS 2UL
+
+/* Chunk size used to compare a segment against its target memory */
+#ifndef RPROC_LOAD_CMP_SIZE
+#define RPROC_LOAD_CMP_SIZE 256
+#endif
 
 /* Remoteproc loader any address */
 #define RPROC_LOAD_ANYADDR ((metal_phys_addr_t)-1)
@@ -62,6 +71,12 @@ extern "C" {
  * @load: user defined callback to load the firmware contents to target
  *        memory or local memory
  * @features: loader supported features. e.g. seek
+ * @wait: optional callback to wait for the completion of all the loads
+ *        started without blocking. If it is set, segment data is loaded to
+ *        target memory with is_blocking cleared, the load callback returns
+ *        once the copy is started and the copies run in parallel with the
+ *        rest of the loading. It returns 0 on success, negative value if a
+ *        copy failed.
  */
 struct image_store_ops {
 	int (*open)(void *store, const char *path, const void **img_data);
@@ -71,6 +86,7 @@ struct image_store_ops {
 		    metal_phys_addr_t pa,
 		    struct metal_io_region *io, char is_blocking);
 	unsigned int features;
+	int (*wait)(void *store);
 };
 
 /**
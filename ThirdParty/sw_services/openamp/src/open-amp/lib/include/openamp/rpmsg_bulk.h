@@ -0,0 +1,195 @@
+/*
+ * RPMsg bulk transfer channel
+ *
+ * Copyright (c) 2026 Xilinx, Inc.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _RPMSG_BULK_H_
+#define _RPMSG_BULK_H_
+
+#include <metal/io.h>
+#include <metal/mutex.h>
+#include <openamp/rpmsg.h>
+#include <stdint.h>
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+/* Default allocation granularity of the bulk TX pool */
+#define RPMSG_BULK_CHUNK_SIZE	(1024)
+
+/* Bulk control message types */
+#define RPMSG_BULK_DATA		0x1UL /* payload available at offset */
+#define RPMSG_BULK_RELEASE	0x2UL /* payload at offset can be reused */
+
+struct rpmsg_bulk_ept;
+
+typedef int (*rpmsg_bulk_cb)(struct rpmsg_bulk_ept *bept, void *data,
+			     size_t len, void *priv);
+
+/**
+ * struct rpmsg_bulk_msg - bulk control message
+ * @type: RPMSG_BULK_DATA or RPMSG_BULK_RELEASE
+ * @offset: offset of the payload in the shared memory I/O region
+ * @len: length of the payload
+ *
+ * Sent over the RPMsg endpoint of the bulk channel, the payload itself
+ * stays in shared memory.
+ */
+METAL_PACKED_BEGIN
+struct rpmsg_bulk_msg {
+	uint32_t type;
+	uint32_t offset;
+	uint32_t len;
+} METAL_PACKED_END;
+
+/**
+ * struct rpmsg_bulk_pool - variable size TX buffer pool in shared memory
+ * @base: base address of the pool
+ * @chunk_size: allocation granularity
+ * @num_chunks: number of chunks in the pool
+ * @chunks: per chunk allocation and ownership state, kept in local memory
+ * @lock: protects @chunks
+ */
+struct rpmsg_bulk_pool {
+	void *base;
+	size_t chunk_size;
+	unsigned int num_chunks;
+	uint32_t *chunks;
+	metal_mutex_t lock;
+};
+
+/**
+ * struct rpmsg_bulk_ept - RPMsg bulk transfer endpoint
+ * @ept: RPMsg endpoint used for the control messages
+ * @io: shared memory I/O region holding the payloads of both sides
+ * @pool: local TX pool, payloads sent by this side are allocated from it
+ * @cb: receive callback
+ * @priv: private data passed to @cb
+ * @rx_held: payload held by @cb while it runs
+ */
+struct rpmsg_bulk_ept {
+	struct rpmsg_endpoint ept;
+	struct metal_io_region *io;
+	struct rpmsg_bulk_pool pool;
+	rpmsg_bulk_cb cb;
+	void *priv;
+	void *rx_held;
+};
+
+/**
+ * rpmsg_bulk_create_ept - create RPMsg bulk transfer endpoint
+ *
+ * Creates the RPMsg endpoint used for the control messages and the TX
+ * pool of this side. Both sides must access the shared memory through
+ * I/O regions starting at the same physical address, as payloads are
+ * described by their offset in the region.
+ *
+ * @param bept - pointer to the bulk endpoint
+ * @param rdev - pointer to the rpmsg device
+ * @param name - name of the endpoint
+ * @param src - local address of the endpoint
+ * @param dest - remote address of the endpoint
+ * @param io - shared memory I/O region
+ * @param pool - start of the TX pool, must be inside @io
+ * @param pool_size - size of the TX pool
+ * @param chunk_size - allocation granularity, 0 for RPMSG_BULK_CHUNK_SIZE
+ * @param cb - receive callback
+ * @param priv - private data passed to @cb
+ * @param unbind_cb - name service unbind callback
+ *
+ * @return - RPMSG_SUCCESS on success, negative value for failure
+ */
+int rpmsg_bulk_create_ept(struct rpmsg_bulk_ept *bept,
+			  struct rpmsg_device *rdev, const char *name,
+			  uint32_t src, uint32_t dest,
+			  struct metal_io_region *io,
+			  void *pool, size_t pool_size, size_t chunk_size,
+			  rpmsg_bulk_cb cb, void *priv,
+			  rpmsg_ns_unbind_cb unbind_cb);
+
+/**
+ * rpmsg_bulk_destroy_ept - destroy RPMsg bulk transfer endpoint
+ *
+ * @param bept - pointer to the bulk endpoint
+ */
+void rpmsg_bulk_destroy_ept(struct rpmsg_bulk_ept *bept);
+
+/**
+ * rpmsg_bulk_get_tx_buffer - allocate a buffer from the TX pool
+ *
+ * The buffer is filled by the caller and handed to the remote side with
+ * rpmsg_bulk_send_nocopy(). It returns to the pool once the remote side
+ * releases it, or with rpmsg_bulk_release_tx_buffer() if it is not sent.
+ *
+ * @param bept - pointer to the bulk endpoint
+ * @param len - requested buffer size
+ *
+ * @return - buffer pointer, NULL if no large enough buffer is free
+ */
+void *rpmsg_bulk_get_tx_buffer(struct rpmsg_bulk_ept *bept, size_t len);
+
+/**
+ * rpmsg_bulk_release_tx_buffer - return an unsent buffer to the TX pool
+ *
+ * @param bept - pointer to the bulk endpoint
+ * @param txbuf - buffer returned by rpmsg_bulk_get_tx_buffer()
+ */
+void rpmsg_bulk_release_tx_buffer(struct rpmsg_bulk_ept *bept, void *txbuf);
+
+/**
+ * rpmsg_bulk_send_nocopy - send a TX pool buffer without copying it
+ *
+ * @param bept - pointer to the bulk endpoint
+ * @param txbuf - buffer returned by rpmsg_bulk_get_tx_buffer()
+ * @param len - length of the payload in @txbuf
+ *
+ * @return - length sent, negative value for failure. On failure the
+ *           buffer is still owned by the caller.
+ */
+int rpmsg_bulk_send_nocopy(struct rpmsg_bulk_ept *bept, void *txbuf,
+			   size_t len);
+
+/**
+ * rpmsg_bulk_send - copy data into the TX pool and send it
+ *
+ * @param bept - pointer to the bulk endpoint
+ * @param data - payload to send
+ * @param len - length of the payload
+ *
+ * @return - length sent, negative value for failure
+ */
+int rpmsg_bulk_send(struct rpmsg_bulk_ept *bept, const void *data,
+		    size_t len);
+
+/**
+ * rpmsg_bulk_hold_rx_buffer - keep a received payload after the callback
+ *
+ * Called from the receive callback, the payload stays valid until it is
+ * released with rpmsg_bulk_release_rx_buffer(). Payloads which are not
+ * held are released when the callback returns.
+ *
+ * @param bept - pointer to the bulk endpoint
+ * @param rxbuf - payload passed to the receive callback
+ */
+void rpmsg_bulk_hold_rx_buffer(struct rpmsg_bulk_ept *bept, void *rxbuf);
+
+/**
+ * rpmsg_bulk_release_rx_buffer - release a held payload to the remote side
+ *
+ * @param bept - pointer to the bulk endpoint
+ * @param rxbuf - payload held with rpmsg_bulk_hold_rx_buffer()
+ *
+ * @return - RPMSG_SUCCESS on success, negative value for failure
+ */
+int rpmsg_bulk_release_rx_buffer(struct rpmsg_bulk_ept *bept, void *rxbuf);
+
+#if defined __cplusplus
+}
+#endif
+
+#endif /* _RPMSG_BULK_H_ */
@@ -26,6 +26,11 @@ extern "C" {
 #define RPMSG_BUFFER_SIZE	(512)
 #endif
 
+/* Upper bound of the busy wait between two polls, in CPU yields */
+#ifndef RPMSG_POLL_BACKOFF_MAX
+#define RPMSG_POLL_BACKOFF_MAX	(1024)
+#endif
+
 /* The feature bitmap for virtio rpmsg */
 #define VIRTIO_RPMSG_F_NS	0 /* RP supports name service notifications */
 
@@ -49,6 +54,7 @@ struct rpmsg_virtio_shm_pool {
  * @svq: pointer to send virtqueue
  * @shbuf_io: pointer to the shared buffer I/O region
  * @shpool: pointer to the shared buffers pool
+ * @poll_mode: receive virtqueue is polled instead of notified
  */
 struct rpmsg_virtio_device {
 	struct rpmsg_device rdev;
@@ -57,6 +63,7 @@ struct rpmsg_virtio_device {
 	struct virtqueue *svq;
 	struct metal_io_region *shbuf_io;
 	struct rpmsg_virtio_shm_pool *shpool;
+	int poll_mode;
 };
 
 #define RPMSG_REMOTE	VIRTIO_DEV_SLAVE
@@ -109,6 +116,16 @@ rpmsg_virtio_create_virtqueues(struct rpmsg_virtio_device *rvdev,
 					callbacks);
 }
 
+/**
+ * struct rpmsg_virtio_msg - message descriptor for batched send
+ * @data: payload of the message
+ * @len: length of the payload
+ */
+struct rpmsg_virtio_msg {
+	const void *data;
+	int len;
+};
+
 /**
  * rpmsg_virtio_get_buffer_size - get rpmsg virtio buffer size
  *
@@ -118,6 +135,63 @@ rpmsg_virtio_create_virtqueues(struct rpmsg_virtio_device *rvdev,
  */
 int rpmsg_virtio_get_buffer_size(struct rpmsg_device *rdev);
 
+/**
+ * rpmsg_virtio_send_batch - send several messages with one notification
+ *
+ * Copies each message into its own TX buffer and places all of them on the
+ * send virtqueue before notifying the remote side once. If TX buffers run
+ * out and @wait is set, the messages queued so far are notified first and
+ * then the function waits for a free buffer, like rpmsg_send().
+ * Payloads larger than the buffer size are truncated, like rpmsg_send().
+ * All messages are checked before any is queued, so an invalid entry fails
+ * the whole batch with RPMSG_ERR_PARAM.
+ *
+ * @param ept  - the rpmsg endpoint
+ * @param dst  - destination address
+ * @param msgs - array of messages to send
+ * @param num  - number of messages in @msgs
+ * @param wait - boolean, wait or not for buffers to become available
+ *
+ * @return - number of messages sent, negative value for failure
+ */
+int rpmsg_virtio_send_batch(struct rpmsg_endpoint *ept, uint32_t dst,
+			    const struct rpmsg_virtio_msg *msgs, int num,
+			    int wait);
+
+/**
+ * rpmsg_virtio_set_poll_mode - switch between interrupt and poll mode
+ *
+ * In poll mode the remote side is asked not to notify new messages on the
+ * receive virtqueue, and messages are only delivered by
+ * rpmsg_virtio_poll(). When switching back to interrupt mode, messages
+ * which arrived in the meantime are delivered before returning.
+ * The mode can be switched at any time.
+ *
+ * @param rvdev  - pointer to the rpmsg virtio device
+ * @param enable - boolean, enable or disable poll mode
+ *
+ * @return - RPMSG_SUCCESS on success, negative value for failure
+ */
+int rpmsg_virtio_set_poll_mode(struct rpmsg_virtio_device *rvdev, int enable);
+
+/**
+ * rpmsg_virtio_poll - busy poll the receive virtqueue
+ *
+ * Checks the ring index of the receive virtqueue, with an exponential
+ * backoff between checks capped to RPMSG_POLL_BACKOFF_MAX CPU yields,
+ * and delivers all pending messages to their endpoints once something
+ * arrives.
+ *
+ * @param rvdev   - pointer to the rpmsg virtio device
+ * @param timeout - number of CPU yields to poll for before giving up,
+ *                  0 to check only once
+ *
+ * @return - 1 if messages were delivered, 0 on timeout, negative value
+ *           for failure
+ */
+int rpmsg_virtio_poll(struct rpmsg_virtio_device *rvdev,
+		      unsigned int timeout);
+
 /**
  * rpmsg_init_vdev - initialize rpmsg virtio device
  * Master side:
@@ -221,6 +221,8 @@ void virtqueue_notification(struct virtqueue *vq);
 
 uint32_t virtqueue_get_desc_size(struct virtqueue *vq);
 
+int virtqueue_get_pending(struct virtqueue *vq);
+
 uint32_t virtqueue_get_buffer_length(struct virtqueue *vq, uint16_t idx);
 
 #if defined __cplusplus
@@ -137,6 +137,53 @@ error:
 	return rsc_table;
 }
 
+/**
+ * remoteproc_segment_unchanged
+ *
+ * Check if the target memory already holds the data of a segment, so that
+ * reloading the same image does not copy it again. The segment is compared
+ * in place, which needs an image store with direct access to the image.
+ *
+ * @param store - image store
+ * @param store_ops - image store operations
+ * @param io - I/O region of the segment target memory
+ * @param pa - physical address of the segment
+ * @param offset - offset of the segment data in the image
+ * @param len - length of the segment data
+ *
+ * @return - 1 if the target memory holds the segment data, 0 otherwise
+ */
+static int remoteproc_segment_unchanged(void *store,
+					struct image_store_ops *store_ops,
+					struct metal_io_region *io,
+					metal_phys_addr_t pa,
+					size_t offset, size_t len)
+{
+	unsigned char buf[RPROC_LOAD_CMP_SIZE];
+	const void *img_data = NULL;
+	const unsigned char *data;
+	unsigned long io_offset;
+	size_t n;
+	int ret;
+
+	if ((store_ops->features & SUPPORT_DIRECT_ACCESS) == 0)
+		return 0;
+	ret = store_ops->load(store, offset, len, &img_data,
+			      RPROC_LOAD_ANYADDR, NULL, 1);
+	if (ret != (int)len || !img_data)
+		return 0;
+	io_offset = metal_io_phys_to_offset(io, pa);
+	if (io_offset == METAL_BAD_OFFSET)
+		return 0;
+	for (data = img_data; len; data += n, io_offset += n, len -= n) {
+		n = len < sizeof(buf) ? len : sizeof(buf);
+		ret = metal_io_block_read(io, io_offset, buf, n);
+		if (ret != (int)n || memcmp(buf, data, n))
+			return 0;
+	}
+	return 1;
+}
+
 static int remoteproc_parse_rsc_table(struct remoteproc *rproc,
 				      struct resource_table *rsc_table,
 				      size_t rsc_size)
@@ -406,6 +453,8 @@ int remoteproc_load(struct remoteproc *rproc, const char *path,
 	size_t rsc_size = 0;
 	void *rsc_table = NULL;
 	struct metal_io_region *io = NULL;
+	char is_blocking;
+	int pending = 0;
 
 	if (!rproc)
 		return -RPROC_ENODEV;
@@ -512,6 +561,11 @@ int remoteproc_load(struct remoteproc *rproc, const char *path,
 
 	/* load executable data */
 	metal_log(METAL_LOG_DEBUG, "%s: load executable data\r\n", __func__);
+	/*
+	 * With a wait operation, segment copies are only queued here, so that
+	 * they run while the following segments are parsed and zero filled.
+	 */
+	is_blocking = store_ops->wait ? 0 : 1;
 	offset = 0;
 	len = 0;
 	while (1) {
@@ -550,9 +604,15 @@ int remoteproc_load(struct remoteproc *rproc, const char *path,
 				ret = -RPROC_EINVAL;
 				goto error3;
 			}
-			if (nlen > 0) {
+			if (nlen > 0 &&
+			    remoteproc_segment_unchanged(store, store_ops, io,
+							 pa, noffset, nlen)) {
+				metal_log(METAL_LOG_DEBUG,
+					  "load data: 0x%lx unchanged\r\n", pa);
+			} else if (nlen > 0) {
 				ret = store_ops->load(store, noffset, nlen,
-						      &img_data, pa, io, 1);
+						      &img_data, pa, io,
+						      is_blocking);
 				if (ret != (int)nlen) {
 					metal_log(METAL_LOG_ERROR,
 						  "load data failed 0x%lx, 0x%lx, 0x%x\r\n",
@@ -560,6 +620,7 @@ int remoteproc_load(struct remoteproc *rproc, const char *path,
 					ret = -RPROC_EINVAL;
 					goto error3;
 				}
+				pending |= !is_blocking;
 			}
 			if (nmemsize > nlen) {
 				size_t tmpoffset;
@@ -594,6 +655,17 @@ int remoteproc_load(struct remoteproc *rproc, const char *path,
 		}
 	}
 
+	/* The resource table update below may overlap a queued copy */
+	if (pending) {
+		pending = 0;
+		ret = store_ops->wait(store);
+		if (ret < 0) {
+			metal_log(METAL_LOG_ERROR,
+				  "load failed: segment copy error %d\r\n", ret);
+			goto error3;
+		}
+	}
+
 	if (rsc_size == 0) {
 		ret = loader->locate_rsc_table(limg_info, &rsc_da,
 					       &offset, &rsc_size);
@@ -652,6 +724,8 @@ int remoteproc_load(struct remoteproc *rproc, const char *path,
 	return 0;
 
 error3:
+	if (pending)
+		(void)store_ops->wait(store);
 	if (rsc_table)
 		metal_free_memory(rsc_table);
 error2:
@@ -0,0 +1,365 @@
+/*
+ * RPMsg bulk transfer channel
+ *
+ * Copyright (c) 2026 Xilinx, Inc.
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <metal/alloc.h>
+#include <metal/cache.h>
+#include <metal/log.h>
+#include <metal/utilities.h>
+#include <openamp/rpmsg_bulk.h>
+#include <string.h>
+
+#include "rpmsg_internal.h"
+
+/*
+ * The first chunk of an allocation holds its number of chunks, and the
+ * RPMSG_BULK_CHUNK_SENT flag while the remote side owns the payload.
+ */
+#define RPMSG_BULK_CHUNK_SENT	0x80000000UL
+#define RPMSG_BULK_CHUNK_NUM	0x7FFFFFFFUL
+/* Chunk state of an allocation, other than its first chunk */
+#define RPMSG_BULK_CHUNK_CONT	0xFFFFFFFFUL
+
+/**
+ * rpmsg_bulk_chunk_index - get the pool chunk index of a buffer
+ *
+ * @param pool - pointer to the TX pool
+ * @param buf - buffer pointer
+ *
+ * @return - chunk index, -1 if @buf does not start an allocation
+ */
+static int rpmsg_bulk_chunk_index(struct rpmsg_bulk_pool *pool, void *buf)
+{
+	uintptr_t off = (uintptr_t)buf - (uintptr_t)pool->base;
+	unsigned int idx;
+	uint32_t state;
+
+	if ((uintptr_t)buf < (uintptr_t)pool->base ||
+	    off % pool->chunk_size)
+		return -1;
+	idx = off / pool->chunk_size;
+	if (idx >= pool->num_chunks)
+		return -1;
+	state = pool->chunks[idx];
+	if (!state || state == RPMSG_BULK_CHUNK_CONT)
+		return -1;
+
+	return (int)idx;
+}
+
+/**
+ * rpmsg_bulk_pool_alloc - first fit allocation of contiguous chunks
+ *
+ * Allocations are tracked in the local chunk table only, nothing is
+ * written to the shared memory.
+ */
+static void *rpmsg_bulk_pool_alloc(struct rpmsg_bulk_pool *pool, size_t len)
+{
+	unsigned int need, i, j;
+	void *buf = NULL;
+
+	if (!len || len > pool->chunk_size * pool->num_chunks)
+		return NULL;
+	need = (len + pool->chunk_size - 1) / pool->chunk_size;
+
+	metal_mutex_acquire(&pool->lock);
+	i = 0;
+	while (i + need <= pool->num_chunks) {
+		if (pool->chunks[i]) {
+			/* Skip the whole allocation */
+			i += pool->chunks[i] & RPMSG_BULK_CHUNK_NUM;
+			continue;
+		}
+		for (j = i; j < i + need && !pool->chunks[j]; j++)
+			;
+		if (j == i + need) {
+			pool->chunks[i] = need;
+			for (j = i + 1; j < i + need; j++)
+				pool->chunks[j] = RPMSG_BULK_CHUNK_CONT;
+			buf = (char *)pool->base + i * pool->chunk_size;
+			break;
+		}
+		i = j;
+	}
+	metal_mutex_release(&pool->lock);
+
+	return buf;
+}
+
+/**
+ * rpmsg_bulk_pool_free - free an allocation
+ *
+ * @param pool - pointer to the TX pool
+ * @param buf - buffer pointer
+ * @param sent - true if the remote side has to own the buffer, false if
+ *               the local side has to own it
+ *
+ * @return - RPMSG_SUCCESS on success, RPMSG_ERR_PARAM if @buf is not an
+ *           allocation owned as given by @sent
+ */
+static int rpmsg_bulk_pool_free(struct rpmsg_bulk_pool *pool, void *buf,
+				bool sent)
+{
+	unsigned int i, num;
+	int idx;
+
+	metal_mutex_acquire(&pool->lock);
+	idx = rpmsg_bulk_chunk_index(pool, buf);
+	if (idx < 0 ||
+	    !(pool->chunks[idx] & RPMSG_BULK_CHUNK_SENT) != !sent) {
+		metal_mutex_release(&pool->lock);
+		return RPMSG_ERR_PARAM;
+	}
+	num = pool->chunks[idx] & RPMSG_BULK_CHUNK_NUM;
+	for (i = 0; i < num; i++)
+		pool->chunks[idx + i] = 0;
+	metal_mutex_release(&pool->lock);
+
+	return RPMSG_SUCCESS;
+}
+
+static int rpmsg_bulk_send_ctrl(struct rpmsg_bulk_ept *bept, uint32_t type,
+				unsigned long offset, size_t len)
+{
+	struct rpmsg_bulk_msg msg;
+	int ret;
+
+	msg.type = type;
+	msg.offset = (uint32_t)offset;
+	msg.len = (uint32_t)len;
+	ret = rpmsg_send(&bept->ept, &msg, sizeof(msg));
+
+	return ret < 0 ? ret : RPMSG_SUCCESS;
+}
+
+/*
+ * Descriptors come from the remote side, a bad one is logged and dropped.
+ * Errors are not returned as the RPMsg layer treats them as fatal.
+ */
+static int rpmsg_bulk_ept_cb(struct rpmsg_endpoint *ept, void *data,
+			     size_t len, uint32_t src, void *priv)
+{
+	struct rpmsg_bulk_ept *bept;
+	struct rpmsg_bulk_msg msg;
+	void *buf;
+	int ret;
+
+	(void)src;
+	(void)priv;
+
+	bept = metal_container_of(ept, struct rpmsg_bulk_ept, ept);
+	if (len < sizeof(msg)) {
+		metal_log(METAL_LOG_ERROR, "rpmsg_bulk: short message\r\n");
+		return RPMSG_SUCCESS;
+	}
+	memcpy(&msg, data, sizeof(msg));
+
+	buf = metal_io_virt(bept->io, msg.offset);
+	if (!buf || msg.len > metal_io_region_size(bept->io) - msg.offset) {
+		metal_log(METAL_LOG_ERROR,
+			  "rpmsg_bulk: descriptor out of range\r\n");
+		return RPMSG_SUCCESS;
+	}
+
+	switch (msg.type) {
+	case RPMSG_BULK_DATA:
+#ifdef VIRTIO_CACHED_BUFFERS
+		metal_cache_invalidate(buf, msg.len);
+#endif /* VIRTIO_CACHED_BUFFERS */
+		bept->rx_held = NULL;
+		if (bept->cb) {
+			ret = bept->cb(bept, buf, msg.len, bept->priv);
+			if (ret < 0)
+				metal_log(METAL_LOG_WARNING,
+					  "rpmsg_bulk: callback failed %d\r\n",
+					  ret);
+		}
+		if (bept->rx_held != buf)
+			(void)rpmsg_bulk_send_ctrl(bept, RPMSG_BULK_RELEASE,
+						   msg.offset, 0);
+		bept->rx_held = NULL;
+		break;
+	case RPMSG_BULK_RELEASE:
+		/* Only payloads sent to the remote side can be released */
+		ret = rpmsg_bulk_pool_free(&bept->pool, buf, true);
+		if (ret < 0)
+			metal_log(METAL_LOG_ERROR,
+				  "rpmsg_bulk: release of unsent payload\r\n");
+		break;
+	default:
+		metal_log(METAL_LOG_ERROR,
+			  "rpmsg_bulk: unknown message type %u\r\n",
+			  (unsigned int)msg.type);
+		break;
+	}
+
+	return RPMSG_SUCCESS;
+}
+
+int rpmsg_bulk_create_ept(struct rpmsg_bulk_ept *bept,
+			  struct rpmsg_device *rdev, const char *name,
+			  uint32_t src, uint32_t dest,
+			  struct metal_io_region *io,
+			  void *pool, size_t pool_size, size_t chunk_size,
+			  rpmsg_bulk_cb cb, void *priv,
+			  rpmsg_ns_unbind_cb unbind_cb)
+{
+	struct rpmsg_bulk_pool *bpool;
+	unsigned long offset;
+	size_t tsize;
+	int ret;
+
+	if (!bept || !io || !pool)
+		return RPMSG_ERR_PARAM;
+	if (!chunk_size)
+		chunk_size = RPMSG_BULK_CHUNK_SIZE;
+
+	/* Offsets and lengths are carried as 32 bits in the descriptors */
+	offset = metal_io_virt_to_offset(io, pool);
+	if (offset == METAL_BAD_OFFSET ||
+	    pool_size > metal_io_region_size(io) - offset ||
+	    offset + pool_size > UINT32_MAX)
+		return RPMSG_ERR_PARAM;
+
+	bpool = &bept->pool;
+	bpool->base = pool;
+	bpool->chunk_size = chunk_size;
+	bpool->num_chunks = pool_size / chunk_size;
+	if (!bpool->num_chunks)
+		return RPMSG_ERR_PARAM;
+	tsize = bpool->num_chunks * sizeof(*bpool->chunks);
+	bpool->chunks = metal_allocate_memory(tsize);
+	if (!bpool->chunks)
+		return RPMSG_ERR_NO_MEM;
+	memset(bpool->chunks, 0, tsize);
+	metal_mutex_init(&bpool->lock);
+
+	bept->io = io;
+	bept->cb = cb;
+	bept->priv = priv;
+	bept->rx_held = NULL;
+	ret = rpmsg_create_ept(&bept->ept, rdev, name, src, dest,
+			       rpmsg_bulk_ept_cb, unbind_cb);
+	if (ret) {
+		metal_mutex_deinit(&bpool->lock);
+		metal_free_memory(bpool->chunks);
+		bpool->chunks = NULL;
+	}
+
+	return ret;
+}
+
+void rpmsg_bulk_destroy_ept(struct rpmsg_bulk_ept *bept)
+{
+	if (!bept)
+		return;
+	rpmsg_destroy_ept(&bept->ept);
+	if (bept->pool.chunks) {
+		metal_mutex_deinit(&bept->pool.lock);
+		metal_free_memory(bept->pool.chunks);
+		bept->pool.chunks = NULL;
+	}
+}
+
+void *rpmsg_bulk_get_tx_buffer(struct rpmsg_bulk_ept *bept, size_t len)
+{
+	if (!bept || !bept->pool.chunks)
+		return NULL;
+
+	return rpmsg_bulk_pool_alloc(&bept->pool, len);
+}
+
+void rpmsg_bulk_release_tx_buffer(struct rpmsg_bulk_ept *bept, void *txbuf)
+{
+	if (!bept || !bept->pool.chunks)
+		return;
+
+	(void)rpmsg_bulk_pool_free(&bept->pool, txbuf, false);
+}
+
+int rpmsg_bulk_send_nocopy(struct rpmsg_bulk_ept *bept, void *txbuf,
+			   size_t len)
+{
+	struct rpmsg_bulk_pool *pool;
+	size_t size;
+	int idx;
+	int ret;
+
+	if (!bept || !bept->pool.chunks || !txbuf)
+		return RPMSG_ERR_PARAM;
+
+	pool = &bept->pool;
+	metal_mutex_acquire(&pool->lock);
+	idx = rpmsg_bulk_chunk_index(pool, txbuf);
+	if (idx < 0 || (pool->chunks[idx] & RPMSG_BULK_CHUNK_SENT)) {
+		metal_mutex_release(&pool->lock);
+		return RPMSG_ERR_PARAM;
+	}
+	size = (pool->chunks[idx] & RPMSG_BULK_CHUNK_NUM) * pool->chunk_size;
+	if (!len || len > size) {
+		metal_mutex_release(&pool->lock);
+		return RPMSG_ERR_PARAM;
+	}
+	/* Hand over before sending, the release can arrive at any time */
+	pool->chunks[idx] |= RPMSG_BULK_CHUNK_SENT;
+	metal_mutex_release(&pool->lock);
+
+#ifdef VIRTIO_CACHED_BUFFERS
+	metal_cache_flush(txbuf, len);
+#endif /* VIRTIO_CACHED_BUFFERS */
+
+	ret = rpmsg_bulk_send_ctrl(bept, RPMSG_BULK_DATA,
+				   metal_io_virt_to_offset(bept->io, txbuf),
+				   len);
+	if (ret < 0) {
+		metal_mutex_acquire(&pool->lock);
+		pool->chunks[idx] &= ~RPMSG_BULK_CHUNK_SENT;
+		metal_mutex_release(&pool->lock);
+		return ret;
+	}
+
+	return (int)len;
+}
+
+int rpmsg_bulk_send(struct rpmsg_bulk_ept *bept, const void *data,
+		    size_t len)
+{
+	void *txbuf;
+	int ret;
+
+	if (!data)
+		return RPMSG_ERR_PARAM;
+	txbuf = rpmsg_bulk_get_tx_buffer(bept, len);
+	if (!txbuf)
+		return RPMSG_ERR_NO_BUFF;
+	memcpy(txbuf, data, len);
+	ret = rpmsg_bulk_send_nocopy(bept, txbuf, len);
+	if (ret < 0)
+		rpmsg_bulk_release_tx_buffer(bept, txbuf);
+
+	return ret;
+}
+
+void rpmsg_bulk_hold_rx_buffer(struct rpmsg_bulk_ept *bept, void *rxbuf)
+{
+	if (bept)
+		bept->rx_held = rxbuf;
+}
+
+int rpmsg_bulk_release_rx_buffer(struct rpmsg_bulk_ept *bept, void *rxbuf)
+{
+	unsigned long offset;
+
+	if (!bept || !rxbuf)
+		return RPMSG_ERR_PARAM;
+	offset = metal_io_virt_to_offset(bept->io, rxbuf);
+	if (offset == METAL_BAD_OFFSET)
+		return RPMSG_ERR_PARAM;
+
+	return rpmsg_bulk_send_ctrl(bept, RPMSG_BULK_RELEASE, offset, 0);
+}
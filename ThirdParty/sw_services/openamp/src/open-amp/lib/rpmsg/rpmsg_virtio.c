@@ -348,11 +348,23 @@ static void *rpmsg_virtio_get_tx_payload_buffer(struct rpmsg_device *rdev,
 	return RPMSG_LOCATE_DATA(rp_hdr);
 }
 
-static int rpmsg_virtio_send_offchannel_nocopy(struct rpmsg_device *rdev,
-					       uint32_t src, uint32_t dst,
-					       const void *data, int len)
+/**
+ * rpmsg_virtio_enqueue_msg
+ *
+ * Fills the RPMsg header of a TX payload buffer and places the buffer on
+ * the send virtqueue, without notifying the other side.
+ * The caller has to hold the device lock.
+ *
+ * @param rvdev - pointer to rpmsg virtio device
+ * @param src   - source address of channel
+ * @param dst   - destination address of channel
+ * @param data  - TX payload buffer
+ * @param len   - size of data
+ */
+static void rpmsg_virtio_enqueue_msg(struct rpmsg_virtio_device *rvdev,
+				     uint32_t src, uint32_t dst,
+				     const void *data, int len)
 {
-	struct rpmsg_virtio_device *rvdev;
 	struct metal_io_region *io;
 	struct rpmsg_hdr rp_hdr;
 	struct rpmsg_hdr *hdr;
@@ -360,9 +372,6 @@ static int rpmsg_virtio_send_offchannel_nocopy(struct rpmsg_device *rdev,
 	uint16_t idx;
 	int status;
 
-	/* Get the associated remote device for channel. */
-	rvdev = metal_container_of(rdev, struct rpmsg_virtio_device, rdev);
-
 	hdr = RPMSG_LOCATE_HDR(data);
 	/* The reserved field contains buffer index */
 	idx = hdr->reserved;
@@ -380,8 +389,6 @@ static int rpmsg_virtio_send_offchannel_nocopy(struct rpmsg_device *rdev,
 				      &rp_hdr, sizeof(rp_hdr));
 	RPMSG_ASSERT(status == sizeof(rp_hdr), "failed to write header\r\n");
 
-	metal_mutex_acquire(&rdev->lock);
-
 #ifndef VIRTIO_SLAVE_ONLY
 	if (rpmsg_virtio_get_role(rvdev) == RPMSG_MASTER)
 		buff_len = RPMSG_BUFFER_SIZE;
@@ -392,6 +399,20 @@ static int rpmsg_virtio_send_offchannel_nocopy(struct rpmsg_device *rdev,
 	/* Enqueue buffer on virtqueue. */
 	status = rpmsg_virtio_enqueue_buffer(rvdev, hdr, buff_len, idx);
 	RPMSG_ASSERT(status == VQUEUE_SUCCESS, "failed to enqueue buffer\r\n");
+}
+
+static int rpmsg_virtio_send_offchannel_nocopy(struct rpmsg_device *rdev,
+					       uint32_t src, uint32_t dst,
+					       const void *data, int len)
+{
+	struct rpmsg_virtio_device *rvdev;
+
+	/* Get the associated remote device for channel. */
+	rvdev = metal_container_of(rdev, struct rpmsg_virtio_device, rdev);
+
+	metal_mutex_acquire(&rdev->lock);
+
+	rpmsg_virtio_enqueue_msg(rvdev, src, dst, data, len);
 	/* Let the other side know that there is a job to process. */
 	virtqueue_kick(rvdev->svq);
 
@@ -444,6 +465,84 @@ static int rpmsg_virtio_send_offchannel_raw(struct rpmsg_device *rdev,
 	return rpmsg_virtio_send_offchannel_nocopy(rdev, src, dst, buffer, len);
 }
 
+int rpmsg_virtio_send_batch(struct rpmsg_endpoint *ept, uint32_t dst,
+			    const struct rpmsg_virtio_msg *msgs, int num,
+			    int wait)
+{
+	struct rpmsg_device *rdev;
+	struct rpmsg_virtio_device *rvdev;
+	struct metal_io_region *io;
+	uint32_t buff_len;
+	void *buffer;
+	int queued = 0;
+	int sent;
+	int len;
+	int status;
+
+	if (!ept || !ept->rdev || !msgs || num < 0 ||
+	    dst == RPMSG_ADDR_ANY)
+		return RPMSG_ERR_PARAM;
+
+	/* Reject the whole batch before anything is queued. */
+	for (sent = 0; sent < num; sent++) {
+		if (!msgs[sent].data || msgs[sent].len < 0)
+			return RPMSG_ERR_PARAM;
+	}
+
+	rdev = ept->rdev;
+	rvdev = metal_container_of(rdev, struct rpmsg_virtio_device, rdev);
+	io = rvdev->shbuf_io;
+
+	for (sent = 0; sent < num; sent++) {
+		buffer = rpmsg_virtio_get_tx_payload_buffer(rdev, &buff_len,
+							    false);
+		if (!buffer && wait) {
+			/*
+			 * Out of buffers, let the other side consume the
+			 * queued messages before waiting for a free buffer.
+			 */
+			if (queued) {
+				metal_mutex_acquire(&rdev->lock);
+				virtqueue_kick(rvdev->svq);
+				metal_mutex_release(&rdev->lock);
+				queued = 0;
+			}
+			buffer = rpmsg_virtio_get_tx_payload_buffer(rdev,
+								    &buff_len,
+								    true);
+		}
+		if (!buffer)
+			break;
+
+		/* Copy data to rpmsg buffer. */
+		len = msgs[sent].len;
+		if (len > (int)buff_len)
+			len = buff_len;
+		status = metal_io_block_write(io,
+					      metal_io_virt_to_offset(io,
+								      buffer),
+					      msgs[sent].data, len);
+		RPMSG_ASSERT(status == len, "failed to write buffer\r\n");
+
+		metal_mutex_acquire(&rdev->lock);
+		rpmsg_virtio_enqueue_msg(rvdev, ept->addr, dst, buffer, len);
+		metal_mutex_release(&rdev->lock);
+		queued++;
+	}
+
+	if (queued) {
+		/* Notify the other side once for all queued messages. */
+		metal_mutex_acquire(&rdev->lock);
+		virtqueue_kick(rvdev->svq);
+		metal_mutex_release(&rdev->lock);
+	}
+
+	if (!sent && num)
+		return RPMSG_ERR_NO_BUFF;
+
+	return sent;
+}
+
 /**
  * rpmsg_virtio_tx_callback
  *
@@ -458,6 +557,38 @@ static void rpmsg_virtio_tx_callback(struct virtqueue *vq)
 	(void)vq;
 }
 
+/**
+ * rpmsg_virtio_rearm_rx
+ *
+ * Re-enables the receive notifications once all received buffers are
+ * drained. Buffers which arrived while notifications were suppressed are
+ * returned to the caller, in which case notifications stay suppressed.
+ * The caller has to hold the device lock.
+ *
+ * @param rvdev - pointer to rpmsg virtio device
+ * @param len   - size of received buffer
+ * @param idx   - index of buffer
+ *
+ * @return - pointer to received buffer, NULL if none is pending
+ */
+static void *rpmsg_virtio_rearm_rx(struct rpmsg_virtio_device *rvdev,
+				   uint32_t *len, uint16_t *idx)
+{
+	void *rp_hdr = NULL;
+
+	/* The poll loop picks up late buffers in poll mode */
+	if (rvdev->poll_mode)
+		return NULL;
+
+	if (virtqueue_enable_cb(rvdev->rvq)) {
+		rp_hdr = rpmsg_virtio_get_rx_buffer(rvdev, len, idx);
+		if (rp_hdr)
+			virtqueue_disable_cb(rvdev->rvq);
+	}
+
+	return rp_hdr;
+}
+
 /**
  * rpmsg_virtio_rx_callback
  *
@@ -479,8 +610,13 @@ static void rpmsg_virtio_rx_callback(struct virtqueue *vq)
 
 	metal_mutex_acquire(&rdev->lock);
 
+	/* Suppress notifications while the received buffers are drained */
+	virtqueue_disable_cb(rvdev->rvq);
+
 	/* Process the received data from remote node */
 	rp_hdr = rpmsg_virtio_get_rx_buffer(rvdev, &len, &idx);
+	if (!rp_hdr)
+		rp_hdr = rpmsg_virtio_rearm_rx(rvdev, &len, &idx);
 
 	metal_mutex_release(&rdev->lock);
 
@@ -519,11 +655,60 @@ static void rpmsg_virtio_rx_callback(struct virtqueue *vq)
 		if (!rp_hdr) {
 			/* tell peer we return some rx buffer */
 			virtqueue_kick(rvdev->rvq);
+			rp_hdr = rpmsg_virtio_rearm_rx(rvdev, &len, &idx);
 		}
 		metal_mutex_release(&rdev->lock);
 	}
 }
 
+int rpmsg_virtio_set_poll_mode(struct rpmsg_virtio_device *rvdev, int enable)
+{
+	struct rpmsg_device *rdev;
+	int pending = 0;
+
+	if (!rvdev || !rvdev->rvq)
+		return RPMSG_ERR_PARAM;
+
+	rdev = &rvdev->rdev;
+	metal_mutex_acquire(&rdev->lock);
+	rvdev->poll_mode = !!enable;
+	if (rvdev->poll_mode)
+		virtqueue_disable_cb(rvdev->rvq);
+	else
+		pending = virtqueue_enable_cb(rvdev->rvq);
+	metal_mutex_release(&rdev->lock);
+
+	/* Deliver what arrived before the remote side saw the change */
+	if (pending)
+		rpmsg_virtio_rx_callback(rvdev->rvq);
+
+	return RPMSG_SUCCESS;
+}
+
+int rpmsg_virtio_poll(struct rpmsg_virtio_device *rvdev,
+		      unsigned int timeout)
+{
+	unsigned int backoff = 1;
+	unsigned int spins = 0;
+	unsigned int i;
+
+	if (!rvdev || !rvdev->rvq)
+		return RPMSG_ERR_PARAM;
+
+	while (!virtqueue_get_pending(rvdev->rvq)) {
+		if (spins >= timeout)
+			return 0;
+		for (i = 0; i < backoff; i++)
+			metal_cpu_yield();
+		spins += backoff;
+		if (backoff < RPMSG_POLL_BACKOFF_MAX)
+			backoff <<= 1;
+	}
+	rpmsg_virtio_rx_callback(rvdev->rvq);
+
+	return 1;
+}
+
 /**
  * rpmsg_virtio_ns_callback
  *
@@ -469,6 +469,31 @@ uint32_t virtqueue_get_desc_size(struct virtqueue *vq)
 	return len;
 }
 
+/**
+ * virtqueue_get_pending - Returns the number of buffers the other side
+ *                         has made available to the local side
+ *
+ * Only reads the ring index, no buffer is taken from the queue. Used to
+ * poll the virtqueue when callbacks are disabled.
+ *
+ * @param vq            - Pointer to VirtIO queue control block
+ *
+ * @return              - Number of pending buffers
+ */
+int virtqueue_get_pending(struct virtqueue *vq)
+{
+#ifndef VIRTIO_SLAVE_ONLY
+	if (vq->vq_dev->role == VIRTIO_DEV_MASTER)
+		return virtqueue_nused(vq);
+#endif /*VIRTIO_SLAVE_ONLY*/
+#ifndef VIRTIO_MASTER_ONLY
+	if (vq->vq_dev->role == VIRTIO_DEV_SLAVE)
+		return virtqueue_navail(vq);
+#endif /*VIRTIO_MASTER_ONLY*/
+
+	return 0;
+}
+
 /**************************************************************************
  *                            Helper Functions                            *
  **************************************************************************/
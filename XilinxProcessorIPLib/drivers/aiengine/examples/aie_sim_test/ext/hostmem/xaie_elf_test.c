@@ -0,0 +1,346 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_elf_test.c
+* @{
+*
+* This file contains the test of the multi tile ELF loader on the host memory
+* backend:
+* - an ELF loaded to all AIE tiles with XAieLib_LoadElfMulti() leaves the same
+*   registers as XAieLib_LoadElf() per tile, and the time of both is
+*   reported,
+* - a reload skips the program memory of every tile, except in the tiles of a
+*   column reset in between, and a different program is written in full,
+* - ELFs with the section headers or a section out of the buffer, or too
+*   small section header entries, are rejected.
+*
+* The first load writes the same number of words with both loaders, so only
+* the reload is faster on the device.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0  agt     10/17/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <string.h>
+#include "xaie_hostmem.h"
+
+/************************** Constant Definitions *****************************/
+#define XAIE_ELF_TEST_PATH		"obj/xaie_elf_test.elf"
+#define XAIE_ELF_TEST_MAX_SIZE		0x10000U
+#define XAIE_ELF_TEST_NUM_TILES		(XAIE_HOSTMEM_NUM_COLS * \
+						XAIE_HOSTMEM_NUM_ROWS)
+
+/* Sections of the test ELF, after the null section */
+#define XAIE_ELF_TEST_NUM_SECTS		5U
+#define XAIE_ELF_TEST_NUM_LOADED	4U
+
+/* Offsets in the 32 bit ELF header */
+#define XAIE_ELF_TEST_EHDR_SIZE		52U
+#define XAIE_ELF_TEST_SHOFF		32U
+#define XAIE_ELF_TEST_SHENTSIZE		46U
+#define XAIE_ELF_TEST_SHNUM		48U
+
+/**************************** Type Definitions *******************************/
+typedef struct {
+	u32 Name;
+	u32 Type;
+	u32 Flags;
+	u32 Addr;
+	u32 Offset;
+	u32 Size;
+	u32 Link;
+	u32 Info;
+	u32 AddrAlign;
+	u32 EntSize;
+} XAieElfTest_Shdr;
+
+/************************** Variable Definitions *****************************/
+static u8 Elf[XAIE_ELF_TEST_MAX_SIZE];
+static u32 ElfSize;
+static XAieGbl_Tile *TileList[XAIE_ELF_TEST_NUM_TILES];
+
+/************************** Function Definitions *****************************/
+static void XAieElfTest_Set16(u32 Off, u16 Val)
+{
+	memcpy(&Elf[Off], &Val, sizeof(Val));
+}
+
+static void XAieElfTest_Set32(u32 Off, u32 Val)
+{
+	memcpy(&Elf[Off], &Val, sizeof(Val));
+}
+
+/*****************************************************************************/
+/**
+*
+* This builds an ELF with a program, read only data, data and bss section,
+* the content of which depends on the seed, and writes it with its map file
+* for XAieLib_LoadElf().
+*
+*******************************************************************************/
+static void XAieElfTest_Build(u32 Seed)
+{
+	static const char StrTab[] = "\0.text\0.rodata\0.data\0.bss\0.shstrtab";
+	static const struct {
+		u32 Name;
+		u32 Type;
+		u32 Flags;
+		u32 Addr;
+		u32 Size;
+	} Sects[XAIE_ELF_TEST_NUM_SECTS] = {
+		{1U, 1U, 6U, 0x0U, 16384U},
+		{7U, 1U, 2U, 0x20400U, 1024U},
+		{15U, 1U, 3U, 0x37F00U, 512U},
+		{21U, 8U, 3U, 0x2A000U, 2048U},
+		{26U, 3U, 0U, 0x0U, sizeof(StrTab)},
+	};
+	XAieElfTest_Shdr Shdr[XAIE_ELF_TEST_NUM_SECTS + 1U];
+	u32 Off = XAIE_ELF_TEST_EHDR_SIZE;
+	u32 Idx, Word;
+	FILE *Fd;
+
+	memset(Elf, 0, sizeof(Elf));
+	memset(Shdr, 0, sizeof(Shdr));
+
+	for (Idx = 0U; Idx < XAIE_ELF_TEST_NUM_SECTS; Idx++) {
+		Shdr[Idx + 1U].Name = Sects[Idx].Name;
+		Shdr[Idx + 1U].Type = Sects[Idx].Type;
+		Shdr[Idx + 1U].Flags = Sects[Idx].Flags;
+		Shdr[Idx + 1U].Addr = Sects[Idx].Addr;
+		Shdr[Idx + 1U].Size = Sects[Idx].Size;
+		Shdr[Idx + 1U].Offset = Off;
+
+		if (Sects[Idx].Type == 1U) {
+			for (Word = 0U; Word < Sects[Idx].Size / 4U; Word++) {
+				XAieElfTest_Set32(Off + Word * 4U,
+						(Seed + Idx) * 0x01000193U ^
+						Word * 2654435761U);
+			}
+		} else if (Sects[Idx].Type == 3U) {
+			memcpy(&Elf[Off], StrTab, sizeof(StrTab));
+		}
+		if (Sects[Idx].Type != 8U) {
+			Off += Sects[Idx].Size;
+		}
+	}
+	Off = (Off + 3U) & ~3U;
+
+	Elf[0] = 0x7FU;
+	Elf[1] = 'E';
+	Elf[2] = 'L';
+	Elf[3] = 'F';
+	Elf[4] = 1U;
+	Elf[5] = 1U;
+	XAieElfTest_Set16(16U, 2U);
+	XAieElfTest_Set16(18U, 0x108U);
+	XAieElfTest_Set32(20U, 1U);
+	XAieElfTest_Set32(XAIE_ELF_TEST_SHOFF, Off);
+	XAieElfTest_Set16(40U, XAIE_ELF_TEST_EHDR_SIZE);
+	XAieElfTest_Set16(XAIE_ELF_TEST_SHENTSIZE, sizeof(XAieElfTest_Shdr));
+	XAieElfTest_Set16(XAIE_ELF_TEST_SHNUM, XAIE_ELF_TEST_NUM_SECTS + 1U);
+	XAieElfTest_Set16(50U, XAIE_ELF_TEST_NUM_SECTS);
+	memcpy(&Elf[Off], Shdr, sizeof(Shdr));
+	ElfSize = Off + sizeof(Shdr);
+
+	Fd = fopen(XAIE_ELF_TEST_PATH, "wb");
+	if (Fd != NULL) {
+		fwrite(Elf, 1U, ElfSize, Fd);
+		fclose(Fd);
+	}
+	Fd = fopen(XAIE_ELF_TEST_PATH ".map", "w");
+	if (Fd != NULL) {
+		fprintf(Fd, "    0x00030000..0x00030400 ( 1 items) : Stack\n");
+		fclose(Fd);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This loads the ELF file to all tiles with XAieLib_LoadElf().
+*
+*******************************************************************************/
+static u64 XAieElfTest_LoadPerTile(void)
+{
+	double Start;
+	u32 Idx;
+
+	XAieSim_HostMemReset();
+	XAieSim_HostMemResetStats();
+	Start = XAieHostMem_TimeMs();
+	for (Idx = 0U; Idx < XAIE_ELF_TEST_NUM_TILES; Idx++) {
+		XAieGbl_LoadElf(TileList[Idx], (u8 *)XAIE_ELF_TEST_PATH, 0U);
+	}
+	XAieHostMem_PrintStats("per tile", Start);
+
+	return XAieSim_HostMemChecksum();
+}
+
+/*****************************************************************************/
+/**
+*
+* This loads and reloads the ELF with a number of threads.
+*
+*******************************************************************************/
+static void XAieElfTest_LoadMulti(u32 NumThreads, u64 Expected)
+{
+	XAieLib_ElfLoadStats Stats;
+	XAieLib_ElfImg *ImgPtr;
+	char Name[32];
+	double Start;
+
+	XAieSim_HostMemReset();
+	XAieLib_ElfInvalidateAll();
+	XAieSim_HostMemResetStats();
+	Start = XAieHostMem_TimeMs();
+	ImgPtr = XAieLib_ElfOpenFile(XAIE_ELF_TEST_PATH);
+	XAieHostMem_Check(ImgPtr != NULL, "ELF file opens");
+	if (ImgPtr == NULL) {
+		return;
+	}
+	XAieLib_LoadElfMulti(TileList, XAIE_ELF_TEST_NUM_TILES, ImgPtr,
+			NumThreads, &Stats);
+	snprintf(Name, sizeof(Name), "multi %u threads", NumThreads);
+	XAieHostMem_PrintStats(Name, Start);
+	XAieHostMem_Check(XAieSim_HostMemChecksum() == Expected,
+			"same registers as the per tile loader");
+
+	XAieSim_HostMemResetStats();
+	Start = XAieHostMem_TimeMs();
+	XAieLib_LoadElfMulti(TileList, XAIE_ELF_TEST_NUM_TILES, ImgPtr,
+			NumThreads, &Stats);
+	snprintf(Name, sizeof(Name), "multi %u threads reload", NumThreads);
+	XAieHostMem_PrintStats(Name, Start);
+	XAieHostMem_Check(Stats.Skipped == XAIE_ELF_TEST_NUM_TILES &&
+			Stats.Loaded == XAIE_ELF_TEST_NUM_TILES *
+			(XAIE_ELF_TEST_NUM_LOADED - 1U),
+			"reload skips the program memory");
+	XAieHostMem_Check(XAieSim_HostMemChecksum() == Expected,
+			"same registers after the reload");
+
+	XAieLib_ElfClose(ImgPtr);
+}
+
+/*****************************************************************************/
+/**
+*
+* This checks that the program memory is written again after a column reset
+* and for a different program.
+*
+*******************************************************************************/
+static void XAieElfTest_Invalidate(void)
+{
+	XAieLib_ElfLoadStats Stats;
+	XAieLib_ElfImg *ImgPtr;
+	u64 Expected;
+
+	XAieElfTest_Build(1U);
+	ImgPtr = XAieLib_ElfOpenMem(Elf, ElfSize);
+	XAieHostMem_Check(ImgPtr != NULL, "ELF opens");
+	if (ImgPtr == NULL) {
+		return;
+	}
+	XAieLib_LoadElfMulti(TileList, XAIE_ELF_TEST_NUM_TILES, ImgPtr, 4U,
+			&Stats);
+	XAieGbl_Write32(XAieHostMem_Tiles[3][0].TileAddr +
+			XAIEGBL_PL_AIETILCOLRST, 1U);
+	XAieLib_LoadElfMulti(TileList, XAIE_ELF_TEST_NUM_TILES, ImgPtr, 4U,
+			&Stats);
+	XAieHostMem_Check(Stats.Skipped == XAIE_ELF_TEST_NUM_TILES -
+			XAIE_HOSTMEM_NUM_ROWS,
+			"column reset drops the loaded programs of the column");
+	XAieLib_ElfClose(ImgPtr);
+
+	XAieElfTest_Build(7U);
+	ImgPtr = XAieLib_ElfOpenMem(Elf, ElfSize);
+	XAieHostMem_Check(ImgPtr != NULL, "ELF opens");
+	if (ImgPtr == NULL) {
+		return;
+	}
+	XAieSim_HostMemReset();
+	XAieLib_LoadElfMulti(TileList, XAIE_ELF_TEST_NUM_TILES, ImgPtr, 4U,
+			&Stats);
+	XAieHostMem_Check(Stats.Skipped == 0U,
+			"a different program is written in full");
+	Expected = XAieSim_HostMemChecksum();
+	XAieHostMem_Check(XAieElfTest_LoadPerTile() == Expected,
+			"same registers as the per tile loader");
+	XAieLib_ElfClose(ImgPtr);
+}
+
+/*****************************************************************************/
+/**
+*
+* This checks that ELFs with headers out of the buffer are rejected.
+*
+*******************************************************************************/
+static void XAieElfTest_Invalid(void)
+{
+	XAieElfTest_Shdr Shdr;
+	u32 ShOff;
+
+	XAieElfTest_Build(1U);
+	memcpy(&ShOff, &Elf[XAIE_ELF_TEST_SHOFF], sizeof(ShOff));
+
+	XAieHostMem_Check(XAieLib_ElfOpenMem(Elf, 16U) == NULL,
+			"truncated ELF header");
+	XAieHostMem_Check(XAieLib_ElfOpenMem(Elf, ElfSize - 1U) == NULL,
+			"section headers out of the buffer");
+
+	XAieElfTest_Set32(XAIE_ELF_TEST_SHOFF, ElfSize + 4U);
+	XAieHostMem_Check(XAieLib_ElfOpenMem(Elf, ElfSize) == NULL,
+			"section header offset out of the buffer");
+	XAieElfTest_Set32(XAIE_ELF_TEST_SHOFF, ShOff);
+
+	XAieElfTest_Set16(XAIE_ELF_TEST_SHENTSIZE, 8U);
+	XAieHostMem_Check(XAieLib_ElfOpenMem(Elf, ElfSize) == NULL,
+			"section header entries too small");
+	XAieElfTest_Set16(XAIE_ELF_TEST_SHENTSIZE, sizeof(XAieElfTest_Shdr));
+
+	/* Program section running past the end of the buffer */
+	memcpy(&Shdr, &Elf[ShOff + sizeof(Shdr)], sizeof(Shdr));
+	Shdr.Size = ElfSize;
+	memcpy(&Elf[ShOff + sizeof(Shdr)], &Shdr, sizeof(Shdr));
+	XAieHostMem_Check(XAieLib_ElfOpenMem(Elf, ElfSize) == NULL,
+			"section out of the buffer");
+
+	XAieLib_ElfClose(NULL);
+}
+
+int main(void)
+{
+	u32 Col, Row, Idx = 0U;
+	u64 Expected;
+
+	XAieHostMem_Initialize();
+	for (Col = 0U; Col < XAIE_HOSTMEM_NUM_COLS; Col++) {
+		for (Row = 1U; Row <= XAIE_HOSTMEM_NUM_ROWS; Row++) {
+			TileList[Idx++] = &XAieHostMem_Tiles[Col][Row];
+		}
+	}
+
+	XAieElfTest_Build(1U);
+	Expected = XAieElfTest_LoadPerTile();
+	XAieElfTest_LoadMulti(1U, Expected);
+	XAieElfTest_LoadMulti(4U, Expected);
+	XAieElfTest_LoadMulti(8U, Expected);
+
+	XAieElfTest_Invalidate();
+	XAieElfTest_Invalid();
+
+	return XAieHostMem_Result("xaie_elf_test");
+}
+
+/** @} */
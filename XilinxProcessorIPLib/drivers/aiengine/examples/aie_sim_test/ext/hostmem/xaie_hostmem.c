@@ -0,0 +1,213 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_hostmem.c
+* @{
+*
+* This file contains the common code of the host memory backend tests: the
+* device instance, an example configuration of the array, the timing and the
+* reporting of the results.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0  agt     10/17/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <time.h>
+#include "xaie_hostmem.h"
+#include "xaiedma_tile.h"
+#include "xaietile_event.h"
+#include "xaietile_perfcnt.h"
+#include "xaietile_strm.h"
+
+/************************** Variable Definitions *****************************/
+XAieGbl_Tile XAieHostMem_Tiles[XAIE_HOSTMEM_NUM_COLS][XAIE_HOSTMEM_NUM_ROWS + 1U];
+u32 XAieHostMem_Failures;
+
+static XAieGbl_HwCfg HwCfg;
+static XAieGbl DevInst;
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This API initializes the device instance of the tests, and sets the latency
+* of the host memory backend.
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+void XAieHostMem_Initialize(void)
+{
+	XAieGbl_Config *CfgPtr;
+
+	XAIEGBL_HWCFG_SET_CONFIG((&HwCfg), XAIE_HOSTMEM_NUM_ROWS,
+			XAIE_HOSTMEM_NUM_COLS, XAIE_HOSTMEM_ARRAY_OFF);
+	XAieGbl_HwInit(&HwCfg);
+	CfgPtr = XAieGbl_LookupConfig(XPAR_AIE_DEVICE_ID);
+	XAieGbl_CfgInitialize(&DevInst, &XAieHostMem_Tiles[0][0], CfgPtr);
+
+	XAieSim_HostMemSetLatency(XAIE_HOSTMEM_READ_NS, XAIE_HOSTMEM_WRITE_NS);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API configures the streams, the DMA, the trace, the counters and the
+* events of all AIE tiles, as an example of the configuration of an
+* application.
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+void XAieHostMem_ConfigureArray(void)
+{
+	XAieDma_Tile Dma;
+	XAieGbl_Tile *TilePtr;
+	u32 Col, Row;
+	u8 Idx;
+
+	for (Col = 0U; Col < XAIE_HOSTMEM_NUM_COLS; Col++) {
+		for (Row = 1U; Row <= XAIE_HOSTMEM_NUM_ROWS; Row++) {
+			TilePtr = &XAieHostMem_Tiles[Col][Row];
+
+			XAieTile_StrmConnectCct(TilePtr,
+				XAIETILE_STRSW_SPORT_SOUTH(TilePtr, 0U),
+				XAIETILE_STRSW_MPORT_NORTH(TilePtr, 0U),
+				XAIE_ENABLE);
+			XAieTile_StrmConnectCct(TilePtr,
+				XAIETILE_STRSW_SPORT_DMA(TilePtr, 0U),
+				XAIETILE_STRSW_MPORT_NORTH(TilePtr, 1U),
+				XAIE_ENABLE);
+			XAieTile_StrmConnectCct(TilePtr,
+				XAIETILE_STRSW_SPORT_SOUTH(TilePtr, 1U),
+				XAIETILE_STRSW_MPORT_DMA(TilePtr, 0U),
+				XAIE_ENABLE);
+
+			XAieDma_TileSoftInitialize(TilePtr, &Dma);
+			for (Idx = 0U; Idx < 4U; Idx++) {
+				XAieDma_TileBdClear(&Dma, Idx);
+				XAieDma_TileBdSetLock(&Dma, Idx,
+						XAIEDMA_TILE_BD_ADDRA, Idx, 1U,
+						1U, 1U, 0U);
+				XAieDma_TileBdSetAdrLenMod(&Dma, Idx,
+						0x1000U * Idx, 0U, 256U, 0U, 0U);
+				XAieDma_TileBdSetNext(&Dma, Idx, (Idx + 1U) & 3U);
+				XAieDma_TileBdWrite(&Dma, Idx);
+			}
+			XAieDma_TileSetStartBd((&Dma), XAIEDMA_TILE_CHNUM_S2MM0,
+					0U);
+			XAieDma_TileChControl(&Dma, XAIEDMA_TILE_CHNUM_S2MM0,
+					XAIE_RESETDISABLE, XAIE_ENABLE);
+
+			XAieTileCore_EventTraceControl(TilePtr, 0U, 1U, 2U, 3U,
+					0U);
+			for (Idx = 0U; Idx < 8U; Idx++) {
+				XAieTileCore_EventTraceEventWriteId(TilePtr,
+						10U + Idx, Idx);
+			}
+			for (Idx = 0U; Idx < 4U; Idx++) {
+				XAieTileCore_PerfCounterControl(TilePtr, Idx,
+						20U + Idx, 30U + Idx, 40U + Idx);
+			}
+
+			XAieTile_MemComboEventInputSet(TilePtr, 1U, 2U, 0xFFU,
+					0xFFU);
+			XAieTile_MemComboEventInputSet(TilePtr, 0xFFU, 0xFFU,
+					3U, 4U);
+			XAieTile_CoreComboEventInputSet(TilePtr, 5U, 6U, 7U, 8U);
+			XAieTile_CoreComboEventControlSet(TilePtr, 1U, 2U,
+					0xFFU);
+			for (Idx = 0U; Idx < 4U; Idx++) {
+				XAieTileCore_EventBroadcast(TilePtr, Idx,
+						50U + Idx);
+			}
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns a monotonic time.
+*
+* @return	Time in milliseconds.
+*
+* @note		None.
+*
+*******************************************************************************/
+double XAieHostMem_TimeMs(void)
+{
+	struct timespec Now;
+
+	clock_gettime(CLOCK_MONOTONIC, &Now);
+
+	return Now.tv_sec * 1e3 + Now.tv_nsec / 1e6;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API prints the time taken since a start time and the accesses of the
+* host memory backend.
+*
+* @param	Name - Name of the measurement.
+* @param	StartMs - Start time, from XAieHostMem_TimeMs().
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+void XAieHostMem_PrintStats(const char *Name, double StartMs)
+{
+	XAieSim_HostMemStats Stats;
+	double Ms = XAieHostMem_TimeMs() - StartMs;
+
+	XAieSim_HostMemGetStats(&Stats);
+	printf("%-28s %8.1f ms  reads %7lu  writes %7lu  block reads %6lu"
+			"  block writes %6lu\n", Name, Ms,
+			(unsigned long)Stats.Reads, (unsigned long)Stats.Writes,
+			(unsigned long)Stats.BlockReads,
+			(unsigned long)Stats.BlockWrites);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API prints the result of a test.
+*
+* @param	Name - Name of the test.
+*
+* @return	0 if all checks passed, 1 otherwise.
+*
+* @note		None.
+*
+*******************************************************************************/
+int XAieHostMem_Result(const char *Name)
+{
+	if (XAieHostMem_Failures != 0U) {
+		printf("%s: %u checks failed\n", Name, XAieHostMem_Failures);
+		return 1;
+	}
+
+	printf("%s: PASS\n", Name);
+	return 0;
+}
+
+/** @} */
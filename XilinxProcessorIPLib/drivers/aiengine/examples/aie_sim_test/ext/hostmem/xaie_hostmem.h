@@ -0,0 +1,79 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_hostmem.h
+* @{
+*
+* Header file of the common code of the host memory backend tests.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0  agt     10/17/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+#ifndef XAIE_HOSTMEM_H
+#define XAIE_HOSTMEM_H
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include "xaiegbl.h"
+#include "xaiegbl_defs.h"
+#include "xaiegbl_params.h"
+#include "xaielib.h"
+#include "xaiesim.h"
+
+/************************** Constant Definitions *****************************/
+#define XAIE_HOSTMEM_NUM_ROWS		8U
+#define XAIE_HOSTMEM_NUM_COLS		50U
+#define XAIE_HOSTMEM_ARRAY_OFF		0x800U
+
+/* Latency of the device registers, in nanoseconds */
+#define XAIE_HOSTMEM_READ_NS		1000U
+#define XAIE_HOSTMEM_WRITE_NS		100U
+
+/***************************** Macro Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* Macro to check a condition of a test, and count and report it if it fails.
+*
+* @param	Cond - Condition to check.
+* @param	Msg - Description of the check.
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+#define XAieHostMem_Check(Cond, Msg)					\
+	do {								\
+		if (!(Cond)) {						\
+			printf("FAIL: %s (%s:%d)\n", (Msg), __FILE__,	\
+					__LINE__);			\
+			XAieHostMem_Failures++;				\
+		}							\
+	} while (0)
+
+/************************** Variable Definitions *****************************/
+extern XAieGbl_Tile XAieHostMem_Tiles[XAIE_HOSTMEM_NUM_COLS][XAIE_HOSTMEM_NUM_ROWS + 1U];
+extern u32 XAieHostMem_Failures;
+
+/************************** Function Prototypes  *****************************/
+void XAieHostMem_Initialize(void);
+void XAieHostMem_ConfigureArray(void);
+double XAieHostMem_TimeMs(void);
+void XAieHostMem_PrintStats(const char *Name, double StartMs);
+int XAieHostMem_Result(const char *Name);
+
+#endif		/* end of protection macro */
+
+/** @} */
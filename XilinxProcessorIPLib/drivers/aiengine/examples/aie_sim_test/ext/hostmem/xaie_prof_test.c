@@ -0,0 +1,201 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_prof_test.c
+* @{
+*
+* This file contains the test of the profiling service on the host memory
+* backend. A kernel runs in the first AIE tile of each column, and between
+* the samples the test writes canned values to the timer and the counters of
+* the tiles, with the timer crossing 32 bits and a counter wrapping. The test
+* checks:
+* - the totals of all metrics and the cycles of every kernel,
+* - the size and the escaping of the exported trace,
+* - that two kernels in the same tile are rejected.
+* The time and the reads of a sample are reported.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0  agt     10/17/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdlib.h>
+#include <string.h>
+#include "xaie_hostmem.h"
+#include "xaietile_prof.h"
+
+/************************** Constant Definitions *****************************/
+#define XAIE_PROF_TEST_NUM_SAMPLES	5U
+#define XAIE_PROF_TEST_CLOCK_MHZ	1000U
+
+/* Canned timer and counters of sample s of the kernel of column c */
+#define XAIE_PROF_TEST_TIMER(s)		(0xFFFFF000ULL + (u64)(s) * 1000U)
+#define XAIE_PROF_TEST_COUNTER0(s)	(0xFFFFFF00U + (s) * 800U)
+#define XAIE_PROF_TEST_COUNTER1(s, c)	((s) * (100U + (c)))
+#define XAIE_PROF_TEST_COUNTER2(s)	((s) * 50U)
+
+/* Kernel with a quote and a backslash in its name */
+#define XAIE_PROF_TEST_ESCAPED		3U
+
+/************************** Variable Definitions *****************************/
+static XAieTile_ProfKernel Kernels[XAIE_HOSTMEM_NUM_COLS];
+static char Names[XAIE_HOSTMEM_NUM_COLS][16];
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This writes the canned timer and counters of a sample to all kernel tiles.
+*
+*******************************************************************************/
+static void XAieProfTest_Tick(u32 Sample)
+{
+	u64 Timer = XAIE_PROF_TEST_TIMER(Sample);
+	u64 TileAddr;
+	u32 Col;
+
+	for (Col = 0U; Col < XAIE_HOSTMEM_NUM_COLS; Col++) {
+		TileAddr = XAieHostMem_Tiles[Col][1].TileAddr;
+		XAieGbl_Write32(TileAddr + XAIEGBL_CORE_TIMLOW, (u32)Timer);
+		XAieGbl_Write32(TileAddr + XAIEGBL_CORE_TIMHIG,
+				(u32)(Timer >> 32U));
+		XAieGbl_Write32(TileAddr + XAIEGBL_CORE_PERCOU0,
+				XAIE_PROF_TEST_COUNTER0(Sample));
+		XAieGbl_Write32(TileAddr + XAIEGBL_CORE_PERCOU1,
+				XAIE_PROF_TEST_COUNTER1(Sample, Col));
+		XAieGbl_Write32(TileAddr + XAIEGBL_CORE_PERCOU2,
+				XAIE_PROF_TEST_COUNTER2(Sample));
+		XAieGbl_Write32(TileAddr + XAIEGBL_CORE_PERCOU3, 0U);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This checks the totals of the metrics of all kernels.
+*
+*******************************************************************************/
+static void XAieProfTest_Totals(XAieTile_Prof *ProfPtr)
+{
+	const u32 Last = XAIE_PROF_TEST_NUM_SAMPLES - 1U;
+	u64 Expected[XAIETILE_PROF_NUM_CORE_STALLS];
+	u64 Cycles;
+	u32 Col;
+	u8 Metric;
+
+	for (Col = 0U; Col < XAIE_HOSTMEM_NUM_COLS; Col++) {
+		Expected[0] = Last * 800U;
+		Expected[1] = XAIE_PROF_TEST_COUNTER1(Last, Col);
+		Expected[2] = XAIE_PROF_TEST_COUNTER2(Last);
+		Expected[3] = 0U;
+
+		for (Metric = 0U; Metric < XAIETILE_PROF_NUM_CORE_STALLS;
+				Metric++) {
+			XAieHostMem_Check(XAieTile_ProfGetTotal(ProfPtr, Col,
+						Metric, &Cycles) ==
+					Expected[Metric], "metric total");
+			XAieHostMem_Check(Cycles == XAIE_PROF_TEST_TIMER(Last) -
+					XAIE_PROF_TEST_TIMER(0U),
+					"cycles of the kernel");
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This checks the size and the escaping of the exported trace.
+*
+*******************************************************************************/
+static void XAieProfTest_Export(XAieTile_Prof *ProfPtr)
+{
+	char Small[100];
+	char *Buf;
+	u32 Len;
+
+	Len = XAieTile_ProfExport(ProfPtr, NULL, 0U);
+	XAieHostMem_Check(Len > 0U, "trace is not empty");
+	XAieHostMem_Check(XAieTile_ProfExport(ProfPtr, Small, sizeof(Small)) ==
+			Len, "truncated export returns the full length");
+	XAieHostMem_Check(strlen(Small) == sizeof(Small) - 1U,
+			"truncated export is terminated");
+
+	Buf = malloc(Len + 1U);
+	if (Buf == NULL) {
+		XAieHostMem_Check(0, "trace buffer allocation");
+		return;
+	}
+	XAieHostMem_Check(XAieTile_ProfExport(ProfPtr, Buf, Len + 1U) == Len &&
+			strlen(Buf) == Len, "export fills the buffer");
+	XAieHostMem_Check(strstr(Buf, "\"k\\\"3\\\\\"") != NULL,
+			"kernel name is escaped");
+	free(Buf);
+}
+
+int main(void)
+{
+	XAieSim_HostMemStats Stats;
+	XAieTile_Prof Prof;
+	double Start;
+	u32 Col, Sample;
+
+	XAieHostMem_Initialize();
+	XAieSim_HostMemReset();
+
+	for (Col = 0U; Col < XAIE_HOSTMEM_NUM_COLS; Col++) {
+		snprintf(Names[Col], sizeof(Names[Col]),
+				Col == XAIE_PROF_TEST_ESCAPED ? "k\"%u\\" : "k%u",
+				Col);
+		Kernels[Col].TileInstPtr = &XAieHostMem_Tiles[Col][1];
+		Kernels[Col].Name = Names[Col];
+		Kernels[Col].Metrics = XAieTile_ProfCoreStalls;
+		Kernels[Col].NumMetrics = XAIETILE_PROF_NUM_CORE_STALLS;
+	}
+
+	if (XAieTile_ProfInitialize(&Prof, Kernels, XAIE_HOSTMEM_NUM_COLS,
+				XAIE_PROF_TEST_NUM_SAMPLES,
+				XAIE_PROF_TEST_CLOCK_MHZ) != XAIE_SUCCESS) {
+		XAieHostMem_Check(0, "profiling initialization");
+		return XAieHostMem_Result("xaie_prof_test");
+	}
+
+	for (Sample = 0U; Sample < XAIE_PROF_TEST_NUM_SAMPLES; Sample++) {
+		XAieProfTest_Tick(Sample);
+		XAieSim_HostMemResetStats();
+		Start = XAieHostMem_TimeMs();
+		XAieHostMem_Check(XAieTile_ProfSample(&Prof) == XAIE_SUCCESS,
+				"sample");
+	}
+	XAieHostMem_PrintStats("sample", Start);
+	XAieSim_HostMemGetStats(&Stats);
+	XAieHostMem_Check(Stats.Reads == XAIE_HOSTMEM_NUM_COLS *
+			(3U + XAIETILE_PROF_NUM_CORE_STALLS),
+			"a sample reads the timer and the counters only");
+	XAieHostMem_Check(XAieTile_ProfSample(&Prof) != XAIE_SUCCESS,
+			"sample buffers full");
+
+	XAieProfTest_Totals(&Prof);
+	XAieProfTest_Export(&Prof);
+	XAieTile_ProfFinish(&Prof);
+
+	Kernels[1].TileInstPtr = Kernels[0].TileInstPtr;
+	XAieHostMem_Check(XAieTile_ProfInitialize(&Prof, Kernels, 2U,
+				XAIE_PROF_TEST_NUM_SAMPLES,
+				XAIE_PROF_TEST_CLOCK_MHZ) != XAIE_SUCCESS,
+			"two kernels in the same tile are rejected");
+
+	return XAieHostMem_Result("xaie_prof_test");
+}
+
+/** @} */
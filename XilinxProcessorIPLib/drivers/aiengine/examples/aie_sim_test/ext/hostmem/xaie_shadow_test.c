@@ -0,0 +1,147 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_shadow_test.c
+* @{
+*
+* This file contains the test of the shadow register cache on the host memory
+* backend:
+* - status, lock, queue and event registers are never cached,
+* - the array is configured twice, directly, with the shadow registers, with
+*   the transaction buffer and with both. Every mode must leave the same
+*   registers, and the reads of each pass are reported. With the shadow
+*   registers, the second pass must not read the device.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0  agt     10/17/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xaie_hostmem.h"
+
+/************************** Constant Definitions *****************************/
+#define XAIE_SHADOW_TEST_PASSES		2U
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This checks the type of the registers the shadow cache relies on.
+*
+*******************************************************************************/
+static void XAieShadowTest_RegType(void)
+{
+	u64 CoreTile = XAieHostMem_Tiles[1][1].TileAddr;
+	u64 ShimTile = XAieHostMem_Tiles[1][0].TileAddr;
+	static const struct {
+		u32 Off;
+		u8 Shim;
+		u8 Cached;
+	} Regs[] = {
+		{XAIEGBL_CORE_CORESTA, 0U, 0U},
+		{XAIEGBL_MEM_LOCK0ACQNV, 0U, 0U},
+		{XAIEGBL_MEM_DMAS2MM0STAQUE, 0U, 0U},
+		{XAIEGBL_MEM_EVTSTA0, 0U, 0U},
+		{XAIEGBL_CORE_TIMLOW, 0U, 0U},
+		{XAIEGBL_MEM_EVTBRDCASTBLKSOUSET, 0U, 0U},
+		{XAIEGBL_CORE_PERCOU0, 0U, 0U},
+		{XAIEGBL_CORE_STRSWISLVDMA0CFG, 0U, 1U},
+		{XAIEGBL_MEM_DMABD3CTRL, 0U, 1U},
+		{XAIEGBL_CORE_EVTBRDCAST3, 0U, 1U},
+		{XAIEGBL_NOC_DMAS2MMSTA, 1U, 0U},
+		{XAIEGBL_PL_INTCON1STLEVSTAA, 1U, 0U},
+		{XAIEGBL_PL_AIETILCOLRST, 1U, 0U},
+		{XAIEGBL_NOC_DMABD3BUFCTRL, 1U, 1U},
+		{XAIEGBL_PL_STRSWISLVSOU0CFG, 1U, 1U},
+	};
+	u32 Idx;
+
+	for (Idx = 0U; Idx < sizeof(Regs) / sizeof(Regs[0]); Idx++) {
+		XAieHostMem_Check((XAieLib_RegType((Regs[Idx].Shim ?
+						ShimTile : CoreTile) +
+						Regs[Idx].Off) ==
+					XAIELIB_REG_CACHED) == Regs[Idx].Cached,
+				"register type");
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This configures the array in a mode, and returns the checksum of the
+* registers.
+*
+*******************************************************************************/
+static u64 XAieShadowTest_Run(const char *Name, u8 Shadow, u8 Txn)
+{
+	XAieSim_HostMemStats Stats;
+	XAieLib_ShadowStats ShadowStats;
+	char PassName[32];
+	double Start;
+	u8 Pass;
+
+	XAieSim_HostMemReset();
+	if (Shadow) {
+		XAieLib_ShadowEnable();
+	}
+
+	for (Pass = 0U; Pass < XAIE_SHADOW_TEST_PASSES; Pass++) {
+		XAieSim_HostMemResetStats();
+		Start = XAieHostMem_TimeMs();
+		if (Txn) {
+			XAieLib_TxnStart(0U);
+		}
+		XAieHostMem_ConfigureArray();
+		if (Txn) {
+			XAieLib_TxnEnd(NULL);
+		}
+		snprintf(PassName, sizeof(PassName), "%s pass %u", Name, Pass);
+		XAieHostMem_PrintStats(PassName, Start);
+	}
+
+	if (Shadow) {
+		XAieSim_HostMemGetStats(&Stats);
+		XAieHostMem_Check(Stats.Reads == 0U,
+				"no reads once the shadow registers are loaded");
+		XAieLib_ShadowGetStats(&ShadowStats);
+		printf("  hits %lu misses %lu bypassed %lu\n",
+				(unsigned long)ShadowStats.Hits,
+				(unsigned long)ShadowStats.Misses,
+				(unsigned long)ShadowStats.Bypassed);
+		XAieLib_ShadowDisable();
+	}
+
+	return XAieSim_HostMemChecksum();
+}
+
+int main(void)
+{
+	u64 Direct;
+
+	XAieHostMem_Initialize();
+
+	XAieShadowTest_RegType();
+
+	Direct = XAieShadowTest_Run("direct", 0U, 0U);
+	XAieHostMem_Check(XAieShadowTest_Run("shadow", 1U, 0U) == Direct,
+			"same registers with the shadow registers");
+	XAieHostMem_Check(XAieShadowTest_Run("transaction", 0U, 1U) == Direct,
+			"same registers with the transaction");
+	XAieHostMem_Check(XAieShadowTest_Run("shadow+transaction", 1U, 1U) ==
+			Direct, "same registers with both");
+
+	return XAieHostMem_Result("xaie_shadow_test");
+}
+
+/** @} */
@@ -0,0 +1,588 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_shimq_test.c
+* @{
+*
+* This file contains the test of the shim DMA buffer queue on the host memory
+* backend. An access hook models the shim DMA of a tile:
+* - a start queue of 4 BDs per channel,
+* - each BD transfers its length at a fixed rate, and acquires and releases
+*   its lock if enabled,
+* - the channel status reports the start queue size, running and stalled on
+*   a lock,
+* - the lock acquire and release registers of the host.
+* The test checks that the callbacks of the queue follow the transfers of the
+* model in order per channel, with one channel, two channels and all four,
+* with and without the locks, and when the callbacks resubmit their buffers.
+* The throughput and the reads per buffer are reported, against a baseline
+* which programs a single BD and waits for it.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0  agt     10/17/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <string.h>
+#include <time.h>
+#include "xaie_hostmem.h"
+#include "xaiegbl_reginit.h"
+#include "xaiedma_shim.h"
+#include "xaiedma_queue.h"
+
+/************************** Constant Definitions *****************************/
+#define XAIE_SHIMQ_TEST_NUM_BUFS	4000U
+#define XAIE_SHIMQ_TEST_BUF_LEN		4096U
+#define XAIE_SHIMQ_TEST_BUF_ADDR	0x800000000ULL
+#define XAIE_SHIMQ_TEST_MAX_LOG		(4U * XAIE_SHIMQ_TEST_NUM_BUFS)
+
+/* Transfer time of the model, about 1 GB/s per channel */
+#define XAIE_SHIMQ_TEST_NS_PER_KB	1000U
+
+#define XAIE_SHIMQ_TEST_NUM_CH		4U
+#define XAIE_SHIMQ_TEST_NUM_BDS		16U
+#define XAIE_SHIMQ_TEST_NUM_LOCKS	16U
+#define XAIE_SHIMQ_TEST_QUEUE_DEPTH	4U
+
+/* Mask of the register offset in a tile address */
+#define XAIE_SHIMQ_TEST_OFF_MASK	((1U << XAIEGBL_TILE_ADDR_ROW_SHIFT) - 1U)
+
+/* Holder of a lock of the model */
+#define XAIE_SHIMQ_TEST_LOCK_FREE	0U
+#define XAIE_SHIMQ_TEST_LOCK_HOST	1U
+#define XAIE_SHIMQ_TEST_LOCK_DMA	2U
+
+/**************************** Type Definitions *******************************/
+typedef struct {
+	u8 Ch;
+	u64 Addr;
+	u32 Len;
+} XAieShimqTest_Xfer;
+
+typedef struct {
+	int Queue[XAIE_SHIMQ_TEST_QUEUE_DEPTH];	/**< Start queue */
+	u32 NumQueued;
+	int Active;		/**< BD in progress, -1 if none */
+	u8 Started;		/**< Active BD acquired its lock */
+	u64 FreeNs;		/**< Time the channel is free from */
+	u64 EndNs;		/**< Time the active BD completes */
+} XAieShimqTest_Ch;
+
+/**
+ * Model of the shim DMA of a tile.
+ */
+typedef struct {
+	u64 Base;		/**< Address of the shim tile */
+	u32 Bd[XAIE_SHIMQ_TEST_NUM_BDS][5];
+	XAieShimqTest_Ch Ch[XAIE_SHIMQ_TEST_NUM_CH];
+	struct {
+		u32 Val;
+		u8 Holder;	/**< XAIE_SHIMQ_TEST_LOCK_* */
+	} Lock[XAIE_SHIMQ_TEST_NUM_LOCKS];
+	XAieShimqTest_Xfer Log[XAIE_SHIMQ_TEST_MAX_LOG]; /**< Transfers done */
+	u32 NumLog;
+	u32 Overflows;		/**< Start queue pushes while full */
+} XAieShimqTest_Model;
+
+/************************** Variable Definitions *****************************/
+extern XAieGbl_RegLocks ShimLockRegs[];
+
+static XAieShimqTest_Model Model;
+static XAieShimqTest_Xfer CbLog[XAIE_SHIMQ_TEST_MAX_LOG];
+static u32 NumCb;
+static u32 NumResubmit;
+
+static XAieGbl_Tile *ShimTilePtr;
+static XAieDma_Shim ShimDma;
+
+/************************** Function Definitions *****************************/
+static u64 XAieShimqTest_NowNs(void)
+{
+	struct timespec Now;
+
+	clock_gettime(CLOCK_MONOTONIC, &Now);
+
+	return (u64)Now.tv_sec * 1000000000ULL + Now.tv_nsec;
+}
+
+static u32 XAieShimqTest_Field(u32 Val, XAieGbl_RegFldAttr Attr)
+{
+	return (Val & Attr.Mask) >> Attr.Lsb;
+}
+
+/*****************************************************************************/
+/**
+*
+* This advances the channels of the model to the current time: starts the
+* queued BDs whose lock can be acquired, and completes the BDs whose transfer
+* time has elapsed.
+*
+*******************************************************************************/
+static void XAieShimqTest_Advance(void)
+{
+	u64 Now = XAieShimqTest_NowNs();
+	XAieShimqTest_Ch *ChPtr;
+	u32 Ctrl, Lock;
+	int Bd;
+	u8 Ch;
+
+	for (Ch = 0U; Ch < XAIE_SHIMQ_TEST_NUM_CH; Ch++) {
+		ChPtr = &Model.Ch[Ch];
+		for (;;) {
+			if (ChPtr->Active < 0) {
+				if (ChPtr->NumQueued == 0U) {
+					break;
+				}
+				ChPtr->Active = ChPtr->Queue[0];
+				ChPtr->NumQueued--;
+				memmove(ChPtr->Queue, ChPtr->Queue + 1,
+						ChPtr->NumQueued *
+						sizeof(ChPtr->Queue[0]));
+				ChPtr->Started = 0U;
+			}
+
+			Bd = ChPtr->Active;
+			Ctrl = Model.Bd[Bd][2];
+			Lock = XAieShimqTest_Field(Ctrl, ShimBd[Bd].Ctrl.Lock);
+			if (!ChPtr->Started) {
+				if (XAieShimqTest_Field(Ctrl,
+							ShimBd[Bd].Ctrl.AcqEn)) {
+					if (Model.Lock[Lock].Holder !=
+						XAIE_SHIMQ_TEST_LOCK_FREE ||
+						Model.Lock[Lock].Val !=
+						XAieShimqTest_Field(Ctrl,
+							ShimBd[Bd].Ctrl.AcqVal)) {
+						break;
+					}
+					Model.Lock[Lock].Holder =
+						XAIE_SHIMQ_TEST_LOCK_DMA;
+				}
+				ChPtr->EndNs = (ChPtr->FreeNs > Now ?
+						ChPtr->FreeNs : Now) +
+					(u64)XAieShimqTest_Field(Model.Bd[Bd][1],
+							ShimBd[Bd].Len) * 4U *
+					XAIE_SHIMQ_TEST_NS_PER_KB / 1024U;
+				ChPtr->Started = 1U;
+			}
+			if (Now < ChPtr->EndNs) {
+				break;
+			}
+
+			if (XAieShimqTest_Field(Ctrl, ShimBd[Bd].Ctrl.RelEn)) {
+				Model.Lock[Lock].Holder =
+					XAIE_SHIMQ_TEST_LOCK_FREE;
+				Model.Lock[Lock].Val = XAieShimqTest_Field(Ctrl,
+						ShimBd[Bd].Ctrl.RelVal);
+			}
+			if (Model.NumLog < XAIE_SHIMQ_TEST_MAX_LOG) {
+				Model.Log[Model.NumLog].Ch = Ch;
+				Model.Log[Model.NumLog].Addr =
+					((u64)XAieShimqTest_Field(Ctrl,
+						ShimBd[Bd].Ctrl.Addh) << 32U) |
+					Model.Bd[Bd][0];
+				Model.Log[Model.NumLog++].Len =
+					XAieShimqTest_Field(Model.Bd[Bd][1],
+							ShimBd[Bd].Len) * 4U;
+			}
+			ChPtr->FreeNs = ChPtr->EndNs;
+			ChPtr->Active = -1;
+		}
+
+		if (ChPtr->Active < 0 && ChPtr->NumQueued == 0U &&
+				ChPtr->FreeNs < Now) {
+			ChPtr->FreeNs = Now;
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This reads a status or lock register of the model.
+*
+*******************************************************************************/
+static uint8 XAieShimqTest_Read(u32 Off, uint32 *ValPtr)
+{
+	XAieGbl_RegLocks *LockPtr;
+	XAieShimqTest_Ch *ChPtr;
+	u8 Found = 0U;
+	u32 Val = 0U;
+	u8 Stalled, Acq;
+	u32 Idx;
+
+	for (Idx = 0U; Idx < XAIE_SHIMQ_TEST_NUM_CH; Idx++) {
+		if (Off != ShimDmaSts[Idx].RegOff) {
+			continue;
+		}
+		ChPtr = &Model.Ch[Idx];
+		Stalled = ChPtr->Active >= 0 && !ChPtr->Started;
+		Val |= (ChPtr->NumQueued << ShimDmaSts[Idx].StartQSize.Lsb) &
+			ShimDmaSts[Idx].StartQSize.Mask;
+		Val |= ((u32)(ChPtr->Active >= 0 && !Stalled) <<
+				ShimDmaSts[Idx].Sts.Lsb) &
+			ShimDmaSts[Idx].Sts.Mask;
+		Val |= ((u32)Stalled << ShimDmaSts[Idx].Stalled.Lsb) &
+			ShimDmaSts[Idx].Stalled.Mask;
+		Found = 1U;
+	}
+	if (Found) {
+		*ValPtr = Val;
+		return 1U;
+	}
+
+	for (Idx = 0U; Idx < XAIE_SHIMQ_TEST_NUM_LOCKS; Idx++) {
+		LockPtr = &ShimLockRegs[Idx];
+		if (Off == LockPtr->AcqV0Off || Off == LockPtr->AcqV1Off) {
+			Val = Off == LockPtr->AcqV1Off;
+			Acq = Model.Lock[Idx].Holder ==
+				XAIE_SHIMQ_TEST_LOCK_FREE &&
+				Model.Lock[Idx].Val == Val;
+			if (Acq) {
+				Model.Lock[Idx].Holder =
+					XAIE_SHIMQ_TEST_LOCK_HOST;
+			}
+			*ValPtr = (u32)Acq << (Val ? LockPtr->AcqV1.Lsb :
+					LockPtr->AcqV0.Lsb);
+			return 1U;
+		}
+		if (Off == LockPtr->RelV0Off || Off == LockPtr->RelV1Off) {
+			Val = Off == LockPtr->RelV1Off;
+			Model.Lock[Idx].Holder = XAIE_SHIMQ_TEST_LOCK_FREE;
+			Model.Lock[Idx].Val = Val;
+			XAieShimqTest_Advance();
+			*ValPtr = 1U << (Val ? LockPtr->RelV1.Lsb :
+					LockPtr->RelV0.Lsb);
+			return 1U;
+		}
+	}
+
+	return 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the access hook of the model. The BD registers are kept in the host
+* memory as well, so they can be read back.
+*
+*******************************************************************************/
+static uint8 XAieShimqTest_Hook(void *Data, uint64_t Addr, uint32 *ValPtr,
+		uint8 Write)
+{
+	u32 Off;
+	u32 Bd, Word, Ch;
+
+	(void)Data;
+
+	if ((Addr & ~(u64)XAIE_SHIMQ_TEST_OFF_MASK) != Model.Base) {
+		return 0U;
+	}
+	Off = (u32)(Addr - Model.Base);
+
+	XAieShimqTest_Advance();
+
+	for (Bd = 0U; Bd < XAIE_SHIMQ_TEST_NUM_BDS; Bd++) {
+		for (Word = 0U; Word < 5U; Word++) {
+			if (Off == ShimBd[Bd].RegOff[Word]) {
+				if (Write) {
+					Model.Bd[Bd][Word] = *ValPtr;
+				}
+				return 0U;
+			}
+		}
+	}
+
+	if (!Write) {
+		return XAieShimqTest_Read(Off, ValPtr);
+	}
+
+	for (Ch = 0U; Ch < XAIE_SHIMQ_TEST_NUM_CH; Ch++) {
+		if (Off != ShimDmaCh[Ch].StatQOff) {
+			continue;
+		}
+		if (Model.Ch[Ch].NumQueued == XAIE_SHIMQ_TEST_QUEUE_DEPTH) {
+			Model.Overflows++;
+		} else {
+			Model.Ch[Ch].Queue[Model.Ch[Ch].NumQueued++] =
+				XAieShimqTest_Field(*ValPtr,
+						ShimDmaCh[Ch].StatQ);
+		}
+		XAieShimqTest_Advance();
+		return 0U;
+	}
+
+	return 0U;
+}
+
+static void XAieShimqTest_Reset(void)
+{
+	u8 Ch;
+
+	memset(&Model, 0, sizeof(Model));
+	Model.Base = ShimTilePtr->TileAddr;
+	for (Ch = 0U; Ch < XAIE_SHIMQ_TEST_NUM_CH; Ch++) {
+		Model.Ch[Ch].Active = -1;
+	}
+	NumCb = 0U;
+	NumResubmit = 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the completion callback of the buffers, logging them and
+* resubmitting them while NumResubmit is not 0.
+*
+*******************************************************************************/
+static void XAieShimqTest_Callback(XAieDma_ShimQueue *QueuePtr, void *CbData,
+		u64 Addr, u32 Length)
+{
+	if (NumCb < XAIE_SHIMQ_TEST_MAX_LOG) {
+		CbLog[NumCb].Ch = QueuePtr->ChNum;
+		CbLog[NumCb].Addr = Addr;
+		CbLog[NumCb++].Len = Length;
+	}
+
+	if (NumResubmit > 0U) {
+		NumResubmit--;
+		XAieDma_ShimQueueSubmit(QueuePtr, Addr + 0x1000000ULL, Length,
+				XAieShimqTest_Callback, CbData);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This checks that the callbacks follow the transfers of the model in order,
+* per channel.
+*
+*******************************************************************************/
+static u8 XAieShimqTest_Match(u32 NumBufs)
+{
+	u32 CbIdx, LogIdx;
+	u8 Ch;
+
+	if (NumCb != NumBufs || Model.NumLog != NumBufs ||
+			Model.Overflows != 0U) {
+		return 0U;
+	}
+
+	for (Ch = 0U; Ch < XAIE_SHIMQ_TEST_NUM_CH; Ch++) {
+		CbIdx = 0U;
+		LogIdx = 0U;
+		for (;;) {
+			while (CbIdx < NumCb && CbLog[CbIdx].Ch != Ch) {
+				CbIdx++;
+			}
+			while (LogIdx < Model.NumLog &&
+					Model.Log[LogIdx].Ch != Ch) {
+				LogIdx++;
+			}
+			if (CbIdx == NumCb || LogIdx == Model.NumLog) {
+				if (CbIdx != NumCb || LogIdx != Model.NumLog) {
+					return 0U;
+				}
+				break;
+			}
+			if (CbLog[CbIdx].Addr != Model.Log[LogIdx].Addr ||
+					CbLog[CbIdx].Len !=
+					Model.Log[LogIdx].Len) {
+				return 0U;
+			}
+			CbIdx++;
+			LogIdx++;
+		}
+	}
+
+	return 1U;
+}
+
+static void XAieShimqTest_Print(const char *Name, u64 StartNs, u32 NumBufs)
+{
+	XAieSim_HostMemStats Stats;
+	double Us = (XAieShimqTest_NowNs() - StartNs) / 1e3;
+
+	XAieSim_HostMemGetStats(&Stats);
+	printf("%-24s %8.1f ms %8.1f MB/s  reads per buffer %.2f\n", Name,
+			Us / 1e3, (double)NumBufs * XAIE_SHIMQ_TEST_BUF_LEN / Us,
+			(double)Stats.Reads / NumBufs);
+}
+
+/*****************************************************************************/
+/**
+*
+* This transfers the buffers by programming a BD and waiting for it, as a
+* baseline.
+*
+*******************************************************************************/
+static void XAieShimqTest_Baseline(u8 Ch)
+{
+	u8 Bd = Ch * 4U;
+	u64 StartNs, Addr;
+	u32 Idx;
+
+	XAieShimqTest_Reset();
+	XAieSim_HostMemResetStats();
+	StartNs = XAieShimqTest_NowNs();
+	for (Idx = 0U; Idx < XAIE_SHIMQ_TEST_NUM_BUFS; Idx++) {
+		Addr = XAIE_SHIMQ_TEST_BUF_ADDR +
+			(u64)Idx * XAIE_SHIMQ_TEST_BUF_LEN;
+		XAieDma_ShimBdSetAddr(&ShimDma, Bd, (u16)(Addr >> 32U),
+				(u32)Addr, XAIE_SHIMQ_TEST_BUF_LEN);
+		XAieDma_ShimBdWrite(&ShimDma, Bd);
+		XAieDma_ShimSetStartBd((&ShimDma), Ch, Bd);
+		while (XAieDma_ShimPendingBdCount(&ShimDma, Ch) != 0U) {
+		}
+		CbLog[NumCb].Ch = Ch;
+		CbLog[NumCb].Addr = Addr;
+		CbLog[NumCb++].Len = XAIE_SHIMQ_TEST_BUF_LEN;
+	}
+	XAieShimqTest_Print("baseline", StartNs, XAIE_SHIMQ_TEST_NUM_BUFS);
+	XAieHostMem_Check(XAieShimqTest_Match(XAIE_SHIMQ_TEST_NUM_BUFS),
+			"baseline transfers");
+}
+
+/*****************************************************************************/
+/**
+*
+* This submits the buffers to the queues of channels, and polls the queues
+* until all buffers are completed.
+*
+*******************************************************************************/
+static void XAieShimqTest_Queue(const char *Name, const u8 *Chs, u8 NumChs,
+		u8 Flags)
+{
+	XAieDma_ShimQueue Queues[XAIE_SHIMQ_TEST_NUM_CH];
+	u64 StartNs;
+	u32 Idx;
+	u8 Busy;
+	u8 Ch;
+
+	XAieShimqTest_Reset();
+	for (Ch = 0U; Ch < NumChs; Ch++) {
+		XAieHostMem_Check(XAieDma_ShimQueueInitialize(&Queues[Ch],
+					ShimTilePtr, &ShimDma, Chs[Ch], 0U,
+					Flags) == XAIE_SUCCESS,
+				"queue initialization");
+	}
+
+	XAieSim_HostMemResetStats();
+	StartNs = XAieShimqTest_NowNs();
+	for (Idx = 0U; Idx < XAIE_SHIMQ_TEST_NUM_BUFS; Idx++) {
+		for (Ch = 0U; Ch < NumChs; Ch++) {
+			XAieDma_ShimQueueSubmit(&Queues[Ch],
+					XAIE_SHIMQ_TEST_BUF_ADDR +
+					((u64)Ch << 28U) +
+					(u64)Idx * XAIE_SHIMQ_TEST_BUF_LEN,
+					XAIE_SHIMQ_TEST_BUF_LEN,
+					XAieShimqTest_Callback, NULL);
+		}
+	}
+	do {
+		Busy = 0U;
+		for (Ch = 0U; Ch < NumChs; Ch++) {
+			XAieDma_ShimQueuePoll(&Queues[Ch]);
+			Busy |= XAieDma_ShimQueueCount(&Queues[Ch]) != 0U;
+		}
+	} while (Busy);
+	XAieShimqTest_Print(Name, StartNs, XAIE_SHIMQ_TEST_NUM_BUFS * NumChs);
+	XAieHostMem_Check(XAieShimqTest_Match(XAIE_SHIMQ_TEST_NUM_BUFS *
+				NumChs), Name);
+
+	for (Ch = 0U; Ch < NumChs; Ch++) {
+		XAieDma_ShimQueueFinish(&Queues[Ch]);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This checks that callbacks can resubmit their buffers, with the queue
+* waited on.
+*
+*******************************************************************************/
+static void XAieShimqTest_Resubmit(void)
+{
+	const u32 NumBufs = 8U;
+	XAieDma_ShimQueue Queue;
+	u32 Idx;
+
+	XAieShimqTest_Reset();
+	NumResubmit = 1000U;
+	XAieDma_ShimQueueInitialize(&Queue, ShimTilePtr, &ShimDma,
+			XAIEDMA_SHIM_CHNUM_S2MM1, 0U, XAIEDMA_SHIMQ_FLAG_LOCKS);
+	for (Idx = 0U; Idx < NumBufs; Idx++) {
+		XAieDma_ShimQueueSubmit(&Queue, 0x40000000ULL +
+				Idx * XAIE_SHIMQ_TEST_BUF_LEN,
+				XAIE_SHIMQ_TEST_BUF_LEN,
+				XAieShimqTest_Callback, NULL);
+	}
+	XAieHostMem_Check(XAieDma_ShimQueueWait(&Queue, 10000000U) ==
+			XAIE_SUCCESS, "wait for the resubmitted buffers");
+	XAieHostMem_Check(Queue.Completed == NumBufs + 1000U &&
+			XAieShimqTest_Match(NumBufs + 1000U),
+			"resubmitted buffers");
+	XAieDma_ShimQueueFinish(&Queue);
+}
+
+int main(void)
+{
+	static const u8 Mm2s[] = {XAIEDMA_SHIM_CHNUM_MM2S0};
+	static const u8 S2mm[] = {XAIEDMA_SHIM_CHNUM_S2MM0};
+	static const u8 Two[] = {XAIEDMA_SHIM_CHNUM_MM2S0,
+		XAIEDMA_SHIM_CHNUM_S2MM0};
+	static const u8 Four[] = {XAIEDMA_SHIM_CHNUM_S2MM0,
+		XAIEDMA_SHIM_CHNUM_S2MM1, XAIEDMA_SHIM_CHNUM_MM2S0,
+		XAIEDMA_SHIM_CHNUM_MM2S1};
+	u32 Col;
+	u8 Bd;
+
+	XAieHostMem_Initialize();
+	XAieSim_HostMemReset();
+
+	for (Col = 0U; Col < XAIE_HOSTMEM_NUM_COLS; Col++) {
+		if (XAieHostMem_Tiles[Col][0].TileType ==
+				XAIEGBL_TILE_TYPE_SHIMNOC) {
+			ShimTilePtr = &XAieHostMem_Tiles[Col][0];
+			break;
+		}
+	}
+	if (ShimTilePtr == NULL) {
+		XAieHostMem_Check(0, "shim NoC tile");
+		return XAieHostMem_Result("xaie_shimq_test");
+	}
+
+	XAieDma_ShimSoftInitialize(ShimTilePtr, &ShimDma);
+	for (Bd = 0U; Bd < XAIE_SHIMQ_TEST_NUM_BDS; Bd++) {
+		XAieDma_ShimBdClear(&ShimDma, Bd);
+	}
+	XAieSim_HostMemSetHook(XAieShimqTest_Hook, NULL);
+
+	XAieShimqTest_Baseline(XAIEDMA_SHIM_CHNUM_MM2S0);
+	XAieShimqTest_Queue("queue mm2s", Mm2s, 1U, 0U);
+	XAieShimqTest_Queue("queue mm2s locks", Mm2s, 1U,
+			XAIEDMA_SHIMQ_FLAG_LOCKS);
+	XAieShimqTest_Queue("queue s2mm locks", S2mm, 1U,
+			XAIEDMA_SHIMQ_FLAG_LOCKS);
+	XAieShimqTest_Queue("queue mm2s+s2mm", Two, 2U, 0U);
+	XAieShimqTest_Queue("queue 4 channels locks", Four, 4U,
+			XAIEDMA_SHIMQ_FLAG_LOCKS);
+	XAieShimqTest_Resubmit();
+
+	XAieSim_HostMemSetHook(NULL, NULL);
+
+	return XAieHostMem_Result("xaie_shimq_test");
+}
+
+/** @} */
@@ -0,0 +1,168 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaie_txn_test.c
+* @{
+*
+* This file contains the test of the transaction buffer on the host memory
+* backend:
+* - the writes to action registers reach the device as issued, in order,
+* - a configuration of the array leaves the same registers with and without
+*   the transaction buffer, and the time and accesses of both are reported.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0  agt     10/17/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xaie_hostmem.h"
+
+/************************** Constant Definitions *****************************/
+#define XAIE_TXN_TEST_MAX_LOG		64U
+
+/************************** Variable Definitions *****************************/
+static u64 WriteAddr[XAIE_TXN_TEST_MAX_LOG];	/**< Device writes, in order */
+static u32 WriteVal[XAIE_TXN_TEST_MAX_LOG];
+static u32 NumWrites;
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This is the access hook logging the writes reaching the device.
+*
+*******************************************************************************/
+static uint8 XAieTxnTest_LogHook(void *Data, uint64_t Addr, uint32 *ValPtr,
+		uint8 Write)
+{
+	(void)Data;
+
+	if (Write && NumWrites < XAIE_TXN_TEST_MAX_LOG) {
+		WriteAddr[NumWrites] = Addr;
+		WriteVal[NumWrites++] = *ValPtr;
+	}
+
+	return 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This checks that the writes to action registers aren't merged or resolved
+* from the shadow registers, and reach the device in order.
+*
+*******************************************************************************/
+static void XAieTxnTest_Action(void)
+{
+	u64 CoreTile = XAieHostMem_Tiles[1][1].TileAddr;
+	u64 ShimTile = XAieHostMem_Tiles[1][0].TileAddr;
+	static const struct {
+		u64 Off;
+		u32 Val;
+		u8 Shim;
+	} Expected[] = {
+		{XAIEGBL_CORE_CORECTRL, 2U, 0U},
+		{XAIEGBL_CORE_CORECTRL, 0U, 0U},
+		{XAIEGBL_MEM_LOCK3RELNV, 0U, 0U},
+		{XAIEGBL_MEM_LOCK3RELNV, 0U, 0U},
+		{XAIEGBL_NOC_DMAMM2S0STABDQUE, 1U, 1U},
+		{XAIEGBL_NOC_DMAMM2S0STABDQUE, 2U, 1U},
+		{XAIEGBL_CORE_EVTGEN, 5U, 0U},
+		{XAIEGBL_CORE_EVTGEN, 5U, 0U},
+		{XAIEGBL_CORE_TILCTRL, 3U, 0U},
+	};
+	XAieLib_TxnStats Stats;
+	u32 Idx;
+
+	XAieSim_HostMemReset();
+	XAieSim_HostMemSetHook(XAieTxnTest_LogHook, NULL);
+	NumWrites = 0U;
+
+	XAieLib_TxnStart(0U);
+	XAieGbl_Write32(CoreTile + XAIEGBL_CORE_CORECTRL, 2U);
+	XAieGbl_Write32(CoreTile + XAIEGBL_CORE_CORECTRL, 0U);
+	XAieGbl_Write32(CoreTile + XAIEGBL_MEM_LOCK3RELNV, 0U);
+	XAieGbl_Write32(CoreTile + XAIEGBL_MEM_LOCK3RELNV, 0U);
+	XAieGbl_Write32(ShimTile + XAIEGBL_NOC_DMAMM2S0STABDQUE, 1U);
+	XAieGbl_Write32(ShimTile + XAIEGBL_NOC_DMAMM2S0STABDQUE, 2U);
+	XAieGbl_MaskWrite32(CoreTile + XAIEGBL_CORE_EVTGEN, 0x7FU, 5U);
+	XAieGbl_MaskWrite32(CoreTile + XAIEGBL_CORE_EVTGEN, 0x7FU, 5U);
+	XAieGbl_Write32(CoreTile + XAIEGBL_CORE_TILCTRL, 1U);
+	XAieGbl_Write32(CoreTile + XAIEGBL_CORE_TILCTRL, 3U);
+	XAieHostMem_Check(NumWrites == 8U,
+			"action writes are issued before the end");
+	XAieLib_TxnEnd(&Stats);
+
+	XAieSim_HostMemSetHook(NULL, NULL);
+
+	XAieHostMem_Check(NumWrites == sizeof(Expected) / sizeof(Expected[0]),
+			"number of device writes");
+	XAieHostMem_Check(Stats.Merged == 1U, "only the tile control is merged");
+	for (Idx = 0U; Idx < NumWrites &&
+			Idx < sizeof(Expected) / sizeof(Expected[0]); Idx++) {
+		XAieHostMem_Check(WriteAddr[Idx] == (Expected[Idx].Shim ?
+					ShimTile : CoreTile) + Expected[Idx].Off &&
+				WriteVal[Idx] == Expected[Idx].Val,
+				"device writes in program order");
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This configures the array with and without the transaction buffer, and
+* checks that both leave the same registers.
+*
+*******************************************************************************/
+static void XAieTxnTest_Configuration(void)
+{
+	XAieLib_TxnStats Stats;
+	u64 Direct;
+	double Start;
+
+	XAieSim_HostMemReset();
+	XAieSim_HostMemResetStats();
+	Start = XAieHostMem_TimeMs();
+	XAieHostMem_ConfigureArray();
+	XAieHostMem_PrintStats("direct", Start);
+	Direct = XAieSim_HostMemChecksum();
+
+	XAieSim_HostMemReset();
+	XAieSim_HostMemResetStats();
+	Start = XAieHostMem_TimeMs();
+	XAieLib_TxnStart(0U);
+	XAieHostMem_ConfigureArray();
+	XAieLib_TxnEnd(&Stats);
+	XAieHostMem_PrintStats("transaction", Start);
+	printf("  recorded %lu merged %lu shadow hits %lu flushes %lu\n",
+			(unsigned long)Stats.Recorded,
+			(unsigned long)Stats.Merged,
+			(unsigned long)Stats.ShadowHits,
+			(unsigned long)Stats.Flushes);
+
+	XAieHostMem_Check(XAieSim_HostMemChecksum() == Direct,
+			"same registers with and without the transaction");
+}
+
+int main(void)
+{
+	XAieHostMem_Initialize();
+
+	XAieTxnTest_Action();
+	XAieTxnTest_Configuration();
+
+	return XAieHostMem_Result("xaie_txn_test");
+}
+
+/** @} */
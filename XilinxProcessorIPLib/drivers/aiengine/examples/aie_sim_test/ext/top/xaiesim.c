@@ -34,6 +34,7 @@
 * 1.9  Hyun    01/08/2018  Add the MaskPoll
 * 2.0  Hyun    04/05/2018  NPI support
 * 2.1  Tejus   04/23/2020  Fix unsigned int overflow.
+* 2.2  agt     10/17/2026  Add the host memory IO backend
 * </pre>
 *
 ******************************************************************************/
@@ -47,6 +48,12 @@
 #include "main_rts.h"
 #include "cdo_rts.h"
 #endif
+#ifdef __AIESIM_HOSTMEM__
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#endif
 
 /***************************** Include Files *********************************/
 
@@ -80,6 +87,9 @@ static const XAieSim_IO_Funcs *IO_Funcs = &Ess_IO_Funcs;
 #elif defined(__AIESIM_SOCK__)
 static const XAieSim_IO_Funcs Sock_IO_Funcs;
 static const XAieSim_IO_Funcs *IO_Funcs = &Sock_IO_Funcs;
+#elif defined(__AIESIM_HOSTMEM__)
+static const XAieSim_IO_Funcs HostMem_IO_Funcs;
+static const XAieSim_IO_Funcs *IO_Funcs = &HostMem_IO_Funcs;
 #else
 static const XAieSim_IO_Funcs *IO_Funcs = NULL;
 #endif
@@ -349,6 +359,228 @@ static const XAieSim_IO_Funcs Sock_IO_Funcs = {
 };
 #endif
 
+#ifdef __AIESIM_HOSTMEM__
+
+/*
+ * Host memory IO functions
+ *
+ * The registers are kept in a hash table in host memory, so the driver can
+ * run without the simulator or the device. Registers that were never written
+ * read as 0. Accesses are counted, and an optional busy-wait per access
+ * models the latency of the device interconnect for timing. The accesses
+ * are serialized by a lock, but the latencies of concurrent accesses
+ * overlap, as on the device. An access hook can model the registers of a
+ * hardware block, ex, the DMA status, in place of the memory.
+ */
+
+#define XAIESIM_HOSTMEM_USED		(1ULL << 63U)
+#define XAIESIM_HOSTMEM_INIT_SIZE	4096U
+
+typedef struct {
+	uint64_t Key;	/**< Address | XAIESIM_HOSTMEM_USED, 0 if empty */
+	uint32 Val;	/**< Register value */
+} XAieSim_HostMemReg;
+
+static XAieSim_HostMemReg *HostMemRegs;
+static uint64_t HostMemSize;
+static uint64_t HostMemUsed;
+static XAieSim_HostMemStats HostMemStats;
+static uint32 HostMemReadNs;
+static uint32 HostMemWriteNs;
+static pthread_mutex_t HostMemLock = PTHREAD_MUTEX_INITIALIZER;
+static XAieSim_HostMemHook HostMemHook;
+static void *HostMemHookData;
+
+static void XAieSim_HostMemDelay(uint32 Ns)
+{
+	struct timespec Start, Now;
+
+	if (Ns == 0U)
+		return;
+
+	clock_gettime(CLOCK_MONOTONIC, &Start);
+	do {
+		clock_gettime(CLOCK_MONOTONIC, &Now);
+	} while ((uint64_t)(Now.tv_sec - Start.tv_sec) * 1000000000ULL +
+			Now.tv_nsec - Start.tv_nsec < Ns);
+}
+
+static XAieSim_HostMemReg *XAieSim_HostMemFind(uint64_t Addr, uint8 Insert)
+{
+	uint64_t Key = Addr | XAIESIM_HOSTMEM_USED;
+	uint64_t Idx;
+
+	if (Insert && (HostMemUsed + 1U) * 2U > HostMemSize) {
+		XAieSim_HostMemReg *OldRegs = HostMemRegs;
+		uint64_t OldSize = HostMemSize;
+		uint64_t Old;
+
+		HostMemSize = OldSize ? OldSize * 2U : XAIESIM_HOSTMEM_INIT_SIZE;
+		HostMemRegs = calloc(HostMemSize, sizeof(*HostMemRegs));
+		if (HostMemRegs == NULL) {
+			HostMemRegs = OldRegs;
+			HostMemSize = OldSize;
+			return NULL;
+		}
+		HostMemUsed = 0U;
+		for (Old = 0U; Old < OldSize; Old++) {
+			if (OldRegs[Old].Key != 0U) {
+				XAieSim_HostMemFind(OldRegs[Old].Key &
+						~XAIESIM_HOSTMEM_USED, 1U)->Val =
+					OldRegs[Old].Val;
+			}
+		}
+		free(OldRegs);
+	}
+
+	if (HostMemSize == 0U)
+		return NULL;
+
+	/* Registers are word aligned, so drop the low bits from the hash */
+	Idx = ((Addr >> 2U) * 0x9E3779B97F4A7C15ULL) >> 20U;
+	for (Idx &= HostMemSize - 1U; HostMemRegs[Idx].Key != 0U;
+			Idx = (Idx + 1U) & (HostMemSize - 1U)) {
+		if (HostMemRegs[Idx].Key == Key)
+			return &HostMemRegs[Idx];
+	}
+
+	if (!Insert)
+		return NULL;
+
+	HostMemRegs[Idx].Key = Key;
+	HostMemRegs[Idx].Val = 0U;
+	HostMemUsed++;
+
+	return &HostMemRegs[Idx];
+}
+
+static inline uint8 XAieSim_HostMemCallHook(uint64_t Addr, uint32 *ValPtr,
+		uint8 Write)
+{
+	return HostMemHook != NULL &&
+		HostMemHook(HostMemHookData, Addr, ValPtr, Write);
+}
+
+static inline uint32 XAieSim_HostMemRead32(uint64_t Addr)
+{
+	XAieSim_HostMemReg *Reg;
+	uint32 Val;
+
+	XAieSim_HostMemDelay(HostMemReadNs);
+
+	pthread_mutex_lock(&HostMemLock);
+	HostMemStats.Reads++;
+	if (!XAieSim_HostMemCallHook(Addr, &Val, 0U)) {
+		Reg = XAieSim_HostMemFind(Addr, 0U);
+		Val = Reg ? Reg->Val : 0U;
+	}
+	pthread_mutex_unlock(&HostMemLock);
+
+	return Val;
+}
+
+static inline void XAieSim_HostMemRead128(uint64_t Addr, uint32 *Data)
+{
+	uint8 Idx;
+
+	/* The driver IO layer issues a block read as four 32 bit reads */
+	XAieSim_HostMemDelay(HostMemReadNs * 4U);
+
+	pthread_mutex_lock(&HostMemLock);
+	HostMemStats.BlockReads++;
+	for (Idx = 0U; Idx < 4U; Idx++) {
+		XAieSim_HostMemReg *Reg;
+
+		if (XAieSim_HostMemCallHook(Addr + Idx * 4U, &Data[Idx], 0U))
+			continue;
+		Reg = XAieSim_HostMemFind(Addr + Idx * 4U, 0U);
+		Data[Idx] = Reg ? Reg->Val : 0U;
+	}
+	pthread_mutex_unlock(&HostMemLock);
+}
+
+static inline void XAieSim_HostMemWrite32(uint64_t Addr, uint32 Data)
+{
+	XAieSim_HostMemReg *Reg;
+
+	XAieSim_HostMemDelay(HostMemWriteNs);
+
+	pthread_mutex_lock(&HostMemLock);
+	HostMemStats.Writes++;
+	if (!XAieSim_HostMemCallHook(Addr, &Data, 1U)) {
+		Reg = XAieSim_HostMemFind(Addr, 1U);
+		if (Reg != NULL)
+			Reg->Val = Data;
+	}
+	pthread_mutex_unlock(&HostMemLock);
+}
+
+static inline void XAieSim_HostMemWrite128(uint64_t Addr, uint32 *Data)
+{
+	uint8 Idx;
+
+	/* The driver IO layer issues a block write as four 32 bit writes */
+	XAieSim_HostMemDelay(HostMemWriteNs * 4U);
+
+	pthread_mutex_lock(&HostMemLock);
+	HostMemStats.BlockWrites++;
+	for (Idx = 0U; Idx < 4U; Idx++) {
+		XAieSim_HostMemReg *Reg;
+
+		if (XAieSim_HostMemCallHook(Addr + Idx * 4U, &Data[Idx], 1U))
+			continue;
+		Reg = XAieSim_HostMemFind(Addr + Idx * 4U, 1U);
+		if (Reg != NULL)
+			Reg->Val = Data[Idx];
+	}
+	pthread_mutex_unlock(&HostMemLock);
+}
+
+static inline void XAieSim_HostMemMaskWrite32(uint64_t Addr, uint32 Mask,
+		uint32 Data)
+{
+	uint32 RegVal = XAieSim_HostMemRead32(Addr);
+
+	RegVal &= ~Mask;
+	RegVal |= Data;
+	XAieSim_HostMemWrite32(Addr, RegVal);
+}
+
+static inline void XAieSim_HostMemWriteCmd(uint8 Command, uint8 ColId,
+		uint8 RowId, uint32 CmdWd0, uint32 CmdWd1, uint8 *CmdStr)
+{
+	/* no-op */
+}
+
+static inline uint32 XAieSim_HostMemMaskPoll(uint64_t Addr, uint32 Mask,
+		uint32 Value, uint32 TimeOutUs)
+{
+	/* Only the access hook changes the registers behind the driver's back */
+	while ((XAieSim_HostMemRead32(Addr) & Mask) != Value) {
+		if (HostMemHook == NULL || TimeOutUs == 0U)
+			return XAIESIM_FAILURE;
+		usleep(1);
+		TimeOutUs--;
+	}
+
+	return XAIESIM_SUCCESS;
+}
+
+static const XAieSim_IO_Funcs HostMem_IO_Funcs = {
+	.Read32 = XAieSim_HostMemRead32,
+	.Read128 = XAieSim_HostMemRead128,
+	.Write32 = XAieSim_HostMemWrite32,
+	.MaskWrite32 = XAieSim_HostMemMaskWrite32,
+	.Write128 = XAieSim_HostMemWrite128,
+	.WriteCmd = XAieSim_HostMemWriteCmd,
+	.MaskPoll = XAieSim_HostMemMaskPoll,
+	.NpiRead32 = XAieSim_HostMemRead32,
+	.NpiWrite32 = XAieSim_HostMemWrite32,
+	.NpiMaskWrite32 = XAieSim_HostMemMaskWrite32,
+	.NpiMaskPoll = XAieSim_HostMemMaskPoll,
+};
+#endif
+
 /*****************************************************************************/
 /**
 *
@@ -531,6 +763,11 @@ uint8 XAieSim_SetIOMode(uint8 Mode)
 	case XAIESIM_IO_MODE_SOCK:
 		IO_Funcs = &Sock_IO_Funcs;
 		break;
+#endif
+#ifdef __AIESIM_HOSTMEM__
+	case XAIESIM_IO_MODE_HOSTMEM:
+		IO_Funcs = &HostMem_IO_Funcs;
+		break;
 #endif
 	default:
 		return XAIESIM_FAILURE;
@@ -677,5 +914,138 @@ uint32 XAieSim_NPIMaskPoll(uint64_t Addr, uint32 Mask, uint32 Value,
 	return IO_Funcs->NpiMaskPoll(Addr, Mask, Value, TimeOutUs);
 }
 
-/** @} */
+#ifdef __AIESIM_HOSTMEM__
+/*****************************************************************************/
+/**
+*
+* This API returns the access counts of the host memory backend.
+*
+* @param	StatsPtr: Pointer to the statistics to fill.
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+void XAieSim_HostMemGetStats(XAieSim_HostMemStats *StatsPtr)
+{
+	pthread_mutex_lock(&HostMemLock);
+	*StatsPtr = HostMemStats;
+	pthread_mutex_unlock(&HostMemLock);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API clears the access counts of the host memory backend.
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+void XAieSim_HostMemResetStats(void)
+{
+	pthread_mutex_lock(&HostMemLock);
+	memset(&HostMemStats, 0, sizeof(HostMemStats));
+	pthread_mutex_unlock(&HostMemLock);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API sets the time each access to the host memory backend takes, to
+* model the latency of the device for timing measurements.
+*
+* @param	ReadNs: Latency of a 32 bit read in nanoseconds.
+* @param	WriteNs: Latency of a 32 bit write in nanoseconds.
+*
+* @return	None.
+*
+* @note		128 bit accesses are charged four times the latency, as
+*		XAieLib_IOWrite128() and XAieIO_Write128() issue them as four
+*		32 bit accesses on the device.
+*
+*******************************************************************************/
+void XAieSim_HostMemSetLatency(uint32 ReadNs, uint32 WriteNs)
+{
+	HostMemReadNs = ReadNs;
+	HostMemWriteNs = WriteNs;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API sets the access hook of the host memory backend. The hook is called
+* on each 32 bit word accessed, with the backend lock held, so it must not
+* access the registers itself. A hook that handles the access returns 1, and
+* for a read fills *ValPtr. Otherwise it returns 0, and the access goes to the
+* host memory.
+*
+* @param	Hook: Hook to call, or NULL to remove the hook.
+* @param	Data: Data passed to the hook.
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+void XAieSim_HostMemSetHook(XAieSim_HostMemHook Hook, void *Data)
+{
+	pthread_mutex_lock(&HostMemLock);
+	HostMemHook = Hook;
+	HostMemHookData = Data;
+	pthread_mutex_unlock(&HostMemLock);
+}
 
+/*****************************************************************************/
+/**
+*
+* This API clears all the registers of the host memory backend.
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+void XAieSim_HostMemReset(void)
+{
+	pthread_mutex_lock(&HostMemLock);
+	free(HostMemRegs);
+	HostMemRegs = NULL;
+	HostMemSize = 0U;
+	HostMemUsed = 0U;
+	pthread_mutex_unlock(&HostMemLock);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns a checksum of the registers of the host memory backend, to
+* compare the state left by different sequences of accesses.
+*
+* @return	Checksum of the registers.
+*
+* @note		The checksum doesn't depend on the order the registers were
+*		written in, and registers written with 0 count as never written.
+*
+*******************************************************************************/
+uint64_t XAieSim_HostMemChecksum(void)
+{
+	uint64_t Sum = 0U;
+	uint64_t Idx;
+
+	pthread_mutex_lock(&HostMemLock);
+	for (Idx = 0U; Idx < HostMemSize; Idx++) {
+		if (HostMemRegs[Idx].Key != 0U && HostMemRegs[Idx].Val != 0U) {
+			Sum += (HostMemRegs[Idx].Key * 0x9E3779B97F4A7C15ULL) ^
+				HostMemRegs[Idx].Val;
+		}
+	}
+	pthread_mutex_unlock(&HostMemLock);
+
+	return Sum;
+}
+#endif
+
+/** @} */
@@ -30,6 +30,7 @@
 * 2.0  Hyun    01/08/2018  Add the MaskPoll
 * 2.1  Hyun    04/05/2018  NPI support
 * 2.2  Tejus   10/14/2019  Removed assertion macros for simulation
+* 2.3  agt     10/17/2026  Add the host memory IO backend
 * </pre>
 *
 ******************************************************************************/
@@ -63,6 +64,7 @@
 #define XAIESIM_IO_MODE_ESS		0U
 #define XAIESIM_IO_MODE_SOCK		1U
 #define XAIESIM_IO_MODE_CDO		2U
+#define XAIESIM_IO_MODE_HOSTMEM		3U
 
 /****************************** Type Definitions *****************************/
 typedef unsigned char			uint8;
@@ -75,6 +77,22 @@ typedef struct {
         uint32 RegVal;
 } XAieSim_RegState;
 
+/*
+ * Access counts of the host memory backend
+ */
+typedef struct {
+	uint64_t Reads;		/**< 32 bit reads */
+	uint64_t Writes;	/**< 32 bit writes */
+	uint64_t BlockReads;	/**< 128 bit reads */
+	uint64_t BlockWrites;	/**< 128 bit writes */
+} XAieSim_HostMemStats;
+
+/*
+ * Access hook of the host memory backend, see XAieSim_HostMemSetHook()
+ */
+typedef uint8 (*XAieSim_HostMemHook)(void *Data, uint64_t Addr,
+		uint32 *ValPtr, uint8 Write);
+
 /************************** Function Prototypes  *****************************/
 uint32 XAieSim_Read32(uint64_t Addr);
 void XAieSim_Read128(uint64_t Addr, uint32 *Data);
@@ -92,6 +110,15 @@ void XAieSim_NPIWrite32(uint64_t Addr, uint32 Data);
 void XAieSim_NPIMaskWrite32(uint64_t Addr, uint32 Mask, uint32 Data);
 uint32 XAieSim_NPIMaskPoll(uint64_t Addr, uint32 Mask, uint32 Value, uint32 TimeOutUs);
 
+#ifdef __AIESIM_HOSTMEM__
+void XAieSim_HostMemGetStats(XAieSim_HostMemStats *StatsPtr);
+void XAieSim_HostMemResetStats(void);
+void XAieSim_HostMemSetLatency(uint32 ReadNs, uint32 WriteNs);
+void XAieSim_HostMemSetHook(XAieSim_HostMemHook Hook, void *Data);
+void XAieSim_HostMemReset(void);
+uint64_t XAieSim_HostMemChecksum(void);
+#endif
+
 #endif		/* end of protection macro */
 /** @} */
 
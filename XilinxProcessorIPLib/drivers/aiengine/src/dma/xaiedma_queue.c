@@ -0,0 +1,473 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaiedma_queue.c
+* @{
+*
+* This file contains the Shim DMA buffer queue.
+*
+* A queue owns a channel of a Shim DMA and a set of its BDs, 4 by default.
+* Buffers submitted to the queue are issued to the channel as BDs are
+* available, up to the depth of the start queue of the channel, and wait in
+* a ring in host memory otherwise. XAieDma_ShimQueuePoll() retires the
+* completed buffers in order, reissues their BDs with the waiting buffers,
+* and then calls the completion callbacks, so the channel is kept busy while
+* the callbacks run. The callbacks may submit new buffers.
+*
+* The completed buffers are counted from the start queue size and the state
+* of the channel, with one read per poll. With XAIEDMA_SHIMQ_FLAG_LOCKS, each
+* BD also acquires and releases the shim lock of the same index:
+* - an S2MM BD acquires its lock with value 0 and releases it with 1 when the
+*   buffer is written. The host acquires the lock with value 1 to retire the
+*   buffer, and releases it with 0 after the callback, so the buffer isn't
+*   written again before the callback has consumed it.
+* - an MM2S BD acquires its lock with value 1, which the host releases when
+*   the buffer is issued, and releases it with 0 when the buffer is read, so
+*   the lock is ready for the next buffer.
+* The array or the PL can then also hold the locks to pace the stream.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0  agt     10/17/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdlib.h>
+#include "xaiegbl.h"
+#include "xaiegbl_defs.h"
+#include "xaiedma_shim.h"
+#include "xaietile_lock.h"
+#include "xaiedma_queue.h"
+
+/***************************** Macro Definitions *****************************/
+#define XAIEDMA_SHIMQ_DEF_PENDING		16U
+#define XAIEDMA_SHIMQ_POLL_USECS		10U
+#define XAIEDMA_SHIMQ_DONE_DEF_WAIT_USECS	1000000U
+
+#define XAIEDMA_SHIMQ_IS_S2MM(ChNum)	((ChNum) < XAIEDMA_SHIM_CHNUM_MM2S0)
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This API initializes a queue on a Shim DMA channel. The BDs of the queue are
+* set to not chain, and to use the locks if XAIEDMA_SHIMQ_FLAG_LOCKS is set,
+* and the channel is enabled. The other attributes of the BDs, ex, AXI, are
+* kept from the Shim DMA instance.
+*
+* @param	QueuePtr - Pointer to the queue instance.
+* @param	TileInstPtr - Pointer to the shim tile instance.
+* @param	DmaInstPtr - Pointer to the Shim DMA instance of the tile.
+* @param	ChNum - Channel number (0-S2MM0,1-S2MM1,2-MM2S0,3-MM2S1).
+* @param	BdMask - Mask of the BDs of the queue. If 0, the queue uses the
+*		BDs 4 * ChNum to 4 * ChNum + 3.
+* @param	Flags - XAIEDMA_SHIMQ_FLAG_*.
+*
+* @return	XAIE_SUCCESS if successful, else XAIE_FAILURE.
+*
+* @note		The queues of the channels of a Shim DMA need to use disjoint
+*		BDs. The channel is expected to be idle.
+*
+*******************************************************************************/
+u32 XAieDma_ShimQueueInitialize(XAieDma_ShimQueue *QueuePtr,
+		XAieGbl_Tile *TileInstPtr, XAieDma_Shim *DmaInstPtr, u8 ChNum,
+		u16 BdMask, u8 Flags)
+{
+	u8 BdNum;
+
+	XAie_AssertNonvoid(QueuePtr != XAIE_NULL);
+	XAie_AssertNonvoid(TileInstPtr != XAIE_NULL);
+	XAie_AssertNonvoid(DmaInstPtr != XAIE_NULL);
+	XAie_AssertNonvoid(ChNum < XAIEDMA_SHIM_MAX_NUM_CHANNELS);
+
+	if (BdMask == 0U) {
+		BdMask = ((1U << XAIEDMA_SHIMQ_DEF_BDS_PER_CH) - 1U) <<
+			(ChNum * XAIEDMA_SHIMQ_DEF_BDS_PER_CH);
+	}
+
+	QueuePtr->TileInstPtr = TileInstPtr;
+	QueuePtr->DmaInstPtr = DmaInstPtr;
+	QueuePtr->ChNum = ChNum;
+	QueuePtr->Flags = Flags;
+	QueuePtr->NumBds = 0U;
+	QueuePtr->NextBd = 0U;
+	QueuePtr->IssuedHead = 0U;
+	QueuePtr->NumIssued = 0U;
+	QueuePtr->Pending = XAIE_NULL;
+	QueuePtr->PendingSize = 0U;
+	QueuePtr->PendingHead = 0U;
+	QueuePtr->NumPending = 0U;
+	QueuePtr->Completed = 0U;
+
+	for (BdNum = 0U; BdNum < XAIEDMA_SHIM_MAX_NUM_DESCRS; BdNum++) {
+		if ((BdMask & (1U << BdNum)) == 0U) {
+			continue;
+		}
+
+		QueuePtr->Bds[QueuePtr->NumBds++] = BdNum;
+		XAieDma_ShimBdSetNext(DmaInstPtr, BdNum,
+				XAIEDMA_SHIM_BD_NEXTBD_INVALID);
+
+		if ((Flags & XAIEDMA_SHIMQ_FLAG_LOCKS) == 0U) {
+			XAieDma_ShimBdSetLock(DmaInstPtr, BdNum, 0U,
+					XAIE_DISABLE,
+					XAIEDMA_SHIM_LKACQRELVAL_INVALID,
+					XAIE_DISABLE,
+					XAIEDMA_SHIM_LKACQRELVAL_INVALID);
+		} else if (XAIEDMA_SHIMQ_IS_S2MM(ChNum)) {
+			XAieDma_ShimBdSetLock(DmaInstPtr, BdNum, BdNum,
+					XAIE_ENABLE, XAIETILE_LOCK_REL_VAL1,
+					XAIE_ENABLE, XAIETILE_LOCK_ACQ_VAL0);
+		} else {
+			XAieDma_ShimBdSetLock(DmaInstPtr, BdNum, BdNum,
+					XAIE_ENABLE, XAIETILE_LOCK_REL_VAL0,
+					XAIE_ENABLE, XAIETILE_LOCK_ACQ_VAL1);
+		}
+	}
+
+	/* The start queue holds the BDs issued to the channel */
+	QueuePtr->MaxIssued = QueuePtr->NumBds;
+	if (QueuePtr->MaxIssued > XAIEGBL_NOC_DMASTA_STARTQ_MAX) {
+		QueuePtr->MaxIssued = XAIEGBL_NOC_DMASTA_STARTQ_MAX;
+	}
+
+	XAieDma_ShimChControl(DmaInstPtr, ChNum, XAIE_DISABLE, XAIE_DISABLE,
+			XAIE_ENABLE);
+
+	return XAIE_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API disables the channel of the queue and frees the queue. The buffers
+* not completed are dropped without their callbacks.
+*
+* @param	QueuePtr - Pointer to the queue instance.
+*
+* @return	None.
+*
+* @note		Use XAieDma_ShimQueueWait() first to complete the buffers.
+*
+*******************************************************************************/
+void XAieDma_ShimQueueFinish(XAieDma_ShimQueue *QueuePtr)
+{
+	XAie_AssertVoid(QueuePtr != XAIE_NULL);
+
+	XAieDma_ShimChControl(QueuePtr->DmaInstPtr, QueuePtr->ChNum,
+			XAIE_DISABLE, XAIE_DISABLE, XAIE_DISABLE);
+
+	free(QueuePtr->Pending);
+	QueuePtr->Pending = XAIE_NULL;
+	QueuePtr->PendingSize = 0U;
+	QueuePtr->NumPending = 0U;
+	QueuePtr->NumIssued = 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API issues a buffer to the next BD of the queue, and pushes the BD to
+* the start queue of the channel.
+*
+* @param	QueuePtr - Pointer to the queue instance.
+* @param	BufPtr - Buffer to issue.
+*
+* @return	None.
+*
+* @note		Internal only. The caller checks a BD is available.
+*
+*******************************************************************************/
+static void _XAieDma_ShimQueueIssue(XAieDma_ShimQueue *QueuePtr,
+		const XAieDma_ShimQueueBuf *BufPtr)
+{
+	XAieDma_Shim *DmaInstPtr = QueuePtr->DmaInstPtr;
+	XAieDma_ShimQueueBuf *IssuedPtr;
+	u8 BdNum;
+
+	BdNum = QueuePtr->Bds[QueuePtr->NextBd];
+	QueuePtr->NextBd = (QueuePtr->NextBd + 1U) % QueuePtr->NumBds;
+
+	XAieDma_ShimBdSetAddr(DmaInstPtr, BdNum, (u16)(BufPtr->Addr >> 32U),
+			(u32)BufPtr->Addr, BufPtr->Length);
+	XAieDma_ShimBdWrite(DmaInstPtr, BdNum);
+
+	if ((QueuePtr->Flags & XAIEDMA_SHIMQ_FLAG_LOCKS) != 0U &&
+			!XAIEDMA_SHIMQ_IS_S2MM(QueuePtr->ChNum)) {
+		/* Hand the buffer to the DMA */
+		XAieTile_LockRelease(QueuePtr->TileInstPtr, BdNum,
+				XAIETILE_LOCK_REL_VAL1, 0U);
+	}
+
+	XAieDma_ShimSetStartBd(DmaInstPtr, QueuePtr->ChNum, BdNum);
+
+	IssuedPtr = &QueuePtr->Issued[(QueuePtr->IssuedHead +
+			QueuePtr->NumIssued) % XAIEDMA_SHIM_MAX_NUM_DESCRS];
+	*IssuedPtr = *BufPtr;
+	IssuedPtr->BdNum = BdNum;
+	QueuePtr->NumIssued++;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API issues the pending buffers while BDs are available.
+*
+* @param	QueuePtr - Pointer to the queue instance.
+*
+* @return	None.
+*
+* @note		Internal only.
+*
+*******************************************************************************/
+static void _XAieDma_ShimQueueRefill(XAieDma_ShimQueue *QueuePtr)
+{
+	while (QueuePtr->NumPending > 0U &&
+			QueuePtr->NumIssued < QueuePtr->MaxIssued) {
+		_XAieDma_ShimQueueIssue(QueuePtr,
+				&QueuePtr->Pending[QueuePtr->PendingHead]);
+		QueuePtr->PendingHead = (QueuePtr->PendingHead + 1U) %
+			QueuePtr->PendingSize;
+		QueuePtr->NumPending--;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API submits a buffer to the queue. The buffer is issued to the channel
+* if a BD is available, or waits in the queue until one is. The number of
+* buffers waiting is not bounded.
+*
+* @param	QueuePtr - Pointer to the queue instance.
+* @param	Addr - Address of the buffer (128-bit aligned, 48 bits).
+* @param	Length - Length of the buffer in bytes (multiple of 4).
+* @param	Callback - Callback to call on completion, or NULL.
+* @param	CbData - Data passed to the callback.
+*
+* @return	XAIE_SUCCESS if successful, else XAIE_FAILURE if the queue
+*		can't grow.
+*
+* @note		The completion is reported by XAieDma_ShimQueuePoll().
+*
+*******************************************************************************/
+u32 XAieDma_ShimQueueSubmit(XAieDma_ShimQueue *QueuePtr, u64 Addr,
+		u32 Length, XAieDma_ShimQueueCb Callback, void *CbData)
+{
+	XAieDma_ShimQueueBuf Buf;
+
+	XAie_AssertNonvoid(QueuePtr != XAIE_NULL);
+	XAie_AssertNonvoid((Addr & XAIEDMA_SHIM_ADDRLOW_ALIGN_MASK) == 0U);
+	XAie_AssertNonvoid((Addr >> 48U) == 0U);
+	XAie_AssertNonvoid(Length != 0U);
+	XAie_AssertNonvoid((Length & XAIEDMA_SHIM_TXFER_LEN32_MASK) == 0U);
+
+	Buf.Addr = Addr;
+	Buf.Length = Length;
+	Buf.BdNum = 0U;
+	Buf.Callback = Callback;
+	Buf.CbData = CbData;
+
+	/* Keep the order with the buffers already waiting */
+	if (QueuePtr->NumPending == 0U &&
+			QueuePtr->NumIssued < QueuePtr->MaxIssued) {
+		_XAieDma_ShimQueueIssue(QueuePtr, &Buf);
+		return XAIE_SUCCESS;
+	}
+
+	if (QueuePtr->NumPending == QueuePtr->PendingSize) {
+		XAieDma_ShimQueueBuf *Pending;
+		u32 Size;
+		u32 Idx;
+
+		Size = QueuePtr->PendingSize ? QueuePtr->PendingSize * 2U :
+			XAIEDMA_SHIMQ_DEF_PENDING;
+		Pending = malloc(Size * sizeof(*Pending));
+		if (Pending == XAIE_NULL) {
+			XAieLib_print("Error: Failed to grow the DMA queue\n");
+			return XAIE_FAILURE;
+		}
+
+		for (Idx = 0U; Idx < QueuePtr->NumPending; Idx++) {
+			Pending[Idx] = QueuePtr->Pending[(QueuePtr->PendingHead +
+					Idx) % QueuePtr->PendingSize];
+		}
+		free(QueuePtr->Pending);
+		QueuePtr->Pending = Pending;
+		QueuePtr->PendingSize = Size;
+		QueuePtr->PendingHead = 0U;
+	}
+
+	QueuePtr->Pending[(QueuePtr->PendingHead + QueuePtr->NumPending) %
+		QueuePtr->PendingSize] = Buf;
+	QueuePtr->NumPending++;
+
+	return XAIE_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API retires the completed buffers of the queue, issues the waiting
+* buffers to the freed BDs, and then calls the callbacks of the completed
+* buffers, oldest first. It doesn't wait.
+*
+* @param	QueuePtr - Pointer to the queue instance.
+*
+* @return	Number of buffers completed.
+*
+* @note		The callbacks may submit buffers to the queue, but must not
+*		poll it.
+*
+*******************************************************************************/
+u32 XAieDma_ShimQueuePoll(XAieDma_ShimQueue *QueuePtr)
+{
+	XAieDma_ShimQueueBuf Done[XAIEDMA_SHIM_MAX_NUM_DESCRS];
+	XAieDma_ShimQueueBuf *BufPtr;
+	u8 UseLocks;
+	u8 IsS2mm;
+	u8 Pending;
+	u8 NumDone = 0U;
+	u8 Idx;
+
+	XAie_AssertNonvoid(QueuePtr != XAIE_NULL);
+
+	if (QueuePtr->NumIssued == 0U) {
+		return 0U;
+	}
+
+	UseLocks = (QueuePtr->Flags & XAIEDMA_SHIMQ_FLAG_LOCKS) != 0U;
+	IsS2mm = XAIEDMA_SHIMQ_IS_S2MM(QueuePtr->ChNum);
+
+	/* The BDs are processed in order, and not chained */
+	Pending = XAieDma_ShimPendingBdCount(QueuePtr->DmaInstPtr,
+			QueuePtr->ChNum);
+	if (Pending < QueuePtr->NumIssued) {
+		NumDone = QueuePtr->NumIssued - Pending;
+	}
+
+	if (UseLocks && IsS2mm) {
+		/* Take the buffers written by the DMA */
+		for (Idx = 0U; Idx < NumDone; Idx++) {
+			BufPtr = &QueuePtr->Issued[(QueuePtr->IssuedHead + Idx) %
+				XAIEDMA_SHIM_MAX_NUM_DESCRS];
+			if (XAieTile_LockAcquire(QueuePtr->TileInstPtr,
+					BufPtr->BdNum, XAIETILE_LOCK_ACQ_VAL1,
+					0U) == 0U) {
+				break;
+			}
+		}
+		NumDone = Idx;
+	}
+
+	for (Idx = 0U; Idx < NumDone; Idx++) {
+		Done[Idx] = QueuePtr->Issued[QueuePtr->IssuedHead];
+		QueuePtr->IssuedHead = (QueuePtr->IssuedHead + 1U) %
+			XAIEDMA_SHIM_MAX_NUM_DESCRS;
+		QueuePtr->NumIssued--;
+	}
+	QueuePtr->Completed += NumDone;
+
+	_XAieDma_ShimQueueRefill(QueuePtr);
+
+	for (Idx = 0U; Idx < NumDone; Idx++) {
+		if (Done[Idx].Callback != XAIE_NULL) {
+			Done[Idx].Callback(QueuePtr, Done[Idx].CbData,
+					Done[Idx].Addr, Done[Idx].Length);
+		}
+		if (UseLocks && IsS2mm) {
+			/* The buffer is consumed, let the DMA reuse the BD */
+			XAieTile_LockRelease(QueuePtr->TileInstPtr,
+					Done[Idx].BdNum,
+					XAIETILE_LOCK_REL_VAL0, 0U);
+		}
+	}
+
+	return NumDone;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API polls a set of queues, ex, the channels of a stream, until all
+* their buffers are completed or time out happens.
+*
+* @param	QueuePtrs - Array of pointers to the queue instances.
+* @param	NumQueues - Number of queues.
+* @param	TimeOut - Minimum timeout value in micro seconds. If 0, the
+*		default timeout of 1 second is used.
+*
+* @return	XAIE_SUCCESS if all the buffers are completed, else
+*		XAIE_FAILURE.
+*
+* @note		The callbacks are called from this function.
+*
+*******************************************************************************/
+u32 XAieDma_ShimQueueWaitAll(XAieDma_ShimQueue **QueuePtrs, u8 NumQueues,
+		u32 TimeOut)
+{
+	u32 Count;
+	u8 Busy;
+	u8 Idx;
+
+	XAie_AssertNonvoid(QueuePtrs != XAIE_NULL);
+
+	if (TimeOut == 0U) {
+		TimeOut = XAIEDMA_SHIMQ_DONE_DEF_WAIT_USECS;
+	}
+	Count = (TimeOut + XAIEDMA_SHIMQ_POLL_USECS - 1U) /
+		XAIEDMA_SHIMQ_POLL_USECS;
+
+	while (1) {
+		Busy = 0U;
+		for (Idx = 0U; Idx < NumQueues; Idx++) {
+			XAieDma_ShimQueuePoll(QueuePtrs[Idx]);
+			if (XAieDma_ShimQueueCount(QueuePtrs[Idx]) != 0U) {
+				Busy = 1U;
+			}
+		}
+
+		if (!Busy) {
+			return XAIE_SUCCESS;
+		}
+		if (Count == 0U) {
+			return XAIE_FAILURE;
+		}
+
+		XAie_usleep(XAIEDMA_SHIMQ_POLL_USECS);
+		Count--;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API polls the queue until all its buffers are completed or time out
+* happens.
+*
+* @param	QueuePtr - Pointer to the queue instance.
+* @param	TimeOut - Minimum timeout value in micro seconds. If 0, the
+*		default timeout of 1 second is used.
+*
+* @return	XAIE_SUCCESS if all the buffers are completed, else
+*		XAIE_FAILURE.
+*
+* @note		The callbacks are called from this function.
+*
+*******************************************************************************/
+u32 XAieDma_ShimQueueWait(XAieDma_ShimQueue *QueuePtr, u32 TimeOut)
+{
+	return XAieDma_ShimQueueWaitAll(&QueuePtr, 1U, TimeOut);
+}
+
+/** @} */
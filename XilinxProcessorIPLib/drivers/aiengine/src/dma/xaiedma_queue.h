@@ -0,0 +1,109 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaiedma_queue.h
+* @{
+*
+* Header file for the Shim DMA buffer queue.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0  agt     10/17/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+#ifndef XAIEDMA_QUEUE_H
+#define XAIEDMA_QUEUE_H
+
+/***************************** Include Files *********************************/
+#include "xaiedma_shim.h"
+
+/***************************** Constant Definitions **************************/
+/* Synchronize each BD with the shim lock of the same index */
+#define XAIEDMA_SHIMQ_FLAG_LOCKS		0x1U
+
+/* BDs of a channel when no BD mask is given */
+#define XAIEDMA_SHIMQ_DEF_BDS_PER_CH		4U
+
+/**************************** Type Definitions *******************************/
+struct XAieDma_ShimQueue;
+
+/**
+ * This typedef is the completion callback of a buffer.
+ */
+typedef void (*XAieDma_ShimQueueCb)(struct XAieDma_ShimQueue *QueuePtr,
+		void *CbData, u64 Addr, u32 Length);
+
+/**
+ * This typedef contains a buffer submitted to the queue.
+ */
+typedef struct
+{
+	u64 Addr;			/**< Address of the buffer */
+	u32 Length;			/**< Length of the buffer in bytes */
+	u8 BdNum;			/**< BD of the buffer, when issued */
+	XAieDma_ShimQueueCb Callback;	/**< Completion callback, or NULL */
+	void *CbData;			/**< Data passed to the callback */
+} XAieDma_ShimQueueBuf;
+
+/**
+ * This typedef is the Shim DMA queue instance of a channel. User is required
+ * to allocate memory for this instance and a pointer of the same is passed
+ * to the queue functions. The queues of the channels of a Shim DMA need to
+ * use disjoint BDs.
+ */
+typedef struct XAieDma_ShimQueue
+{
+	XAieGbl_Tile *TileInstPtr;	/**< Shim tile of the DMA */
+	XAieDma_Shim *DmaInstPtr;	/**< Shim DMA instance */
+	u8 ChNum;			/**< Channel of the queue */
+	u8 Flags;			/**< XAIEDMA_SHIMQ_FLAG_* */
+	u8 Bds[XAIEDMA_SHIM_MAX_NUM_DESCRS];	/**< BDs of the queue */
+	u8 NumBds;			/**< Number of BDs */
+	u8 NextBd;			/**< Index of the next BD to issue */
+	u8 MaxIssued;			/**< Maximum number of buffers issued */
+	XAieDma_ShimQueueBuf Issued[XAIEDMA_SHIM_MAX_NUM_DESCRS]; /**< Buffers in the DMA, oldest first */
+	u8 IssuedHead;			/**< Index of the oldest issued buffer */
+	u8 NumIssued;			/**< Number of buffers in the DMA */
+	XAieDma_ShimQueueBuf *Pending;	/**< Buffers waiting for a BD */
+	u32 PendingSize;		/**< Size of the pending ring */
+	u32 PendingHead;		/**< Index of the oldest pending buffer */
+	u32 NumPending;			/**< Number of pending buffers */
+	u64 Completed;			/**< Buffers completed */
+} XAieDma_ShimQueue;
+
+/***************************** Macro Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* Macro to get the number of buffers of the queue not completed yet.
+*
+* @param	QueuePtr - Pointer to the queue instance.
+*
+* @return	Number of buffers pending or in the DMA.
+*
+* @note		None.
+*
+*******************************************************************************/
+#define XAieDma_ShimQueueCount(QueuePtr)				\
+			((QueuePtr)->NumPending + (QueuePtr)->NumIssued)
+
+/************************** Function Prototypes  *****************************/
+u32 XAieDma_ShimQueueInitialize(XAieDma_ShimQueue *QueuePtr, XAieGbl_Tile *TileInstPtr, XAieDma_Shim *DmaInstPtr, u8 ChNum, u16 BdMask, u8 Flags);
+void XAieDma_ShimQueueFinish(XAieDma_ShimQueue *QueuePtr);
+u32 XAieDma_ShimQueueSubmit(XAieDma_ShimQueue *QueuePtr, u64 Addr, u32 Length, XAieDma_ShimQueueCb Callback, void *CbData);
+u32 XAieDma_ShimQueuePoll(XAieDma_ShimQueue *QueuePtr);
+u32 XAieDma_ShimQueueWait(XAieDma_ShimQueue *QueuePtr, u32 TimeOut);
+u32 XAieDma_ShimQueueWaitAll(XAieDma_ShimQueue **QueuePtrs, u8 NumQueues, u32 TimeOut);
+
+#endif		/* end of protection macro */
+
+/** @} */
@@ -22,6 +22,7 @@
 * 1.3  Nishad  12/05/2018  Renamed ME attributes to AIE
 * 1.4  Hyun    01/08/2019  Add the mask poll function
 * 1.5  Tejus   10/14/2019  Enable assertion for linux and simulation
+* 1.6  agt     10/17/2026  Add the multi tile ELF loader
 * </pre>
 *
 ******************************************************************************/
@@ -63,6 +64,10 @@
 #define XAieGbl_MaskPoll                 XAieLib_MaskPoll
 #define XAieGbl_LoadElf                  XAieLib_LoadElf
 #define XAieGbl_LoadElfMem               XAieLib_LoadElfMem
+#define XAieGbl_LoadElfMulti             XAieLib_LoadElfMulti
+#define XAieGbl_ElfOpenMem               XAieLib_ElfOpenMem
+#define XAieGbl_ElfOpenFile              XAieLib_ElfOpenFile
+#define XAieGbl_ElfClose                 XAieLib_ElfClose
 
 #define XAieGbl_NPIRead32                XAieLib_NPIRead32
 #define XAieGbl_NPIWrite32               XAieLib_NPIWrite32
@@ -38,9 +38,13 @@
 * 2.6  Tejus   10/14/2019  Enable assertion for linux and simulation
 * 2.7  Wendy   02/25/2020  Add logging API
 * 2.8  Tejus   04/17/2020  Fix variable overflow issue.
+* 2.9  agt     10/17/2026  Route the register IO through the transaction
+*                          buffer and the shadow register cache, and add the
+*                          multi tile ELF loader hooks
 * </pre>
 *
 ******************************************************************************/
+#include "xaiegbl.h"
 #include "xaiegbl_defs.h"
 #include "xaielib.h"
 #include "xaielib_npi.h"
@@ -201,6 +205,8 @@ int XAieLib_usleep(u64 Usec)
 *******************************************************************************/
 u32 XAieLib_LoadElf(XAieGbl_Tile *TileInstPtr, u8 *ElfPtr, u8 LoadSym)
 {
+	XAieLib_ElfInvalidateTile(TileInstPtr->TileAddr);
+
 #ifdef __AIESIM__
 	return XAieSim_LoadElf(TileInstPtr, ElfPtr, LoadSym);
 #elif defined __AIEBAREMTL__
@@ -226,6 +232,8 @@ u32 XAieLib_LoadElf(XAieGbl_Tile *TileInstPtr, u8 *ElfPtr, u8 LoadSym)
 *******************************************************************************/
 u32 XAieLib_LoadElfMem(XAieGbl_Tile *TileInstPtr, u8 *ElfPtr, u8 LoadSym)
 {
+	XAieLib_ElfInvalidateTile(TileInstPtr->TileAddr);
+
 #ifdef __AIESIM__
 	return XAIELIB_FAILURE;
 #elif defined __AIEBAREMTL__
@@ -892,6 +900,40 @@ u32 XAieLib_MemRead32(XAieLib_MemInst *XAieLib_MemInstPtr, u64 Addr)
 *
 *******************************************************************************/
 u32 XAieLib_Read32(u64 Addr)
+{
+	u32 Data;
+	u32 Ret;
+
+	/* The cache is written through, so it is current with pending writes */
+	Ret = XAieLib_ShadowLookup(Addr, &Data);
+	if (Ret == XAIELIB_SHADOW_HIT) {
+		return Data;
+	}
+
+	XAieLib_TxnFlush();
+
+	Data = XAieLib_IORead32(Addr);
+	if (Ret == XAIELIB_SHADOW_MISS) {
+		XAieLib_ShadowUpdate(Addr, Data);
+	}
+
+	return Data;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to read 32bit data from the specified address
+* of the device, bypassing the transaction buffer.
+*
+* @param	Addr: Address to read from.
+*
+* @return	32-bit read value.
+*
+* @note		None.
+*
+*******************************************************************************/
+u32 XAieLib_IORead32(u64 Addr)
 {
 #ifdef __AIESIM__
 	return(XAieSim_Read32(Addr));
@@ -919,6 +961,8 @@ void XAieLib_Read128(u64 Addr, u32 *Data)
 {
 	u8 Idx;
 
+	XAieLib_TxnFlush();
+
 	for(Idx = 0U; Idx < 4U; Idx++) {
 #ifdef __AIESIM__
 		Data[Idx] = XAieSim_Read32(Addr + Idx*4U);
@@ -944,6 +988,31 @@ void XAieLib_Read128(u64 Addr, u32 *Data)
 *
 *******************************************************************************/
 void XAieLib_Write32(u64 Addr, u32 Data)
+{
+	XAieLib_ShadowUpdate(Addr, Data);
+
+	if (XAieLib_TxnWrite32(Addr, Data) == XAIELIB_SUCCESS) {
+		return;
+	}
+
+	XAieLib_IOWrite32(Addr, Data);
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to write 32bit data to the specified address
+* of the device, bypassing the transaction buffer.
+*
+* @param	Addr: Address to write to.
+* @param	Data: 32-bit data to be written.
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+void XAieLib_IOWrite32(u64 Addr, u32 Data)
 {
 #ifdef __AIESIM__
 	XAieSim_Write32(Addr, Data);
@@ -970,6 +1039,46 @@ void XAieLib_Write32(u64 Addr, u32 Data)
 *
 *******************************************************************************/
 void XAieLib_MaskWrite32(u64 Addr, u32 Mask, u32 Data)
+{
+	u32 RegVal;
+	u32 Ret;
+
+	/* Cached registers are read at most once, then only written */
+	Ret = XAieLib_ShadowLookup(Addr, &RegVal);
+	if (Ret != XAIELIB_SHADOW_BYPASS) {
+		if (Ret == XAIELIB_SHADOW_MISS) {
+			XAieLib_TxnFlush();
+			RegVal = XAieLib_IORead32(Addr);
+		}
+		RegVal &= ~Mask;
+		RegVal |= Data;
+		XAieLib_Write32(Addr, RegVal);
+		return;
+	}
+
+	if (XAieLib_TxnMaskWrite32(Addr, Mask, Data) == XAIELIB_SUCCESS) {
+		return;
+	}
+
+	XAieLib_IOMaskWrite32(Addr, Mask, Data);
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to write a masked 32bit data to
+* the specified address of the device, bypassing the transaction buffer.
+*
+* @param	Addr: Address to write to.
+* @param	Mask: Mask to be applied to Data.
+* @param	Data: 32-bit data to be written.
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+void XAieLib_IOMaskWrite32(u64 Addr, u32 Mask, u32 Data)
 {
 	u32 RegVal;
 
@@ -1002,6 +1111,35 @@ void XAieLib_MaskWrite32(u64 Addr, u32 Mask, u32 Data)
 *
 *******************************************************************************/
 void XAieLib_Write128(u64 Addr, u32 *Data)
+{
+	u8 Idx;
+
+	for (Idx = 0U; Idx < 4U; Idx++) {
+		XAieLib_ShadowUpdate(Addr + Idx * 4U, Data[Idx]);
+	}
+
+	if (XAieLib_TxnWrite128(Addr, Data) == XAIELIB_SUCCESS) {
+		return;
+	}
+
+	XAieLib_IOWrite128(Addr, Data);
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the memory IO function to write 128bit data to the specified address
+* of the device, bypassing the transaction buffer.
+*
+* @param	Addr: Address to write to.
+* @param	Data: Pointer to the 128-bit data buffer.
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+void XAieLib_IOWrite128(u64 Addr, u32 *Data)
 {
 #ifdef __AIESIM__
 	XAieSim_Write128(Addr, Data);
@@ -1032,6 +1170,8 @@ void XAieLib_Write128(u64 Addr, u32 *Data)
 void XAieLib_WriteCmd(u8 Command, u8 ColId, u8 RowId, u32 CmdWd0,
 						u32 CmdWd1, u8 *CmdStr)
 {
+	XAieLib_TxnFlush();
+
 #ifdef __AIESIM__
 	XAieSim_WriteCmd(Command, ColId, RowId, CmdWd0, CmdWd1, CmdStr);
 #elif defined __AIEBAREMTL__
@@ -1058,6 +1198,8 @@ u32 XAieLib_MaskPoll(u64 Addr, u32 Mask, u32 Value, u32 TimeOutUs)
 {
 	u32 Ret = XAIELIB_FAILURE;
 
+	XAieLib_TxnFlush();
+
 #ifdef __AIESIM__
 	if (XAieSim_MaskPoll(Addr, Mask, Value, TimeOutUs) == XAIESIM_SUCCESS) {
 		Ret = XAIELIB_SUCCESS;
@@ -1073,7 +1215,7 @@ u32 XAieLib_MaskPoll(u64 Addr, u32 Mask, u32 Value, u32 TimeOutUs)
 	Count = ((u64)TimeOutUs + MinTimeOutUs - 1) / MinTimeOutUs;
 
 	while (Count > 0U) {
-		if ((XAieLib_Read32(Addr) & Mask) == Value) {
+		if ((XAieLib_IORead32(Addr) & Mask) == Value) {
 			Ret = XAIELIB_SUCCESS;
 			break;
 		}
@@ -1083,7 +1225,7 @@ u32 XAieLib_MaskPoll(u64 Addr, u32 Mask, u32 Value, u32 TimeOutUs)
 
 	/* Check for the break from timed-out loop */
 	if ((Ret == XAIELIB_FAILURE) &&
-			((XAieLib_Read32(Addr) & Mask) == Value)) {
+			((XAieLib_IORead32(Addr) & Mask) == Value)) {
 		Ret = XAIELIB_SUCCESS;
 	}
 #endif
@@ -1104,6 +1246,9 @@ u32 XAieLib_MaskPoll(u64 Addr, u32 Mask, u32 Value, u32 TimeOutUs)
 *******************************************************************************/
 u32 XAieLib_NPIRead32(u64 Addr)
 {
+	/* Keep the NPI accesses ordered with the pending writes */
+	XAieLib_TxnFlush();
+
 #ifdef __AIESIM__
 	return XAieSim_NPIRead32(Addr);
 #elif defined __AIEBAREMTL__
@@ -1160,6 +1305,13 @@ static void XAieLib_NPISetLock(u8 Lock)
 *******************************************************************************/
 void XAieLib_NPIWrite32(u64 Addr, u32 Data)
 {
+	/* Keep the NPI accesses ordered with the pending writes */
+	XAieLib_TxnFlush();
+
+	/* NPI writes may reset the array */
+	XAieLib_ShadowInvalidateAll();
+	XAieLib_ElfInvalidateAll();
+
 	XAieLib_NPISetLock(0);
 #ifdef __AIESIM__
 	XAieSim_NPIWrite32(Addr, Data);
@@ -1190,6 +1342,13 @@ void XAieLib_NPIMaskWrite32(u64 Addr, u32 Mask, u32 Data)
 {
 	u32 RegVal;
 
+	/* Keep the NPI accesses ordered with the pending writes */
+	XAieLib_TxnFlush();
+
+	/* NPI writes may reset the array */
+	XAieLib_ShadowInvalidateAll();
+	XAieLib_ElfInvalidateAll();
+
 	XAieLib_NPISetLock(0);
 #ifdef __AIESIM__
 	XAieSim_NPIMaskWrite32(Addr, Mask, Data);
@@ -26,6 +26,8 @@
 * 1.7  Hyun    01/08/2019  Add XAieLib_MaskPoll()
 * 1.8  Tejus   10/14/2019  Enable assertion for linux and simulation
 * 1.9  Wendy   02/25/2020  Add Logging API
+* 2.0  agt     10/17/2026  Add the transaction buffer, shadow register cache
+*                          and multi tile ELF loader APIs
 * </pre>
 *
 ******************************************************************************/
@@ -59,6 +61,54 @@ typedef enum {
 	XAIELIB_LOGERROR
 } XAieLib_LogLevel;
 
+/* Default size of the transaction command buffer */
+#define XAIELIB_TXN_DEF_CMDS		1024U
+
+/*
+ * Statistics of a transaction, see xaielib_txn.c
+ */
+typedef struct {
+	u64 Recorded;		/**< Writes recorded */
+	u64 Merged;		/**< Writes merged into the previous command */
+	u64 ShadowHits;		/**< Mask writes resolved without a read */
+	u64 Reads;		/**< Device reads for mask writes */
+	u64 Writes;		/**< 32 bit writes issued */
+	u64 BlockWrites;	/**< 128 bit writes issued */
+	u64 Flushes;		/**< Flushes of the command buffer */
+} XAieLib_TxnStats;
+
+/* Register types returned by XAieLib_RegType(), see xaielib_shadow.c */
+#define XAIELIB_REG_CACHED		0U
+#define XAIELIB_REG_VOLATILE		1U
+#define XAIELIB_REG_ACTION		2U
+
+/* Results of XAieLib_ShadowLookup() */
+#define XAIELIB_SHADOW_HIT		0U
+#define XAIELIB_SHADOW_MISS		1U
+#define XAIELIB_SHADOW_BYPASS		2U
+
+/*
+ * Statistics of the shadow register cache, see xaielib_shadow.c
+ */
+typedef struct {
+	u64 Hits;		/**< Accesses resolved without a read */
+	u64 Misses;		/**< Accesses of cached registers not known yet */
+	u64 Bypassed;		/**< Accesses of volatile registers */
+	u64 Invalidations;	/**< Tile tables dropped */
+} XAieLib_ShadowStats;
+
+/* Default number of threads of XAieLib_LoadElfMulti() */
+#define XAIELIB_ELF_DEF_THREADS		4U
+
+/*
+ * Statistics of XAieLib_LoadElfMulti(), see xaielib_elf.c
+ */
+typedef struct {
+	u64 Loaded;		/**< Sections written, per tile */
+	u64 Skipped;		/**< Program sections already in the tile */
+	u64 Bytes;		/**< Bytes written */
+} XAieLib_ElfLoadStats;
+
 /************************** Variable Definitions *****************************/
 
 /************************** Function Prototypes  *****************************/
@@ -70,6 +120,29 @@ void XAieLib_Write128(u64 Addr, u32 *Data);
 void XAieLib_WriteCmd(u8 Command, u8 ColId, u8 RowId, u32 CmdWd0, u32 CmdWd1, u8 *CmdStr);
 u32 XAieLib_MaskPoll(u64 Addr, u32 Mask, u32 Value, u32 TimeOutUs);
 
+/* Device IO, bypassing the transaction buffer */
+u32 XAieLib_IORead32(u64 Addr);
+void XAieLib_IOWrite32(u64 Addr, u32 Data);
+void XAieLib_IOMaskWrite32(u64 Addr, u32 Mask, u32 Data);
+void XAieLib_IOWrite128(u64 Addr, u32 *Data);
+
+u32 XAieLib_TxnStart(u32 MaxCmds);
+void XAieLib_TxnFlush(void);
+u32 XAieLib_TxnEnd(XAieLib_TxnStats *StatsPtr);
+u32 XAieLib_TxnWrite32(u64 Addr, u32 Data);
+u32 XAieLib_TxnMaskWrite32(u64 Addr, u32 Mask, u32 Data);
+u32 XAieLib_TxnWrite128(u64 Addr, u32 *Data);
+u8 XAieLib_TxnIsActive(void);
+
+u32 XAieLib_ShadowEnable(void);
+void XAieLib_ShadowDisable(void);
+void XAieLib_ShadowInvalidateTile(u64 TileAddr);
+void XAieLib_ShadowInvalidateAll(void);
+void XAieLib_ShadowGetStats(XAieLib_ShadowStats *StatsPtr);
+u32 XAieLib_ShadowLookup(u64 Addr, u32 *ValPtr);
+void XAieLib_ShadowUpdate(u64 Addr, u32 Val);
+u32 XAieLib_RegType(u64 Addr);
+
 u32 XAieLib_NPIRead32(u64 Addr);
 void XAieLib_NPIWrite32(u64 Addr, u32 Data);
 u32 XAieLib_NPIMaskPoll(u64 Addr, u32 Mask, u32 Value, u32 TimeOutUs);
@@ -84,6 +157,18 @@ typedef struct XAieGbl_Tile XAieGbl_Tile;
 u32 XAieLib_LoadElf(XAieGbl_Tile *TileInstPtr, u8 *ElfPtr, u8 LoadSym);
 u32 XAieLib_LoadElfMem(XAieGbl_Tile *TileInstPtr, u8 *ElfPtr, u8 LoadSym);
 
+struct XAieLib_ElfImg;
+typedef struct XAieLib_ElfImg XAieLib_ElfImg;
+
+XAieLib_ElfImg *XAieLib_ElfOpenMem(u8 *ElfPtr, u32 Size);
+XAieLib_ElfImg *XAieLib_ElfOpenFile(const char *Path);
+void XAieLib_ElfClose(XAieLib_ElfImg *ImgPtr);
+u32 XAieLib_LoadElfMulti(XAieGbl_Tile **TileInstPtrs, u32 NumTiles,
+		XAieLib_ElfImg *ImgPtr, u32 NumThreads,
+		XAieLib_ElfLoadStats *StatsPtr);
+void XAieLib_ElfInvalidateTile(u64 TileAddr);
+void XAieLib_ElfInvalidateAll(void);
+
 void XAieLib_InitDev(void);
 u32 XAieLib_InitTile(XAieGbl_Tile *TileInstPtr);
 
@@ -0,0 +1,750 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaielib_elf.c
+* @{
+*
+* This file contains the multi tile ELF loader of the AIE driver.
+*
+* XAieLib_ElfOpenMem() or XAieLib_ElfOpenFile() parses an ELF once into a list
+* of loadable sections. XAieLib_LoadElfMulti() then writes the image to any
+* number of tiles:
+* - the memories are written with 128 bit block writes,
+* - a program memory section which is already in a tile, from a previous
+*   XAieLib_LoadElfMulti() of the same content, is skipped,
+* - on Linux, the tiles are split among several threads.
+* The data and bss sections are always written, as the kernels modify them.
+*
+* The loaded program memory sections of each tile are recorded. The record of
+* a tile is dropped when its column is reset through the driver, on any NPI
+* write, when the tile is loaded with XAieLib_LoadElf() or
+* XAieLib_LoadElfMem(), and by XAieLib_ElfInvalidateTile() or
+* XAieLib_ElfInvalidateAll(), which must be called if the program memory is
+* written or reset by other means.
+*
+* Unlike XAieLib_LoadElf() for the simulator, the stack range and the symbols
+* are not sent to the simulator.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0  agt     10/17/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#include "xaiegbl.h"
+#include "xaielib.h"
+#include <stdlib.h>
+#include <string.h>
+#ifndef __AIEBAREMTL__
+#include <pthread.h>
+#include <stdio.h>
+#endif
+
+/***************************** Macro Definitions *****************************/
+/* Only the Linux IO and the host memory model of the simulator are reentrant */
+#if !defined(__AIEBAREMTL__) && \
+	(!defined(__AIESIM__) || defined(__AIESIM_HOSTMEM__))
+#define XAIELIB_ELF_THREADS
+#endif
+
+#define XAIELIB_ELF_MAX_THREADS		16U
+
+/* ELF32 definitions used by the loader */
+#define XAIELIB_ELF_SHT_PROGBITS	1U
+#define XAIELIB_ELF_SHT_NOBITS		8U
+#define XAIELIB_ELF_SHF_WRITE		0x1U
+#define XAIELIB_ELF_SHF_ALLOC		0x2U
+#define XAIELIB_ELF_SHF_EXECINSTR	0x4U
+
+/* Sections at or below this address are in the program memory */
+#define XAIELIB_ELF_PRGMEM_MAX		0x1FFFFU
+
+/* Data memory: 32 KB banks, one per cardinal direction */
+#define XAIELIB_ELF_DMB_MASK		0x7FFFU
+#define XAIELIB_ELF_DMB_SIZE		0x8000U
+#define XAIELIB_ELF_DMB_CARD_OFF	0x18000U
+#define XAIELIB_ELF_DMB_CARD_SHIFT	15U
+
+#define XAIELIB_ELF_NUM_TILES		(1U << 12U)
+
+#define XAIELIB_ELF_SECT_PRGMEM		0U
+#define XAIELIB_ELF_SECT_DATMEM		1U
+#define XAIELIB_ELF_SECT_BSS		2U
+
+/************************** Variable Definitions *****************************/
+typedef struct {
+	u8 e_ident[16];
+	u16 e_type;
+	u16 e_machine;
+	u32 e_version;
+	u32 e_entry;
+	u32 e_phoff;
+	u32 e_shoff;
+	u32 e_flags;
+	u16 e_ehsize;
+	u16 e_phentsize;
+	u16 e_phnum;
+	u16 e_shentsize;
+	u16 e_shnum;
+	u16 e_shstrndx;
+} XAieLib_ElfEhdr;
+
+typedef struct {
+	u32 sh_name;
+	u32 sh_type;
+	u32 sh_flags;
+	u32 sh_addr;
+	u32 sh_offset;
+	u32 sh_size;
+	u32 sh_link;
+	u32 sh_info;
+	u32 sh_addralign;
+	u32 sh_entsize;
+} XAieLib_ElfShdr;
+
+typedef struct {
+	u8 Type;	/**< XAIELIB_ELF_SECT_* */
+	u32 Addr;	/**< Load address in the ELF */
+	u32 Size;	/**< Size in bytes, multiple of 4 */
+	u32 *Data;	/**< Content, NULL for bss */
+	u64 Hash;	/**< Hash of the address and the content */
+} XAieLib_ElfSect;
+
+struct XAieLib_ElfImg {
+	u32 NumSects;			/**< Loadable sections */
+	XAieLib_ElfSect *Sects;		/**< Sections */
+};
+
+typedef struct {
+	u32 NumSects;	/**< Program memory sections in the tile */
+	u64 *Hashes;	/**< Hashes of the sections */
+} XAieLib_ElfLoaded;
+
+typedef struct {
+	XAieGbl_Tile **TileInstPtrs;	/**< Tiles of this worker */
+	u32 NumTiles;			/**< Number of tiles */
+	XAieLib_ElfImg *ImgPtr;		/**< Image to load */
+	XAieLib_ElfLoadStats Stats;	/**< Statistics of this worker */
+	u32 Ret;			/**< Result */
+} XAieLib_ElfWork;
+
+/* Program memory sections loaded in each tile, indexed by column / row */
+static XAieLib_ElfLoaded *XAieLib_ElfLoadedTiles[XAIELIB_ELF_NUM_TILES];
+
+extern XAieGbl_Config XAieGbl_ConfigTable[];
+
+/************************** Function Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to get the index of a tile in the record.
+*
+* @param	TileAddr: Base address of the tile.
+*
+* @return	Index of the tile.
+*
+* @note		Used only in this file.
+*
+*******************************************************************************/
+static inline u32 XAieLib_ElfTileIdx(u64 TileAddr)
+{
+	return (u32)(TileAddr >> XAIEGBL_TILE_ADDR_ROW_SHIFT) &
+		(XAIELIB_ELF_NUM_TILES - 1U);
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to hash a section.
+*
+* @param	Addr: Load address of the section.
+* @param	Data: Content of the section.
+* @param	NumWords: Size of the section in words.
+*
+* @return	64 bit FNV-1a hash.
+*
+* @note		Used only in this file.
+*
+*******************************************************************************/
+static u64 XAieLib_ElfHash(u32 Addr, const u32 *Data, u32 NumWords)
+{
+	u64 Hash = 0xCBF29CE484222325ULL;
+	u32 Idx;
+
+	Hash = (Hash ^ Addr) * 0x100000001B3ULL;
+	Hash = (Hash ^ NumWords) * 0x100000001B3ULL;
+	for (Idx = 0U; Idx < NumWords; Idx++) {
+		Hash = (Hash ^ Data[Idx]) * 0x100000001B3ULL;
+	}
+
+	return Hash;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API parses an ELF in memory into a loadable image.
+*
+* @param	ElfPtr: Pointer to the ELF in memory.
+* @param	Size: Size of the ELF in bytes.
+*
+* @return	Pointer to the image, NULL if the ELF is invalid or the memory
+*		can't be allocated.
+*
+* @note		The section header table and the loaded sections are checked
+*		to lie within the buffer. The ELF can be freed once the image
+*		is created.
+*
+*******************************************************************************/
+XAieLib_ElfImg *XAieLib_ElfOpenMem(u8 *ElfPtr, u32 Size)
+{
+	XAieLib_ElfEhdr ElfHdr;
+	XAieLib_ElfShdr SectHdr;
+	XAieLib_ElfImg *ImgPtr;
+	XAieLib_ElfSect *SectPtr;
+	u32 Count;
+
+	if (ElfPtr == NULL || Size < sizeof(ElfHdr)) {
+		XAieLib_print("ERROR: Invalid ELF\n");
+		return NULL;
+	}
+
+	memcpy(&ElfHdr, ElfPtr, sizeof(ElfHdr));
+	if (ElfHdr.e_ident[0] != 0x7FU || ElfHdr.e_ident[1] != 'E' ||
+			ElfHdr.e_ident[2] != 'L' || ElfHdr.e_ident[3] != 'F') {
+		XAieLib_print("ERROR: Invalid ELF\n");
+		return NULL;
+	}
+
+	if (ElfHdr.e_shnum == 0U ||
+			ElfHdr.e_shentsize < sizeof(XAieLib_ElfShdr) ||
+			ElfHdr.e_shoff > Size ||
+			(u64)ElfHdr.e_shnum * ElfHdr.e_shentsize >
+			Size - ElfHdr.e_shoff) {
+		XAieLib_print("ERROR: Invalid ELF section headers\n");
+		return NULL;
+	}
+
+	ImgPtr = malloc(sizeof(*ImgPtr));
+	if (ImgPtr == NULL) {
+		return NULL;
+	}
+	ImgPtr->NumSects = 0U;
+	ImgPtr->Sects = calloc(ElfHdr.e_shnum, sizeof(*ImgPtr->Sects));
+	if (ImgPtr->Sects == NULL) {
+		free(ImgPtr);
+		return NULL;
+	}
+
+	for (Count = 0U; Count < ElfHdr.e_shnum; Count++) {
+		memcpy(&SectHdr, ElfPtr + ElfHdr.e_shoff +
+				Count * ElfHdr.e_shentsize, sizeof(SectHdr));
+		SectPtr = &ImgPtr->Sects[ImgPtr->NumSects];
+
+		/* Same selection as XAieSim_LoadElfMem() */
+		if (SectHdr.sh_type == XAIELIB_ELF_SHT_PROGBITS &&
+				SectHdr.sh_flags != 0U) {
+			if (SectHdr.sh_flags == (XAIELIB_ELF_SHF_ALLOC |
+						XAIELIB_ELF_SHF_EXECINSTR)) {
+				SectPtr->Type = XAIELIB_ELF_SECT_PRGMEM;
+			} else if (SectHdr.sh_flags == XAIELIB_ELF_SHF_ALLOC ||
+					SectHdr.sh_flags ==
+					(XAIELIB_ELF_SHF_ALLOC |
+					 XAIELIB_ELF_SHF_WRITE)) {
+				SectPtr->Type = XAIELIB_ELF_SECT_DATMEM;
+			} else {
+				XAieLib_print("ERROR: Invalid section flags "
+						"0x%x\n", SectHdr.sh_flags);
+				continue;
+			}
+		} else if (SectHdr.sh_type == XAIELIB_ELF_SHT_NOBITS &&
+				SectHdr.sh_addr > XAIELIB_ELF_PRGMEM_MAX) {
+			SectPtr->Type = XAIELIB_ELF_SECT_BSS;
+		} else {
+			continue;
+		}
+
+		SectPtr->Addr = SectHdr.sh_addr;
+		SectPtr->Size = (SectHdr.sh_size + 3U) & ~3U;
+		if (SectPtr->Size == 0U) {
+			continue;
+		}
+
+		if (SectPtr->Type != XAIELIB_ELF_SECT_BSS) {
+			if (SectHdr.sh_offset > Size ||
+					SectHdr.sh_size > Size - SectHdr.sh_offset) {
+				XAieLib_print("ERROR: Invalid ELF section\n");
+				XAieLib_ElfClose(ImgPtr);
+				return NULL;
+			}
+			SectPtr->Data = calloc(SectPtr->Size / 4U, sizeof(u32));
+			if (SectPtr->Data == NULL) {
+				XAieLib_ElfClose(ImgPtr);
+				return NULL;
+			}
+			memcpy(SectPtr->Data, ElfPtr + SectHdr.sh_offset,
+					SectHdr.sh_size);
+			SectPtr->Hash = XAieLib_ElfHash(SectPtr->Addr,
+					SectPtr->Data, SectPtr->Size / 4U);
+		}
+		ImgPtr->NumSects++;
+	}
+
+	return ImgPtr;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API parses an ELF file into a loadable image.
+*
+* @param	Path: Path to the ELF file.
+*
+* @return	Pointer to the image, NULL if the file can't be read, the ELF is
+*		invalid or the memory can't be allocated.
+*
+* @note		Returns NULL on baremetal, where there's no file system.
+*
+*******************************************************************************/
+XAieLib_ElfImg *XAieLib_ElfOpenFile(const char *Path)
+{
+#ifdef __AIEBAREMTL__
+	return NULL;
+#else
+	XAieLib_ElfImg *ImgPtr = NULL;
+	FILE *Fd;
+	long Size;
+	u8 *ElfPtr;
+
+	Fd = fopen(Path, "rb");
+	if (Fd == NULL) {
+		XAieLib_print("ERROR: Invalid ELF file\n");
+		return NULL;
+	}
+
+	if (fseek(Fd, 0, SEEK_END) == 0 && (Size = ftell(Fd)) > 0 &&
+			fseek(Fd, 0, SEEK_SET) == 0) {
+		ElfPtr = malloc(Size);
+		if (ElfPtr != NULL) {
+			if (fread(ElfPtr, 1, Size, Fd) == (size_t)Size) {
+				ImgPtr = XAieLib_ElfOpenMem(ElfPtr, (u32)Size);
+			}
+			free(ElfPtr);
+		}
+	}
+	fclose(Fd);
+
+	return ImgPtr;
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* This API frees an image.
+*
+* @param	ImgPtr: Pointer to the image, or NULL.
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+void XAieLib_ElfClose(XAieLib_ElfImg *ImgPtr)
+{
+	u32 Count;
+
+	if (ImgPtr == NULL) {
+		return;
+	}
+
+	for (Count = 0U; Count < ImgPtr->NumSects; Count++) {
+		free(ImgPtr->Sects[Count].Data);
+	}
+	free(ImgPtr->Sects);
+	free(ImgPtr);
+}
+
+/*****************************************************************************/
+/**
+*
+* This API drops the record of the program loaded in a tile, so the next
+* XAieLib_LoadElfMulti() writes all its sections.
+*
+* @param	TileAddr: Base address of the tile.
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+void XAieLib_ElfInvalidateTile(u64 TileAddr)
+{
+	u32 TileIdx = XAieLib_ElfTileIdx(TileAddr);
+
+	if (XAieLib_ElfLoadedTiles[TileIdx] != NULL) {
+		free(XAieLib_ElfLoadedTiles[TileIdx]->Hashes);
+		free(XAieLib_ElfLoadedTiles[TileIdx]);
+		XAieLib_ElfLoadedTiles[TileIdx] = NULL;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API drops the records of the programs loaded in all tiles.
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+void XAieLib_ElfInvalidateAll(void)
+{
+	u32 TileIdx;
+
+	for (TileIdx = 0U; TileIdx < XAIELIB_ELF_NUM_TILES; TileIdx++) {
+		XAieLib_ElfInvalidateTile((u64)TileIdx <<
+				XAIEGBL_TILE_ADDR_ROW_SHIFT);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to write words to the tile memory, using
+* 128 bit block writes for the aligned part.
+*
+* @param	Addr: Address to write to, word aligned.
+* @param	Data: Words to write, NULL to write zeros.
+* @param	NumWords: Number of words.
+*
+* @return	None.
+*
+* @note		Used only in this file.
+*
+*******************************************************************************/
+static void XAieLib_ElfWriteWords(u64 Addr, const u32 *Data, u32 NumWords)
+{
+	u32 Zeros[4] = {0U, 0U, 0U, 0U};
+	u32 Block[4];
+
+	while (NumWords != 0U && (Addr & 0xFU) != 0U) {
+		XAieLib_Write32(Addr, Data != NULL ? *Data++ : 0U);
+		Addr += 4U;
+		NumWords--;
+	}
+
+	while (NumWords >= 4U) {
+		if (Data != NULL) {
+			memcpy(Block, Data, sizeof(Block));
+			XAieLib_Write128(Addr, Block);
+			Data += 4U;
+		} else {
+			XAieLib_Write128(Addr, Zeros);
+		}
+		Addr += 16U;
+		NumWords -= 4U;
+	}
+
+	while (NumWords != 0U) {
+		XAieLib_Write32(Addr, Data != NULL ? *Data++ : 0U);
+		Addr += 4U;
+		NumWords--;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to get the tile whose data memory holds an
+* address, following the cardinal direction encoded in the address.
+*
+* @param	TileInstPtr: Tile the ELF is loaded to.
+* @param	Addr: Data memory address in the ELF.
+*
+* @return	Base address of the target tile.
+*
+* @note		Used only in this file. Same as XAieSim_GetTargetTileAddr().
+*
+*******************************************************************************/
+static u64 XAieLib_ElfTargetTile(XAieGbl_Tile *TileInstPtr, u32 Addr)
+{
+	u32 Row = TileInstPtr->RowId;
+	u32 Col = TileInstPtr->ColId;
+
+	switch ((Addr & XAIELIB_ELF_DMB_CARD_OFF) >>
+			XAIELIB_ELF_DMB_CARD_SHIFT) {
+	case 0U:
+		/* South */
+		if (Row > 0U) {
+			Row--;
+		}
+		break;
+	case 1U:
+		/* West, the adjacent tile on odd rows */
+		if ((Row % 2U) == 1U && Col > 0U) {
+			Col--;
+		}
+		break;
+	case 2U:
+		/* North */
+		Row++;
+		break;
+	default:
+		/* East, the adjacent tile on even rows */
+		if ((Row % 2U) == 0U) {
+			Col++;
+		}
+		break;
+	}
+
+	if (Row > XAieGbl_ConfigTable->NumRows) {
+		Row = TileInstPtr->RowId;
+	}
+	if (Col >= XAieGbl_ConfigTable->NumCols) {
+		Col = TileInstPtr->ColId;
+	}
+
+	return (TileInstPtr->TileAddr & ~(u64)XAIEGBL_TILE_BASE_ADDRMASK) |
+		((u64)Col << XAIEGBL_TILE_ADDR_COL_SHIFT) |
+		((u64)Row << XAIEGBL_TILE_ADDR_ROW_SHIFT);
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to load an image to one tile.
+*
+* @param	TileInstPtr: Tile to load.
+* @param	ImgPtr: Image to load.
+* @param	StatsPtr: Statistics to update.
+*
+* @return	XAIELIB_SUCCESS on success, otherwise XAIELIB_FAILURE if the
+*		record of the tile can't be allocated. The tile is loaded
+*		anyway.
+*
+* @note		Used only in this file.
+*
+*******************************************************************************/
+static u32 XAieLib_ElfLoadTile(XAieGbl_Tile *TileInstPtr,
+		XAieLib_ElfImg *ImgPtr, XAieLib_ElfLoadStats *StatsPtr)
+{
+	u32 TileIdx = XAieLib_ElfTileIdx(TileInstPtr->TileAddr);
+	XAieLib_ElfLoaded *OldPtr = XAieLib_ElfLoadedTiles[TileIdx];
+	XAieLib_ElfLoaded *NewPtr;
+	XAieLib_ElfSect *SectPtr;
+	u32 Count, Idx, Done, Len;
+	u8 Skip;
+
+	NewPtr = malloc(sizeof(*NewPtr));
+	if (NewPtr != NULL) {
+		NewPtr->NumSects = 0U;
+		NewPtr->Hashes = malloc(ImgPtr->NumSects *
+				sizeof(*NewPtr->Hashes));
+		if (NewPtr->Hashes == NULL) {
+			free(NewPtr);
+			NewPtr = NULL;
+		}
+	}
+
+	for (Count = 0U; Count < ImgPtr->NumSects; Count++) {
+		SectPtr = &ImgPtr->Sects[Count];
+
+		if (SectPtr->Type == XAIELIB_ELF_SECT_PRGMEM) {
+			Skip = 0U;
+			for (Idx = 0U; OldPtr != NULL &&
+					Idx < OldPtr->NumSects; Idx++) {
+				if (OldPtr->Hashes[Idx] == SectPtr->Hash) {
+					Skip = 1U;
+					break;
+				}
+			}
+
+			if (NewPtr != NULL) {
+				NewPtr->Hashes[NewPtr->NumSects++] =
+					SectPtr->Hash;
+			}
+
+			if (Skip) {
+				StatsPtr->Skipped++;
+				continue;
+			}
+
+			XAieLib_ElfWriteWords(TileInstPtr->TileAddr +
+					XAIEGBL_CORE_PRGMEM + SectPtr->Addr,
+					SectPtr->Data, SectPtr->Size / 4U);
+		} else {
+			/* Split at the data memory bank boundaries */
+			for (Done = 0U; Done < SectPtr->Size; Done += Len) {
+				Idx = (SectPtr->Addr + Done) &
+					XAIELIB_ELF_DMB_MASK;
+				Len = XAIELIB_ELF_DMB_SIZE - Idx;
+				if (Len > SectPtr->Size - Done) {
+					Len = SectPtr->Size - Done;
+				}
+
+				XAieLib_ElfWriteWords(XAieLib_ElfTargetTile(
+						TileInstPtr,
+						SectPtr->Addr + Done) +
+						XAIEGBL_MEM_DATMEM + Idx,
+						SectPtr->Data != NULL ?
+						SectPtr->Data + Done / 4U :
+						NULL, Len / 4U);
+			}
+		}
+
+		StatsPtr->Loaded++;
+		StatsPtr->Bytes += SectPtr->Size;
+	}
+
+	if (OldPtr != NULL) {
+		free(OldPtr->Hashes);
+		free(OldPtr);
+	}
+	XAieLib_ElfLoadedTiles[TileIdx] = NewPtr;
+
+	return (NewPtr != NULL) ? XAIELIB_SUCCESS : XAIELIB_FAILURE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to load an image to the tiles of a worker.
+*
+* @param	Arg: Pointer to the work.
+*
+* @return	NULL.
+*
+* @note		Used only in this file.
+*
+*******************************************************************************/
+static void *XAieLib_ElfWorker(void *Arg)
+{
+	XAieLib_ElfWork *WorkPtr = (XAieLib_ElfWork *)Arg;
+	u32 Idx;
+
+	WorkPtr->Ret = XAIELIB_SUCCESS;
+	for (Idx = 0U; Idx < WorkPtr->NumTiles; Idx++) {
+		if (XAieLib_ElfLoadTile(WorkPtr->TileInstPtrs[Idx],
+					WorkPtr->ImgPtr, &WorkPtr->Stats) !=
+				XAIELIB_SUCCESS) {
+			WorkPtr->Ret = XAIELIB_FAILURE;
+		}
+	}
+
+	return NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API loads an image to a number of tiles.
+*
+* @param	TileInstPtrs: Array of pointers to the tiles to load.
+* @param	NumTiles: Number of tiles.
+* @param	ImgPtr: Image to load, from XAieLib_ElfOpenMem() or
+*		XAieLib_ElfOpenFile().
+* @param	NumThreads: Maximum number of threads to use. 0 selects
+*		XAIELIB_ELF_DEF_THREADS. Ignored on baremetal, and while a
+*		transaction is recording.
+* @param	StatsPtr: Pointer to return the statistics of the load. Can be
+*		NULL.
+*
+* @return	XAIELIB_SUCCESS on success, otherwise XAIELIB_FAILURE if the
+*		records of the loaded programs can't be allocated. The tiles
+*		are loaded anyway, and fully written on the next load.
+*
+* @note		A tile must appear only once in TileInstPtrs.
+*
+*******************************************************************************/
+u32 XAieLib_LoadElfMulti(XAieGbl_Tile **TileInstPtrs, u32 NumTiles,
+		XAieLib_ElfImg *ImgPtr, u32 NumThreads,
+		XAieLib_ElfLoadStats *StatsPtr)
+{
+	XAieLib_ElfWork Work[XAIELIB_ELF_MAX_THREADS];
+	u32 Ret = XAIELIB_SUCCESS;
+	u32 Idx, First = 0U;
+#ifdef XAIELIB_ELF_THREADS
+	pthread_t Threads[XAIELIB_ELF_MAX_THREADS];
+	u8 Started[XAIELIB_ELF_MAX_THREADS];
+#endif
+
+	XAie_AssertNonvoid(TileInstPtrs != XAIE_NULL);
+	XAie_AssertNonvoid(ImgPtr != XAIE_NULL);
+
+	if (NumThreads == 0U) {
+		NumThreads = XAIELIB_ELF_DEF_THREADS;
+	}
+	if (NumThreads > XAIELIB_ELF_MAX_THREADS) {
+		NumThreads = XAIELIB_ELF_MAX_THREADS;
+	}
+	if (NumThreads > NumTiles) {
+		NumThreads = NumTiles;
+	}
+#ifdef XAIELIB_ELF_THREADS
+	/* The transaction buffer is not reentrant */
+	if (XAieLib_TxnIsActive()) {
+		NumThreads = 1U;
+	}
+#else
+	NumThreads = 1U;
+#endif
+	if (NumThreads == 0U) {
+		NumThreads = 1U;
+	}
+
+	/* Give each worker a contiguous share of the tiles */
+	for (Idx = 0U; Idx < NumThreads; Idx++) {
+		Work[Idx].TileInstPtrs = &TileInstPtrs[First];
+		Work[Idx].NumTiles = (NumTiles - First) / (NumThreads - Idx);
+		Work[Idx].ImgPtr = ImgPtr;
+		memset(&Work[Idx].Stats, 0, sizeof(Work[Idx].Stats));
+		First += Work[Idx].NumTiles;
+	}
+
+#ifdef XAIELIB_ELF_THREADS
+	/* The calling thread takes the first share */
+	for (Idx = 1U; Idx < NumThreads; Idx++) {
+		Started[Idx] = (pthread_create(&Threads[Idx], NULL,
+					XAieLib_ElfWorker, &Work[Idx]) == 0);
+		if (!Started[Idx]) {
+			XAieLib_ElfWorker(&Work[Idx]);
+		}
+	}
+#endif
+	XAieLib_ElfWorker(&Work[0]);
+
+	if (StatsPtr != NULL) {
+		memset(StatsPtr, 0, sizeof(*StatsPtr));
+	}
+	for (Idx = 0U; Idx < NumThreads; Idx++) {
+#ifdef XAIELIB_ELF_THREADS
+		if (Idx != 0U && Started[Idx]) {
+			pthread_join(Threads[Idx], NULL);
+		}
+#endif
+		if (Work[Idx].Ret != XAIELIB_SUCCESS) {
+			Ret = XAIELIB_FAILURE;
+		}
+		if (StatsPtr != NULL) {
+			StatsPtr->Loaded += Work[Idx].Stats.Loaded;
+			StatsPtr->Skipped += Work[Idx].Stats.Skipped;
+			StatsPtr->Bytes += Work[Idx].Stats.Bytes;
+		}
+	}
+
+	return Ret;
+}
+
+/** @} */
@@ -0,0 +1,632 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaielib_shadow.c
+* @{
+*
+* This file contains the shadow register cache of the AIE driver.
+*
+* When enabled with XAieLib_ShadowEnable(), every value written to or read
+* from a configuration register is kept in a per tile table. Then,
+* - XAieLib_Read32() of a cached register doesn't access the device,
+* - XAieLib_MaskWrite32() of a cached register only writes the device,
+* so the read back of registers written earlier, which costs a round trip
+* over the NoC, is eliminated.
+*
+* Only the registers listed in XAieLib_ShadowAieRanges and
+* XAieLib_ShadowShimRanges are cached. Those are written only by the driver
+* and hold the written value. The other registers are volatile and always
+* go to the device:
+* - data and program memory,
+* - status, counter, timer value and event status registers,
+* - the action registers listed in XAieLib_ShadowAieActRanges and
+*   XAieLib_ShadowShimActRanges: lock, event generate, DMA start queue and
+*   reset registers, whose access triggers an action, and the set / clear
+*   registers of the broadcast blocks and the interrupt controllers, which
+*   change the value of another register.
+*
+* XAieLib_RegType() returns this classification, which the transaction
+* buffer of xaielib_txn.c uses as well.
+*
+* The cache assumes that the driver is the only one writing the
+* configuration registers. If the array is reset or reconfigured by other
+* means, XAieLib_ShadowInvalidateTile() or XAieLib_ShadowInvalidateAll() must
+* be called. Writing the column reset register of a shim tile invalidates
+* the column, and any NPI write invalidates the whole array.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0  agt     10/17/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#include "xaiegbl.h"
+#include "xaielib.h"
+#include <stdlib.h>
+#include <string.h>
+
+/***************************** Macro Definitions *****************************/
+/* Tile index from an address: 7 bits column, 5 bits row */
+#define XAIELIB_SHADOW_NUM_TILES	(1U << 12U)
+#define XAIELIB_SHADOW_ROW_MASK		0x1FU
+#define XAIELIB_SHADOW_OFF_MASK		0x3FFFFU
+
+/* Initial entries of a tile table, a power of 2 */
+#define XAIELIB_SHADOW_DEF_SIZE		64U
+
+/* Marks a used entry. Register offsets are 18 bits. */
+#define XAIELIB_SHADOW_USED		(1U << 31U)
+
+/************************** Variable Definitions *****************************/
+typedef struct {
+	u32 Start;	/**< First cached offset */
+	u32 End;	/**< Offset after the last cached register */
+} XAieLib_ShadowRange;
+
+typedef struct {
+	u32 Key;	/**< Offset | XAIELIB_SHADOW_USED, 0 if free */
+	u32 Val;	/**< Value of the register */
+} XAieLib_ShadowEntry;
+
+typedef struct {
+	XAieLib_ShadowEntry *Entries;	/**< Open addressing table */
+	u32 Size;			/**< Entries, a power of 2 */
+	u32 Used;			/**< Used entries */
+} XAieLib_ShadowTile;
+
+typedef struct {
+	XAieLib_ShadowTile **Tiles;	/**< Tables, indexed by column / row */
+	XAieLib_ShadowStats Stats;	/**< Statistics */
+} XAieLib_Shadow;
+
+static XAieLib_Shadow XAieLib_ShadowInst;
+
+/* Cached configuration registers of the AIE tiles */
+static const XAieLib_ShadowRange XAieLib_ShadowAieRanges[] = {
+	{XAIEGBL_MEM_PERCTRL0, XAIEGBL_MEM_PERCTRL1 + 4U},
+	{XAIEGBL_MEM_PERCOU0EVTVAL, XAIEGBL_MEM_PERCOU1EVTVAL + 4U},
+	{XAIEGBL_MEM_EVTBRDCAST0, XAIEGBL_MEM_EVTBRDCAST15 + 4U},
+	{XAIEGBL_MEM_TRACTRL0, XAIEGBL_MEM_TRACTRL1 + 4U},
+	{XAIEGBL_MEM_TRAEVT0, XAIEGBL_MEM_TRAEVT1 + 4U},
+	{XAIEGBL_MEM_TIMTRIEVTLOWVAL, XAIEGBL_MEM_TIMTRIEVTHIGVAL + 4U},
+	{XAIEGBL_MEM_WTCHPT0, XAIEGBL_MEM_WTCHPT1 + 4U},
+	{XAIEGBL_MEM_COMEVTINP, XAIEGBL_MEM_COMEVTCTRL + 4U},
+	{XAIEGBL_MEM_EVTGRP0ENA, XAIEGBL_MEM_EVTGRPUSREVTENA + 4U},
+	{XAIEGBL_MEM_DMABD0ADDA, XAIEGBL_MEM_DMABD15CTRL + 4U},
+	{XAIEGBL_MEM_DMAS2MM0CTR, XAIEGBL_MEM_DMAS2MM0CTR + 4U},
+	{XAIEGBL_MEM_DMAS2MM1CTR, XAIEGBL_MEM_DMAS2MM1CTR + 4U},
+	{XAIEGBL_MEM_DMAMM2S0CTR, XAIEGBL_MEM_DMAMM2S0CTR + 4U},
+	{XAIEGBL_MEM_DMAMM2S1CTR, XAIEGBL_MEM_DMAMM2S1CTR + 4U},
+	{XAIEGBL_MEM_LOCKEVTVALCTRL0, XAIEGBL_MEM_LOCKEVTVALCTRL1 + 4U},
+	{XAIEGBL_CORE_PERCTR0, XAIEGBL_CORE_PERCTR2 + 4U},
+	{XAIEGBL_CORE_PERCOU0EVTVAL, XAIEGBL_CORE_PERCOU3EVTVAL + 4U},
+	{XAIEGBL_CORE_ENAEVE, XAIEGBL_CORE_RSTEVT + 4U},
+	{XAIEGBL_CORE_PCEVT0, XAIEGBL_CORE_PCEVT3 + 4U},
+	{XAIEGBL_CORE_EVTBRDCAST0, XAIEGBL_CORE_EVTBRDCAST15 + 4U},
+	{XAIEGBL_CORE_TRACTRL0, XAIEGBL_CORE_TRACTRL1 + 4U},
+	{XAIEGBL_CORE_TRAEVT0, XAIEGBL_CORE_TRAEVT1 + 4U},
+	{XAIEGBL_CORE_TIMTRIEVTLOWVAL, XAIEGBL_CORE_TIMTRIEVTHIGVAL + 4U},
+	{XAIEGBL_CORE_COMEVTINP, XAIEGBL_CORE_COMEVTCTRL + 4U},
+	{XAIEGBL_CORE_EVTGRP0ENA, XAIEGBL_CORE_EVTGRPUSREVTENA + 4U},
+	{XAIEGBL_CORE_TILCTRL, XAIEGBL_CORE_TILCTRL + 4U},
+	{XAIEGBL_CORE_TILCLOCTRL, XAIEGBL_CORE_TILCLOCTRL + 4U},
+	{XAIEGBL_CORE_STRSWIMSTRCFGMECORE0, XAIEGBL_CORE_STRSWIMSTRCFGEAS3 + 4U},
+	{XAIEGBL_CORE_STRSWISLVMECORE0CFG, XAIEGBL_CORE_STRSWISLVMEMTRACFG + 4U},
+	{XAIEGBL_CORE_STRSWISLVMECORE0SLO0, XAIEGBL_CORE_STRSWISLVMEMTRASLO3 + 4U},
+	{XAIEGBL_CORE_STRSWIEVTPORTSEL0, XAIEGBL_CORE_STRSWIEVTPORTSEL1 + 4U},
+};
+
+/* Action registers of the AIE tiles */
+static const XAieLib_ShadowRange XAieLib_ShadowAieActRanges[] = {
+	{XAIEGBL_MEM_EVTGEN, XAIEGBL_MEM_EVTGEN + 4U},
+	{XAIEGBL_MEM_EVTBRDCASTBLKSOUSET, XAIEGBL_MEM_EVTBRDCASTBLKEASCLR + 4U},
+	{XAIEGBL_MEM_DMAS2MM0STAQUE, XAIEGBL_MEM_DMAS2MM0STAQUE + 4U},
+	{XAIEGBL_MEM_DMAS2MM1STAQUE, XAIEGBL_MEM_DMAS2MM1STAQUE + 4U},
+	{XAIEGBL_MEM_DMAMM2S0STAQUE, XAIEGBL_MEM_DMAMM2S0STAQUE + 4U},
+	{XAIEGBL_MEM_DMAMM2S1STAQUE, XAIEGBL_MEM_DMAMM2S1STAQUE + 4U},
+	{XAIEGBL_MEM_LOCK0RELNV, XAIEGBL_MEM_LOCK15ACQV1 + 4U},
+	{XAIEGBL_CORE_CORECTRL, XAIEGBL_CORE_CORECTRL + 4U},
+	{XAIEGBL_CORE_EVTGEN, XAIEGBL_CORE_EVTGEN + 4U},
+	{XAIEGBL_CORE_EVTBRDCASTBLKSOUSET, XAIEGBL_CORE_EVTBRDCASTBLKEASCLR + 4U},
+};
+
+/* Cached configuration registers of the shim tiles */
+static const XAieLib_ShadowRange XAieLib_ShadowShimRanges[] = {
+	{XAIEGBL_NOC_LOCKEVTVALCTRL0, XAIEGBL_NOC_LOCKEVTVALCTRL1 + 4U},
+	{XAIEGBL_NOC_INTCON2NDLEVINT, XAIEGBL_NOC_INTCON2NDLEVINT + 4U},
+	{XAIEGBL_NOC_DMABD0ADDLOW, XAIEGBL_NOC_DMABD15PKT + 4U},
+	{XAIEGBL_NOC_DMAS2MM0CTR, XAIEGBL_NOC_DMAS2MM0CTR + 4U},
+	{XAIEGBL_NOC_DMAS2MM1CTR, XAIEGBL_NOC_DMAS2MM1CTR + 4U},
+	{XAIEGBL_NOC_DMAMM2S0CTR, XAIEGBL_NOC_DMAMM2S0CTR + 4U},
+	{XAIEGBL_NOC_DMAMM2S1CTR, XAIEGBL_NOC_DMAMM2S1CTR + 4U},
+	{XAIEGBL_NOC_NOCINTMETONOCSOU2, XAIEGBL_NOC_MEAXICFG + 4U},
+	{XAIEGBL_NOC_MUXCFG, XAIEGBL_NOC_DEMCFG + 4U},
+	{XAIEGBL_PL_PERCTR0, XAIEGBL_PL_PERCTR1 + 4U},
+	{XAIEGBL_PL_PERCOU0EVTVAL, XAIEGBL_PL_PERCOU1EVTVAL + 4U},
+	{XAIEGBL_PL_PLINTUPSCFG, XAIEGBL_PL_PLINTDOWBYPASS + 4U},
+	{XAIEGBL_PL_EVTBRDCAST0A, XAIEGBL_PL_EVTBRDCAST15A + 4U},
+	{XAIEGBL_PL_TRACTRL0, XAIEGBL_PL_TRACTRL1 + 4U},
+	{XAIEGBL_PL_TRAEVT0, XAIEGBL_PL_TRAEVT1 + 4U},
+	{XAIEGBL_PL_TIMTRIEVTLOWVAL, XAIEGBL_PL_TIMTRIEVTHIGVAL + 4U},
+	{XAIEGBL_PL_COMEVTINP, XAIEGBL_PL_COMEVTCTRL + 4U},
+	{XAIEGBL_PL_EVTGRP0ENA, XAIEGBL_PL_EVTGRPUSRENA + 4U},
+	{XAIEGBL_PL_INTCON1STLEVIRQNOA, XAIEGBL_PL_INTCON1STLEVIRQEVTA + 4U},
+	{XAIEGBL_PL_INTCON1STLEVIRQNOB, XAIEGBL_PL_INTCON1STLEVIRQEVTB + 4U},
+	{XAIEGBL_PL_TILCLOCTRL, XAIEGBL_PL_TILCLOCTRL + 4U},
+	{XAIEGBL_PL_AIESHIRSTENA, XAIEGBL_PL_AIESHIRSTENA + 4U},
+	{XAIEGBL_PL_STRSWIMSTRCFGTILCTR, XAIEGBL_PL_STRSWIMSTRCFGEAS3 + 4U},
+	{XAIEGBL_PL_STRSWISLVTILCTRCFG, XAIEGBL_PL_STRSWISLVTRACFG + 4U},
+	{XAIEGBL_PL_STRSWISLVTILCTRSLO0, XAIEGBL_PL_STRSWISLVTRASLO3 + 4U},
+	{XAIEGBL_PL_STRSWIEVTPORTSEL0, XAIEGBL_PL_STRSWIEVTPORTSEL1 + 4U},
+};
+
+/* Action registers of the shim tiles */
+static const XAieLib_ShadowRange XAieLib_ShadowShimActRanges[] = {
+	{XAIEGBL_NOC_LOCK0RELNV, XAIEGBL_NOC_LOCK15ACQV1 + 4U},
+	{XAIEGBL_NOC_INTCON2NDLEVENA, XAIEGBL_NOC_INTCON2NDLEVSTA + 4U},
+	{XAIEGBL_NOC_DMAS2MM0STAQUE, XAIEGBL_NOC_DMAS2MM0STAQUE + 4U},
+	{XAIEGBL_NOC_DMAS2MM1STABDQUE, XAIEGBL_NOC_DMAS2MM1STABDQUE + 4U},
+	{XAIEGBL_NOC_DMAMM2S0STABDQUE, XAIEGBL_NOC_DMAMM2S0STABDQUE + 4U},
+	{XAIEGBL_NOC_DMAMM2S1STABDQUE, XAIEGBL_NOC_DMAMM2S1STABDQUE + 4U},
+	{XAIEGBL_PL_EVTGEN, XAIEGBL_PL_EVTGEN + 4U},
+	{XAIEGBL_PL_EVTBRDCASTABLKSOUSET, XAIEGBL_PL_EVTBRDCASTBBLKEASCLR + 4U},
+	{XAIEGBL_PL_INTCON1STLEVENAA, XAIEGBL_PL_INTCON1STLEVSTAA + 4U},
+	{XAIEGBL_PL_INTCON1STLEVBLKNORINASET,
+		XAIEGBL_PL_INTCON1STLEVBLKNORINACLR + 4U},
+	{XAIEGBL_PL_INTCON1STLEVENAB, XAIEGBL_PL_INTCON1STLEVSTAB + 4U},
+	{XAIEGBL_PL_INTCON1STLEVBLKNORINBSET,
+		XAIEGBL_PL_INTCON1STLEVBLKNORINBCLR + 4U},
+	{XAIEGBL_PL_AIETILCOLRST, XAIEGBL_PL_AIETILCOLRST + 4U},
+};
+
+/************************** Function Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to check if a register is in a list of
+* ranges.
+*
+* @param	Ranges: Ranges, sorted by offset.
+* @param	NumRanges: Number of ranges.
+* @param	Off: Offset of the register in the tile.
+*
+* @return	1 if the register is in one of the ranges, 0 otherwise.
+*
+* @note		Used only in this file.
+*
+*******************************************************************************/
+static u8 XAieLib_ShadowInRanges(const XAieLib_ShadowRange *Ranges,
+		u32 NumRanges, u32 Off)
+{
+	u32 Lo = 0U, Hi, Mid;
+
+	Hi = NumRanges;
+	while (Lo < Hi) {
+		Mid = (Lo + Hi) / 2U;
+		if (Off < Ranges[Mid].Start) {
+			Hi = Mid;
+		} else if (Off >= Ranges[Mid].End) {
+			Lo = Mid + 1U;
+		} else {
+			return 1U;
+		}
+	}
+
+	return 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to check if a register is cached.
+*
+* @param	Row: Row of the tile. Row 0 is the shim row.
+* @param	Off: Offset of the register in the tile.
+*
+* @return	1 if the register is cached, 0 if it is volatile.
+*
+* @note		Used only in this file.
+*
+*******************************************************************************/
+static u8 XAieLib_ShadowIsCached(u32 Row, u32 Off)
+{
+	if (Row == 0U) {
+		return XAieLib_ShadowInRanges(XAieLib_ShadowShimRanges,
+				sizeof(XAieLib_ShadowShimRanges) /
+				sizeof(XAieLib_ShadowShimRanges[0]), Off);
+	}
+
+	return XAieLib_ShadowInRanges(XAieLib_ShadowAieRanges,
+			sizeof(XAieLib_ShadowAieRanges) /
+			sizeof(XAieLib_ShadowAieRanges[0]), Off);
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to classify a register.
+*
+* @param	Addr: Address of the register.
+*
+* @return	XAIELIB_REG_CACHED for a configuration register which holds
+*		the value written by the driver,
+*		XAIELIB_REG_ACTION for a register whose access triggers an
+*		action or changes another register,
+*		XAIELIB_REG_VOLATILE for any other register or memory.
+*
+* @note		Used by xaielib_txn.c. Doesn't depend on the cache being
+*		enabled.
+*
+*******************************************************************************/
+u32 XAieLib_RegType(u64 Addr)
+{
+	u32 Row, Off;
+
+	Row = (u32)(Addr >> XAIEGBL_TILE_ADDR_ROW_SHIFT) &
+		XAIELIB_SHADOW_ROW_MASK;
+	Off = (u32)Addr & XAIELIB_SHADOW_OFF_MASK;
+
+	if (XAieLib_ShadowIsCached(Row, Off)) {
+		return XAIELIB_REG_CACHED;
+	}
+
+	if (Row == 0U) {
+		if (XAieLib_ShadowInRanges(XAieLib_ShadowShimActRanges,
+				sizeof(XAieLib_ShadowShimActRanges) /
+				sizeof(XAieLib_ShadowShimActRanges[0]), Off)) {
+			return XAIELIB_REG_ACTION;
+		}
+	} else if (XAieLib_ShadowInRanges(XAieLib_ShadowAieActRanges,
+			sizeof(XAieLib_ShadowAieActRanges) /
+			sizeof(XAieLib_ShadowAieActRanges[0]), Off)) {
+		return XAIELIB_REG_ACTION;
+	}
+
+	return XAIELIB_REG_VOLATILE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to find the entry of a register in a tile
+* table.
+*
+* @param	TilePtr: Pointer to the tile table.
+* @param	Off: Offset of the register in the tile.
+*
+* @return	Pointer to the entry, or to the free entry where it belongs.
+*
+* @note		Used only in this file.
+*
+*******************************************************************************/
+static XAieLib_ShadowEntry *XAieLib_ShadowFind(XAieLib_ShadowTile *TilePtr,
+		u32 Off)
+{
+	u32 Key = Off | XAIELIB_SHADOW_USED;
+	u32 Idx;
+
+	Idx = ((Off >> 2U) * 0x9E3779B1U) >> 16U;
+	Idx &= TilePtr->Size - 1U;
+	while (TilePtr->Entries[Idx].Key != 0U &&
+			TilePtr->Entries[Idx].Key != Key) {
+		Idx = (Idx + 1U) & (TilePtr->Size - 1U);
+	}
+
+	return &TilePtr->Entries[Idx];
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to double the size of a tile table.
+*
+* @param	TilePtr: Pointer to the tile table.
+*
+* @return	XAIELIB_SUCCESS on success, otherwise XAIELIB_FAILURE.
+*
+* @note		Used only in this file.
+*
+*******************************************************************************/
+static u32 XAieLib_ShadowGrow(XAieLib_ShadowTile *TilePtr)
+{
+	XAieLib_ShadowEntry *OldEntries = TilePtr->Entries;
+	u32 OldSize = TilePtr->Size;
+	u32 Idx;
+
+	TilePtr->Entries = calloc(OldSize * 2U, sizeof(*TilePtr->Entries));
+	if (TilePtr->Entries == NULL) {
+		TilePtr->Entries = OldEntries;
+		return XAIELIB_FAILURE;
+	}
+	TilePtr->Size = OldSize * 2U;
+
+	for (Idx = 0U; Idx < OldSize; Idx++) {
+		if (OldEntries[Idx].Key != 0U) {
+			*XAieLib_ShadowFind(TilePtr, OldEntries[Idx].Key &
+					~XAIELIB_SHADOW_USED) = OldEntries[Idx];
+		}
+	}
+	free(OldEntries);
+
+	return XAIELIB_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to drop the table of a tile.
+*
+* @param	TileIdx: Index of the tile.
+*
+* @return	None.
+*
+* @note		Used only in this file.
+*
+*******************************************************************************/
+static void XAieLib_ShadowDrop(u32 TileIdx)
+{
+	XAieLib_ShadowTile *TilePtr = XAieLib_ShadowInst.Tiles[TileIdx];
+
+	if (TilePtr != NULL) {
+		free(TilePtr->Entries);
+		free(TilePtr);
+		XAieLib_ShadowInst.Tiles[TileIdx] = NULL;
+		XAieLib_ShadowInst.Stats.Invalidations++;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API enables the shadow register cache. The cache starts empty.
+*
+* @return	XAIELIB_SUCCESS on success, otherwise XAIELIB_FAILURE if the
+*		tile tables can't be allocated.
+*
+* @note		Does nothing if the cache is already enabled.
+*
+*******************************************************************************/
+u32 XAieLib_ShadowEnable(void)
+{
+	if (XAieLib_ShadowInst.Tiles != NULL) {
+		return XAIELIB_SUCCESS;
+	}
+
+	XAieLib_ShadowInst.Tiles = calloc(XAIELIB_SHADOW_NUM_TILES,
+			sizeof(*XAieLib_ShadowInst.Tiles));
+	if (XAieLib_ShadowInst.Tiles == NULL) {
+		return XAIELIB_FAILURE;
+	}
+	memset(&XAieLib_ShadowInst.Stats, 0,
+			sizeof(XAieLib_ShadowInst.Stats));
+
+	return XAIELIB_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API disables the shadow register cache and frees its tables.
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+void XAieLib_ShadowDisable(void)
+{
+	if (XAieLib_ShadowInst.Tiles == NULL) {
+		return;
+	}
+
+	XAieLib_ShadowInvalidateAll();
+	free(XAieLib_ShadowInst.Tiles);
+	XAieLib_ShadowInst.Tiles = NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API drops the cached registers of a tile.
+*
+* @param	TileAddr: Base address of the tile.
+*
+* @return	None.
+*
+* @note		To be called when the tile is reset or written by other means
+*		than this driver.
+*
+*******************************************************************************/
+void XAieLib_ShadowInvalidateTile(u64 TileAddr)
+{
+	if (XAieLib_ShadowInst.Tiles == NULL) {
+		return;
+	}
+
+	XAieLib_ShadowDrop((u32)(TileAddr >> XAIEGBL_TILE_ADDR_ROW_SHIFT) &
+			(XAIELIB_SHADOW_NUM_TILES - 1U));
+}
+
+/*****************************************************************************/
+/**
+*
+* This API drops the cached registers of all tiles.
+*
+* @return	None.
+*
+* @note		None.
+*
+*******************************************************************************/
+void XAieLib_ShadowInvalidateAll(void)
+{
+	u32 TileIdx;
+
+	if (XAieLib_ShadowInst.Tiles == NULL) {
+		return;
+	}
+
+	for (TileIdx = 0U; TileIdx < XAIELIB_SHADOW_NUM_TILES; TileIdx++) {
+		XAieLib_ShadowDrop(TileIdx);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API returns the statistics of the shadow register cache.
+*
+* @param	StatsPtr: Pointer to return the statistics.
+*
+* @return	None.
+*
+* @note		The statistics are reset by XAieLib_ShadowEnable().
+*
+*******************************************************************************/
+void XAieLib_ShadowGetStats(XAieLib_ShadowStats *StatsPtr)
+{
+	*StatsPtr = XAieLib_ShadowInst.Stats;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to look up a register.
+*
+* @param	Addr: Address of the register.
+* @param	ValPtr: Pointer to return the cached value.
+*
+* @return	XAIELIB_SHADOW_HIT if the value is returned,
+*		XAIELIB_SHADOW_MISS if the register is cached but its value
+*		isn't known yet,
+*		XAIELIB_SHADOW_BYPASS if the cache is disabled or the register
+*		is volatile.
+*
+* @note		Used by xaielib.c only.
+*
+*******************************************************************************/
+u32 XAieLib_ShadowLookup(u64 Addr, u32 *ValPtr)
+{
+	XAieLib_ShadowTile *TilePtr;
+	XAieLib_ShadowEntry *EntryPtr;
+	u32 TileIdx, Off;
+
+	if (XAieLib_ShadowInst.Tiles == NULL) {
+		return XAIELIB_SHADOW_BYPASS;
+	}
+
+	TileIdx = (u32)(Addr >> XAIEGBL_TILE_ADDR_ROW_SHIFT) &
+		(XAIELIB_SHADOW_NUM_TILES - 1U);
+	Off = (u32)Addr & XAIELIB_SHADOW_OFF_MASK;
+	if (!XAieLib_ShadowIsCached(TileIdx & XAIELIB_SHADOW_ROW_MASK, Off)) {
+		XAieLib_ShadowInst.Stats.Bypassed++;
+		return XAIELIB_SHADOW_BYPASS;
+	}
+
+	TilePtr = XAieLib_ShadowInst.Tiles[TileIdx];
+	if (TilePtr != NULL) {
+		EntryPtr = XAieLib_ShadowFind(TilePtr, Off);
+		if (EntryPtr->Key != 0U) {
+			*ValPtr = EntryPtr->Val;
+			XAieLib_ShadowInst.Stats.Hits++;
+			return XAIELIB_SHADOW_HIT;
+		}
+	}
+
+	XAieLib_ShadowInst.Stats.Misses++;
+	return XAIELIB_SHADOW_MISS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to update the cached value of a register
+* which is written or read.
+*
+* @param	Addr: Address of the register.
+* @param	Val: Value of the register.
+*
+* @return	None.
+*
+* @note		Used by xaielib.c only. Does nothing for volatile registers.
+*		If the tile table can't grow, the tile is dropped, so the
+*		cache never holds a stale value.
+*
+*******************************************************************************/
+void XAieLib_ShadowUpdate(u64 Addr, u32 Val)
+{
+	XAieLib_ShadowTile *TilePtr;
+	XAieLib_ShadowEntry *EntryPtr;
+	u32 TileIdx, Off, Row;
+
+	TileIdx = (u32)(Addr >> XAIEGBL_TILE_ADDR_ROW_SHIFT) &
+		(XAIELIB_SHADOW_NUM_TILES - 1U);
+	Off = (u32)Addr & XAIELIB_SHADOW_OFF_MASK;
+	Row = TileIdx & XAIELIB_SHADOW_ROW_MASK;
+
+	/*
+	 * The column reset of a shim tile resets all tiles of the column,
+	 * including their program memory loaded by XAieLib_LoadElfMulti()
+	 */
+	if (Row == 0U && Off == XAIEGBL_PL_AIETILCOLRST) {
+		for (Row = 0U; Row <= XAIELIB_SHADOW_ROW_MASK; Row++) {
+			XAieLib_ElfInvalidateTile((u64)(TileIdx | Row) <<
+					XAIEGBL_TILE_ADDR_ROW_SHIFT);
+			if (XAieLib_ShadowInst.Tiles != NULL) {
+				XAieLib_ShadowDrop(TileIdx | Row);
+			}
+		}
+		return;
+	}
+
+	if (XAieLib_ShadowInst.Tiles == NULL) {
+		return;
+	}
+
+	if (!XAieLib_ShadowIsCached(Row, Off)) {
+		return;
+	}
+
+	TilePtr = XAieLib_ShadowInst.Tiles[TileIdx];
+	if (TilePtr == NULL) {
+		TilePtr = malloc(sizeof(*TilePtr));
+		if (TilePtr == NULL) {
+			return;
+		}
+		TilePtr->Entries = calloc(XAIELIB_SHADOW_DEF_SIZE,
+				sizeof(*TilePtr->Entries));
+		if (TilePtr->Entries == NULL) {
+			free(TilePtr);
+			return;
+		}
+		TilePtr->Size = XAIELIB_SHADOW_DEF_SIZE;
+		TilePtr->Used = 0U;
+		XAieLib_ShadowInst.Tiles[TileIdx] = TilePtr;
+	}
+
+	EntryPtr = XAieLib_ShadowFind(TilePtr, Off);
+	if (EntryPtr->Key == 0U) {
+		/* Keep the table at most half full */
+		if ((TilePtr->Used + 1U) * 2U > TilePtr->Size) {
+			if (XAieLib_ShadowGrow(TilePtr) != XAIELIB_SUCCESS) {
+				XAieLib_ShadowDrop(TileIdx);
+				return;
+			}
+			EntryPtr = XAieLib_ShadowFind(TilePtr, Off);
+		}
+		EntryPtr->Key = Off | XAIELIB_SHADOW_USED;
+		TilePtr->Used++;
+	}
+	EntryPtr->Val = Val;
+}
+
+/** @} */
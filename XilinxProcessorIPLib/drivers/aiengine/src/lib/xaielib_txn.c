@@ -0,0 +1,455 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaielib_txn.c
+* @{
+*
+* This file contains the transaction buffer of the AIE driver.
+*
+* Between XAieLib_TxnStart() and XAieLib_TxnEnd(), XAieLib_Write32(),
+* XAieLib_MaskWrite32() and XAieLib_Write128() don't access the device.
+* The writes are recorded in a command buffer instead, and issued by
+* XAieLib_TxnFlush(), using 128 bit block writes for runs of four
+* consecutive words.
+*
+* While recording,
+* - a write to the same address as the previous command replaces it,
+* - a mask write of a configuration register is resolved against a shadow
+*   of the registers written or read in the transaction, so it only reads
+*   the device the first time a register is touched.
+* Reads and polls flush the buffer first, so they always see the writes
+* issued before them.
+*
+* The registers are classified by XAieLib_RegType(), as for the shadow
+* register cache of xaielib_shadow.c. A write to an action register, ex a
+* lock, event generate, DMA start queue, reset or set / clear register, is
+* never merged and is issued at once with the writes recorded before it, so
+* each write triggers its action in order. A mask write of a register other
+* than a configuration register flushes the buffer and reads the device, as
+* the value may change on its own.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0  agt     10/17/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+/***************************** Include Files *********************************/
+#include "xaiegbl_defs.h"
+#include "xaielib.h"
+#include <stdlib.h>
+#include <string.h>
+
+/***************************** Macro Definitions *****************************/
+/* Marks a used shadow entry. Register addresses never set the top bit. */
+#define XAIELIB_TXN_SHADOW_USED		(1ULL << 63U)
+
+/************************** Variable Definitions *****************************/
+typedef struct {
+	u64 Addr;	/**< Register address */
+	u32 Data;	/**< Value to write */
+	u8 IsAction;	/**< Write to an action register */
+} XAieLib_TxnCmd;
+
+typedef struct {
+	u64 Key;	/**< Address | XAIELIB_TXN_SHADOW_USED, 0 if free */
+	u32 Val;	/**< Last value written to or read from the register */
+} XAieLib_TxnShadow;
+
+typedef struct {
+	u8 IsActive;			/**< Recording */
+	u8 IsFlushing;			/**< Issuing the recorded commands */
+	XAieLib_TxnCmd *Cmds;		/**< Command buffer */
+	u32 NumCmds;			/**< Recorded commands */
+	u32 MaxCmds;			/**< Size of the command buffer */
+	XAieLib_TxnShadow *Shadow;	/**< Shadow register file */
+	u32 ShadowSize;			/**< Entries, a power of 2 */
+	u32 ShadowUsed;			/**< Used entries */
+	XAieLib_TxnStats Stats;		/**< Statistics */
+} XAieLib_Txn;
+
+static XAieLib_Txn XAieLib_TxnInst;
+
+/************************** Function Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to find the shadow entry of a register.
+*
+* @param	Addr: Address of the register.
+* @param	Insert: Non 0 to create the entry if it doesn't exist.
+*
+* @return	Pointer to the entry, NULL if not found or if the shadow is full.
+*
+* @note		Used only in this file.
+*
+*******************************************************************************/
+static XAieLib_TxnShadow *XAieLib_TxnShadowFind(u64 Addr, u8 Insert)
+{
+	XAieLib_Txn *TxnPtr = &XAieLib_TxnInst;
+	u64 Key = Addr | XAIELIB_TXN_SHADOW_USED;
+	u32 Idx;
+
+	Idx = (u32)(((Addr >> 2U) * 0x9E3779B97F4A7C15ULL) >> 32U) &
+		(TxnPtr->ShadowSize - 1U);
+	while (TxnPtr->Shadow[Idx].Key != 0U) {
+		if (TxnPtr->Shadow[Idx].Key == Key) {
+			return &TxnPtr->Shadow[Idx];
+		}
+		Idx = (Idx + 1U) & (TxnPtr->ShadowSize - 1U);
+	}
+
+	/* Keep the table at most half full so probe sequences stay short */
+	if (!Insert || (TxnPtr->ShadowUsed + 1U) * 2U > TxnPtr->ShadowSize) {
+		return NULL;
+	}
+
+	TxnPtr->Shadow[Idx].Key = Key;
+	TxnPtr->ShadowUsed++;
+
+	return &TxnPtr->Shadow[Idx];
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to update the shadow of a register. If the
+* shadow is full, it is cleared after flushing the command buffer.
+*
+* @param	Addr: Address of the register.
+* @param	Val: Value of the register.
+*
+* @return	None.
+*
+* @note		Used only in this file.
+*
+*******************************************************************************/
+static void XAieLib_TxnShadowSet(u64 Addr, u32 Val)
+{
+	XAieLib_Txn *TxnPtr = &XAieLib_TxnInst;
+	XAieLib_TxnShadow *ShadowPtr;
+
+	ShadowPtr = XAieLib_TxnShadowFind(Addr, 1U);
+	if (ShadowPtr == NULL) {
+		/*
+		 * Every pending write of a configuration register has a
+		 * shadow entry, so the buffer is flushed before the entries
+		 * are dropped.
+		 */
+		XAieLib_TxnFlush();
+		memset(TxnPtr->Shadow, 0, TxnPtr->ShadowSize *
+				sizeof(*TxnPtr->Shadow));
+		TxnPtr->ShadowUsed = 0U;
+		ShadowPtr = XAieLib_TxnShadowFind(Addr, 1U);
+	}
+	ShadowPtr->Val = Val;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API starts recording the register writes.
+*
+* @param	MaxCmds: Number of commands the buffer holds before it is
+*		flushed automatically. 0 selects XAIELIB_TXN_DEF_CMDS.
+*
+* @return	XAIELIB_SUCCESS on success, otherwise XAIELIB_FAILURE if a
+*		transaction is already active or the buffers can't be allocated.
+*
+* @note		None.
+*
+*******************************************************************************/
+u32 XAieLib_TxnStart(u32 MaxCmds)
+{
+	XAieLib_Txn *TxnPtr = &XAieLib_TxnInst;
+	u32 ShadowSize;
+
+	if (TxnPtr->IsActive) {
+		return XAIELIB_FAILURE;
+	}
+
+	if (MaxCmds == 0U) {
+		MaxCmds = XAIELIB_TXN_DEF_CMDS;
+	}
+
+	/* Room for a shadow entry per command at half load */
+	for (ShadowSize = 64U; ShadowSize < MaxCmds * 2U; ShadowSize <<= 1U);
+
+	TxnPtr->Cmds = malloc(MaxCmds * sizeof(*TxnPtr->Cmds));
+	TxnPtr->Shadow = calloc(ShadowSize, sizeof(*TxnPtr->Shadow));
+	if (TxnPtr->Cmds == NULL || TxnPtr->Shadow == NULL) {
+		free(TxnPtr->Cmds);
+		free(TxnPtr->Shadow);
+		TxnPtr->Cmds = NULL;
+		TxnPtr->Shadow = NULL;
+		return XAIELIB_FAILURE;
+	}
+
+	TxnPtr->MaxCmds = MaxCmds;
+	TxnPtr->NumCmds = 0U;
+	TxnPtr->ShadowSize = ShadowSize;
+	TxnPtr->ShadowUsed = 0U;
+	memset(&TxnPtr->Stats, 0, sizeof(TxnPtr->Stats));
+	TxnPtr->IsActive = 1U;
+
+	return XAIELIB_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API issues the recorded writes to the device. The transaction stays
+* active.
+*
+* @return	None.
+*
+* @note		Does nothing if no transaction is active.
+*
+*******************************************************************************/
+void XAieLib_TxnFlush(void)
+{
+	XAieLib_Txn *TxnPtr = &XAieLib_TxnInst;
+	XAieLib_TxnCmd *CmdPtr;
+	u32 Data[4];
+	u32 Idx = 0U;
+
+	if (!TxnPtr->IsActive || TxnPtr->IsFlushing ||
+			TxnPtr->NumCmds == 0U) {
+		return;
+	}
+
+	TxnPtr->IsFlushing = 1U;
+	while (Idx < TxnPtr->NumCmds) {
+		CmdPtr = &TxnPtr->Cmds[Idx];
+
+		/*
+		 * Issue four consecutive aligned words as one block write.
+		 * An action register is the last recorded command, so only
+		 * the fourth word can be one.
+		 */
+		if ((CmdPtr->Addr & 0xFU) == 0U &&
+				Idx + 4U <= TxnPtr->NumCmds &&
+				CmdPtr[1].Addr == CmdPtr->Addr + 4U &&
+				CmdPtr[2].Addr == CmdPtr->Addr + 8U &&
+				CmdPtr[3].Addr == CmdPtr->Addr + 12U &&
+				!CmdPtr[3].IsAction) {
+			Data[0] = CmdPtr[0].Data;
+			Data[1] = CmdPtr[1].Data;
+			Data[2] = CmdPtr[2].Data;
+			Data[3] = CmdPtr[3].Data;
+			XAieLib_IOWrite128(CmdPtr->Addr, Data);
+			TxnPtr->Stats.BlockWrites++;
+			Idx += 4U;
+		} else {
+			XAieLib_IOWrite32(CmdPtr->Addr, CmdPtr->Data);
+			TxnPtr->Stats.Writes++;
+			Idx++;
+		}
+	}
+	TxnPtr->NumCmds = 0U;
+	TxnPtr->Stats.Flushes++;
+	TxnPtr->IsFlushing = 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API flushes the recorded writes and ends the transaction.
+*
+* @param	StatsPtr: Pointer to return the statistics of the transaction.
+*		Can be NULL.
+*
+* @return	XAIELIB_SUCCESS on success, otherwise XAIELIB_FAILURE if no
+*		transaction is active.
+*
+* @note		None.
+*
+*******************************************************************************/
+u32 XAieLib_TxnEnd(XAieLib_TxnStats *StatsPtr)
+{
+	XAieLib_Txn *TxnPtr = &XAieLib_TxnInst;
+
+	if (!TxnPtr->IsActive) {
+		return XAIELIB_FAILURE;
+	}
+
+	XAieLib_TxnFlush();
+
+	if (StatsPtr != NULL) {
+		*StatsPtr = TxnPtr->Stats;
+	}
+
+	free(TxnPtr->Cmds);
+	free(TxnPtr->Shadow);
+	TxnPtr->Cmds = NULL;
+	TxnPtr->Shadow = NULL;
+	TxnPtr->IsActive = 0U;
+
+	return XAIELIB_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to check if a transaction is recording.
+*
+* @return	1 if a transaction is recording, 0 otherwise.
+*
+* @note		Used by XAieLib_LoadElfMulti() only.
+*
+*******************************************************************************/
+u8 XAieLib_TxnIsActive(void)
+{
+	return XAieLib_TxnInst.IsActive;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to record a 32 bit write.
+*
+* @param	Addr: Address to write to.
+* @param	Data: 32-bit data to be written.
+*
+* @return	XAIELIB_SUCCESS if recorded, XAIELIB_FAILURE if the write has
+*		to go to the device as no transaction is recording.
+*
+* @note		Used by XAieLib_Write32() only.
+*
+*******************************************************************************/
+u32 XAieLib_TxnWrite32(u64 Addr, u32 Data)
+{
+	XAieLib_Txn *TxnPtr = &XAieLib_TxnInst;
+	XAieLib_TxnCmd *CmdPtr;
+	u32 RegType;
+
+	if (!TxnPtr->IsActive || TxnPtr->IsFlushing) {
+		return XAIELIB_FAILURE;
+	}
+
+	RegType = XAieLib_RegType(Addr);
+	if (RegType == XAIELIB_REG_CACHED) {
+		XAieLib_TxnShadowSet(Addr, Data);
+	}
+	TxnPtr->Stats.Recorded++;
+
+	/*
+	 * Only the previous command can be replaced, as merging with an
+	 * earlier one would reorder it with the writes in between. Action
+	 * registers are never merged, and the buffer is empty after one.
+	 */
+	if (RegType != XAIELIB_REG_ACTION && TxnPtr->NumCmds != 0U) {
+		CmdPtr = &TxnPtr->Cmds[TxnPtr->NumCmds - 1U];
+		if (CmdPtr->Addr == Addr) {
+			CmdPtr->Data = Data;
+			TxnPtr->Stats.Merged++;
+			return XAIELIB_SUCCESS;
+		}
+	}
+
+	if (TxnPtr->NumCmds == TxnPtr->MaxCmds) {
+		XAieLib_TxnFlush();
+	}
+
+	CmdPtr = &TxnPtr->Cmds[TxnPtr->NumCmds++];
+	CmdPtr->Addr = Addr;
+	CmdPtr->Data = Data;
+	CmdPtr->IsAction = (RegType == XAIELIB_REG_ACTION) ? 1U : 0U;
+
+	if (RegType == XAIELIB_REG_ACTION) {
+		XAieLib_TxnFlush();
+	}
+
+	return XAIELIB_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to record a masked 32 bit write.
+*
+* @param	Addr: Address to write to.
+* @param	Mask: Mask to be applied to Data.
+* @param	Data: 32-bit data to be written.
+*
+* @return	XAIELIB_SUCCESS if recorded, XAIELIB_FAILURE if the write has
+*		to go to the device as no transaction is recording.
+*
+* @note		Used by XAieLib_MaskWrite32() only.
+*
+*******************************************************************************/
+u32 XAieLib_TxnMaskWrite32(u64 Addr, u32 Mask, u32 Data)
+{
+	XAieLib_Txn *TxnPtr = &XAieLib_TxnInst;
+	XAieLib_TxnShadow *ShadowPtr;
+	u32 RegVal;
+
+	if (!TxnPtr->IsActive || TxnPtr->IsFlushing) {
+		return XAIELIB_FAILURE;
+	}
+
+	if (XAieLib_RegType(Addr) != XAIELIB_REG_CACHED) {
+		/* Not shadowed, issue the pending writes and read the device */
+		XAieLib_TxnFlush();
+		RegVal = XAieLib_IORead32(Addr);
+		TxnPtr->Stats.Reads++;
+	} else {
+		ShadowPtr = XAieLib_TxnShadowFind(Addr, 0U);
+		if (ShadowPtr != NULL) {
+			RegVal = ShadowPtr->Val;
+			TxnPtr->Stats.ShadowHits++;
+		} else {
+			/*
+			 * No write to this register is pending, so the device
+			 * is current
+			 */
+			RegVal = XAieLib_IORead32(Addr);
+			TxnPtr->Stats.Reads++;
+		}
+	}
+
+	RegVal &= ~Mask;
+	RegVal |= Data;
+
+	return XAieLib_TxnWrite32(Addr, RegVal);
+}
+
+/*****************************************************************************/
+/**
+*
+* This is the internal function to record a 128 bit write.
+*
+* @param	Addr: Address to write to.
+* @param	Data: Pointer to the 128-bit data buffer.
+*
+* @return	XAIELIB_SUCCESS if recorded, XAIELIB_FAILURE if the write has
+*		to go to the device as no transaction is recording.
+*
+* @note		Used by XAieLib_Write128() only.
+*
+*******************************************************************************/
+u32 XAieLib_TxnWrite128(u64 Addr, u32 *Data)
+{
+	u8 Idx;
+
+	if (!XAieLib_TxnInst.IsActive || XAieLib_TxnInst.IsFlushing) {
+		return XAIELIB_FAILURE;
+	}
+
+	for (Idx = 0U; Idx < 4U; Idx++) {
+		XAieLib_TxnWrite32(Addr + Idx * 4U, Data[Idx]);
+	}
+
+	return XAIELIB_SUCCESS;
+}
+
+/** @} */
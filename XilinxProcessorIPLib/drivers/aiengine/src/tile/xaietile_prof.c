@@ -0,0 +1,790 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaietile_prof.c
+* @{
+*
+* This file contains the profiling service.
+*
+* XAieTile_ProfInitialize() takes a list of kernels, each with the metrics
+* to count in its tile, and programs a performance counter per metric to
+* count the cycles the event of the metric is asserted.
+* XAieTile_ProfSample() then records the counters and the timer of each
+* kernel, reading only the counters of the metrics, and
+* XAieTile_ProfExport() writes the samples in the Chrome trace event format:
+* - a counter event per kernel and interval, with each metric as a percentage
+*   of the cycles of the interval,
+* - a complete event per kernel spanning the profile, with each metric as a
+*   percentage of all cycles.
+* The timestamps of a kernel are relative to its first sample, so the timers
+* of the tiles don't need to be synchronized.
+*
+* XAieTile_ProfTraceStart() additionally routes the trace of a kernel down
+* its column to a shim DMA channel which writes it to a host buffer. The trace
+* is in the event-time format of the hardware and is not decoded here.
+*
+* Sampling is not batched. The tile registers are only reachable with single
+* 32 bit accesses: XAieLib_Read128() is four of them on every backend, and
+* the shim DMA moves stream and memory data but cannot read the registers.
+* A sample therefore costs 3 reads for the timer plus one read per metric,
+* which is the least there is. For a finer time resolution than polling
+* allows, use the trace instead.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0  agt     10/17/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "xaiegbl.h"
+#include "xaiegbl_defs.h"
+#include "xaiegbl_reginit.h"
+#include "xaiedma_shim.h"
+#include "xaietile_event.h"
+#include "xaietile_perfcnt.h"
+#include "xaietile_strm.h"
+#include "xaietile_prof.h"
+
+/***************************** Macro Definitions *****************************/
+#define XAIETILE_PROF_NUM_MODULES	3U
+
+/************************** Variable Definitions *****************************/
+/* First counter register of each module, the counters are consecutive */
+static const u32 XAieTile_ProfCounterBase[XAIETILE_PROF_NUM_MODULES] = {
+	XAIEGBL_CORE_PERCOU0,
+	XAIEGBL_MEM_PERCOU0,
+	XAIEGBL_PL_PERCOU0,
+};
+
+/* Number of counters of each module */
+static const u8 XAieTile_ProfNumCounters[XAIETILE_PROF_NUM_MODULES] = {
+	4U, 2U, 2U
+};
+
+/**
+ * Metrics of the stall breakdown of a core, one per core counter.
+ */
+const XAieTile_ProfMetric
+XAieTile_ProfCoreStalls[XAIETILE_PROF_NUM_CORE_STALLS] = {
+	{"active", XAIETILE_PROF_MODULE_CORE, XAIETILE_EVENT_CORE_ACTIVE},
+	{"memory_stall", XAIETILE_PROF_MODULE_CORE,
+		XAIETILE_EVENT_CORE_MEMORY_STALL},
+	{"stream_stall", XAIETILE_PROF_MODULE_CORE,
+		XAIETILE_EVENT_CORE_STREAM_STALL},
+	{"lock_stall", XAIETILE_PROF_MODULE_CORE,
+		XAIETILE_EVENT_CORE_LOCK_STALL},
+};
+
+/************************** Function Definitions *****************************/
+/*****************************************************************************/
+/**
+*
+* This is an internal API to program a performance counter to count the
+* cycles an event is asserted, from 0.
+*
+* @param	TileInstPtr - Pointer to the Tile instance.
+* @param	Module - XAIETILE_PROF_MODULE_*.
+* @param	Counter - Counter ID.
+* @param	Event - Event ID.
+*
+* @return	None.
+*
+* @note		Used only within this file.
+*
+*******************************************************************************/
+static void _XAieTile_ProfCounterSetup(XAieGbl_Tile *TileInstPtr, u8 Module,
+		u8 Counter, u8 Event)
+{
+	if (Module == XAIETILE_PROF_MODULE_CORE) {
+		XAieTileCore_PerfCounterControl(TileInstPtr, Counter, Event,
+				Event, XAIETILE_PERFCNT_EVENT_INVALID);
+		XAieTileCore_PerfCounterSet(TileInstPtr, Counter, 0U);
+	} else if (Module == XAIETILE_PROF_MODULE_MEM) {
+		XAieTileMem_PerfCounterControl(TileInstPtr, Counter, Event,
+				Event, XAIETILE_PERFCNT_EVENT_INVALID);
+		XAieTileMem_PerfCounterSet(TileInstPtr, Counter, 0U);
+	} else {
+		XAieTilePl_PerfCounterControl(TileInstPtr, Counter, Event,
+				Event, XAIETILE_PERFCNT_EVENT_INVALID);
+		XAieTilePl_PerfCounterSet(TileInstPtr, Counter, 0U);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This API initializes the profiling instance, allocates a performance counter
+* to each metric of the kernels and starts counting.
+*
+* @param	ProfPtr - Pointer to the profiling instance.
+* @param	Kernels - Kernels to profile. Must stay valid until
+*		XAieTile_ProfFinish().
+* @param	NumKernels - Number of kernels.
+* @param	MaxSamples - Maximum number of samples to collect.
+* @param	ClockMHz - Clock of the array, to convert cycles to time.
+*
+* @return	XAIE_SUCCESS on success, XAIE_FAILURE if two kernels are in the
+*		same tile, a module runs out of counters, a metric is of a
+*		module the tile doesn't have, or the sample buffers can't be
+*		allocated.
+*
+* @note		Only one kernel per tile is supported, as the counters of a
+*		tile are allocated from 0 for each kernel.
+*
+*******************************************************************************/
+u32 XAieTile_ProfInitialize(XAieTile_Prof *ProfPtr,
+		const XAieTile_ProfKernel *Kernels, u32 NumKernels,
+		u32 MaxSamples, u32 ClockMHz)
+{
+	const XAieTile_ProfKernel *KernelPtr;
+	u8 Used[XAIETILE_PROF_NUM_MODULES];
+	u8 Module;
+	u32 Idx, Prev;
+	u8 Metric;
+
+	XAie_AssertNonvoid(ProfPtr != XAIE_NULL);
+	XAie_AssertNonvoid(Kernels != XAIE_NULL);
+	XAie_AssertNonvoid(ClockMHz != 0U);
+
+	ProfPtr->Kernels = Kernels;
+	ProfPtr->NumKernels = NumKernels;
+	ProfPtr->ClockMHz = ClockMHz;
+	ProfPtr->MaxSamples = MaxSamples;
+	ProfPtr->NumSamples = 0U;
+	ProfPtr->TraceTilePtr = XAIE_NULL;
+
+	ProfPtr->Counters = malloc(NumKernels * sizeof(*ProfPtr->Counters));
+	ProfPtr->Timestamps = malloc((u64)MaxSamples * NumKernels *
+			sizeof(*ProfPtr->Timestamps));
+	ProfPtr->Values = malloc((u64)MaxSamples * NumKernels *
+			XAIETILE_PROF_MAX_METRICS * sizeof(*ProfPtr->Values));
+	if (ProfPtr->Counters == XAIE_NULL ||
+			ProfPtr->Timestamps == XAIE_NULL ||
+			ProfPtr->Values == XAIE_NULL) {
+		XAieTile_ProfFinish(ProfPtr);
+		return XAIE_FAILURE;
+	}
+
+	/* Allocate the counters first, so nothing is programmed on failure */
+	for (Idx = 0U; Idx < NumKernels; Idx++) {
+		KernelPtr = &Kernels[Idx];
+		XAie_AssertNonvoid(KernelPtr->NumMetrics <=
+				XAIETILE_PROF_MAX_METRICS);
+
+		for (Prev = 0U; Prev < Idx; Prev++) {
+			if (Kernels[Prev].TileInstPtr->TileAddr ==
+					KernelPtr->TileInstPtr->TileAddr) {
+				XAieLib_print("Error: Kernels %d and %d are in "
+						"the same tile\n", Prev, Idx);
+				XAieTile_ProfFinish(ProfPtr);
+				return XAIE_FAILURE;
+			}
+		}
+
+		for (Module = 0U; Module < XAIETILE_PROF_NUM_MODULES; Module++) {
+			Used[Module] = 0U;
+		}
+
+		for (Metric = 0U; Metric < KernelPtr->NumMetrics; Metric++) {
+			Module = KernelPtr->Metrics[Metric].Module;
+			if (Module >= XAIETILE_PROF_NUM_MODULES ||
+					(Module == XAIETILE_PROF_MODULE_PL) !=
+					(KernelPtr->TileInstPtr->TileType !=
+					 XAIEGBL_TILE_TYPE_AIETILE) ||
+					Used[Module] ==
+					XAieTile_ProfNumCounters[Module]) {
+				XAieLib_print("Error: No counter for metric "
+						"%d of kernel %d\n", Metric,
+						Idx);
+				XAieTile_ProfFinish(ProfPtr);
+				return XAIE_FAILURE;
+			}
+			ProfPtr->Counters[Idx][Metric] = Used[Module]++;
+		}
+	}
+
+	for (Idx = 0U; Idx < NumKernels; Idx++) {
+		KernelPtr = &Kernels[Idx];
+		for (Metric = 0U; Metric < KernelPtr->NumMetrics; Metric++) {
+			_XAieTile_ProfCounterSetup(KernelPtr->TileInstPtr,
+					KernelPtr->Metrics[Metric].Module,
+					ProfPtr->Counters[Idx][Metric],
+					KernelPtr->Metrics[Metric].Event);
+		}
+	}
+
+	return XAIE_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API frees the sample buffers of the profiling instance.
+*
+* @param	ProfPtr - Pointer to the profiling instance.
+*
+* @return	None.
+*
+* @note		The counters keep counting, and the trace keeps running until
+*		XAieTile_ProfTraceStop().
+*
+*******************************************************************************/
+void XAieTile_ProfFinish(XAieTile_Prof *ProfPtr)
+{
+	XAie_AssertVoid(ProfPtr != XAIE_NULL);
+
+	free(ProfPtr->Counters);
+	free(ProfPtr->Timestamps);
+	free(ProfPtr->Values);
+	ProfPtr->Counters = XAIE_NULL;
+	ProfPtr->Timestamps = XAIE_NULL;
+	ProfPtr->Values = XAIE_NULL;
+	ProfPtr->NumSamples = 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API records the timer and the counters of all kernels.
+*
+* @param	ProfPtr - Pointer to the profiling instance.
+*
+* @return	XAIE_SUCCESS on success, XAIE_FAILURE if the sample buffers are
+*		full.
+*
+* @note		The timer is read high, low, high, and again if the high
+*		word changed in between. Each counter is a separate 32 bit
+*		read, see the file description.
+*
+*******************************************************************************/
+u32 XAieTile_ProfSample(XAieTile_Prof *ProfPtr)
+{
+	const XAieTile_ProfKernel *KernelPtr;
+	u64 TileAddr;
+	u32 High, Low;
+	u32 Idx, Pos;
+	u8 Metric, Module;
+
+	XAie_AssertNonvoid(ProfPtr != XAIE_NULL);
+
+	if (ProfPtr->NumSamples == ProfPtr->MaxSamples) {
+		return XAIE_FAILURE;
+	}
+
+	for (Idx = 0U; Idx < ProfPtr->NumKernels; Idx++) {
+		KernelPtr = &ProfPtr->Kernels[Idx];
+		Pos = ProfPtr->NumSamples * ProfPtr->NumKernels + Idx;
+
+		TileAddr = KernelPtr->TileInstPtr->TileAddr;
+
+		do {
+			High = XAieGbl_Read32(TileAddr + XAIEGBL_CORE_TIMHIG);
+			Low = XAieGbl_Read32(TileAddr + XAIEGBL_CORE_TIMLOW);
+		} while (XAieGbl_Read32(TileAddr + XAIEGBL_CORE_TIMHIG) != High);
+		ProfPtr->Timestamps[Pos] = ((u64)High << 32U) | Low;
+
+		for (Metric = 0U; Metric < KernelPtr->NumMetrics; Metric++) {
+			Module = KernelPtr->Metrics[Metric].Module;
+			ProfPtr->Values[Pos * XAIETILE_PROF_MAX_METRICS +
+				Metric] = XAieGbl_Read32(TileAddr +
+					XAieTile_ProfCounterBase[Module] +
+					ProfPtr->Counters[Idx][Metric] * 4U);
+		}
+	}
+	ProfPtr->NumSamples++;
+
+	return XAIE_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API collects samples periodically.
+*
+* @param	ProfPtr - Pointer to the profiling instance.
+* @param	NumSamples - Number of samples to collect.
+* @param	PeriodUs - Time between the samples in micro seconds.
+*
+* @return	XAIE_SUCCESS on success, XAIE_FAILURE if the sample buffers are
+*		full before NumSamples samples are collected.
+*
+* @note		Blocks for about NumSamples * PeriodUs.
+*
+*******************************************************************************/
+u32 XAieTile_ProfRun(XAieTile_Prof *ProfPtr, u32 NumSamples, u32 PeriodUs)
+{
+	u32 Idx;
+
+	XAie_AssertNonvoid(ProfPtr != XAIE_NULL);
+
+	for (Idx = 0U; Idx < NumSamples; Idx++) {
+		if (Idx != 0U) {
+			XAieLib_usleep(PeriodUs);
+		}
+		if (XAieTile_ProfSample(ProfPtr) != XAIE_SUCCESS) {
+			return XAIE_FAILURE;
+		}
+	}
+
+	return XAIE_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This is an internal API to get the increment of a counter in an interval.
+*
+* @param	ProfPtr - Pointer to the profiling instance.
+* @param	Sample - Sample ending the interval, from 1.
+* @param	Kernel - Index of the kernel.
+* @param	Metric - Index of the metric in the kernel.
+*
+* @return	Increment of the counter.
+*
+* @note		Used only within this file. The counters are 32 bit and may
+*		wrap once between two samples.
+*
+*******************************************************************************/
+static u32 _XAieTile_ProfDelta(XAieTile_Prof *ProfPtr, u32 Sample, u32 Kernel,
+		u8 Metric)
+{
+	u32 Pos = Sample * ProfPtr->NumKernels + Kernel;
+	u32 Prev = Pos - ProfPtr->NumKernels;
+
+	return ProfPtr->Values[Pos * XAIETILE_PROF_MAX_METRICS + Metric] -
+		ProfPtr->Values[Prev * XAIETILE_PROF_MAX_METRICS + Metric];
+}
+
+/*****************************************************************************/
+/**
+*
+* This API gets the total count of a metric over the collected samples.
+*
+* @param	ProfPtr - Pointer to the profiling instance.
+* @param	Kernel - Index of the kernel.
+* @param	Metric - Index of the metric in the kernel.
+* @param	CyclesPtr - Pointer to return the cycles between the first and
+*		the last sample. Can be NULL.
+*
+* @return	Cycles the event of the metric was asserted.
+*
+* @note		None.
+*
+*******************************************************************************/
+u64 XAieTile_ProfGetTotal(XAieTile_Prof *ProfPtr, u32 Kernel, u8 Metric,
+		u64 *CyclesPtr)
+{
+	u64 Total = 0U;
+	u32 Sample;
+
+	XAie_AssertNonvoid(ProfPtr != XAIE_NULL);
+	XAie_AssertNonvoid(Kernel < ProfPtr->NumKernels);
+	XAie_AssertNonvoid(Metric < ProfPtr->Kernels[Kernel].NumMetrics);
+
+	for (Sample = 1U; Sample < ProfPtr->NumSamples; Sample++) {
+		Total += _XAieTile_ProfDelta(ProfPtr, Sample, Kernel, Metric);
+	}
+
+	if (CyclesPtr != XAIE_NULL) {
+		*CyclesPtr = 0U;
+		if (ProfPtr->NumSamples > 1U) {
+			*CyclesPtr = ProfPtr->Timestamps[(ProfPtr->NumSamples -
+					1U) * ProfPtr->NumKernels + Kernel] -
+				ProfPtr->Timestamps[Kernel];
+		}
+	}
+
+	return Total;
+}
+
+/*
+ * Output buffer of XAieTile_ProfExport()
+ */
+typedef struct {
+	char *Buf;	/**< Buffer */
+	u32 Size;	/**< Size of the buffer */
+	u32 Len;	/**< Length of the output, may exceed Size */
+} XAieTile_ProfOut;
+
+/*****************************************************************************/
+/**
+*
+* This is an internal API to append formatted text to the output.
+*
+* @param	OutPtr - Pointer to the output.
+* @param	Format - printf() format.
+*
+* @return	None.
+*
+* @note		Used only within this file. The text is counted but not
+*		written once the buffer is full.
+*
+*******************************************************************************/
+static void _XAieTile_ProfPrint(XAieTile_ProfOut *OutPtr, const char *Format,
+		...)
+{
+	va_list Args;
+	int Len;
+
+	va_start(Args, Format);
+	Len = vsnprintf(OutPtr->Len < OutPtr->Size ? OutPtr->Buf + OutPtr->Len :
+			XAIE_NULL, OutPtr->Len < OutPtr->Size ?
+			OutPtr->Size - OutPtr->Len : 0U, Format, Args);
+	va_end(Args);
+
+	if (Len > 0) {
+		OutPtr->Len += (u32)Len;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This is an internal API to append a JSON string.
+*
+* @param	OutPtr - Pointer to the output.
+* @param	Str - String to quote.
+*
+* @return	None.
+*
+* @note		Used only within this file.
+*
+*******************************************************************************/
+static void _XAieTile_ProfPrintStr(XAieTile_ProfOut *OutPtr, const char *Str)
+{
+	_XAieTile_ProfPrint(OutPtr, "\"");
+	for (; *Str != '\0'; Str++) {
+		if (*Str == '"' || *Str == '\\') {
+			_XAieTile_ProfPrint(OutPtr, "\\%c", *Str);
+		} else if ((u8)*Str < 0x20U) {
+			_XAieTile_ProfPrint(OutPtr, "\\u%04x", (u8)*Str);
+		} else {
+			_XAieTile_ProfPrint(OutPtr, "%c", *Str);
+		}
+	}
+	_XAieTile_ProfPrint(OutPtr, "\"");
+}
+
+/*****************************************************************************/
+/**
+*
+* This is an internal API to append the metrics of a kernel as percentages
+* of a number of cycles, with one decimal.
+*
+* @param	OutPtr - Pointer to the output.
+* @param	KernelPtr - Pointer to the kernel.
+* @param	Counts - Count of each metric.
+* @param	Cycles - Number of cycles.
+* @param	Comma - 1 to start with a comma.
+*
+* @return	None.
+*
+* @note		Used only within this file.
+*
+*******************************************************************************/
+static void _XAieTile_ProfPrintMetrics(XAieTile_ProfOut *OutPtr,
+		const XAieTile_ProfKernel *KernelPtr, const u64 *Counts,
+		u64 Cycles, u8 Comma)
+{
+	u64 Permille;
+	u8 Metric;
+
+	for (Metric = 0U; Metric < KernelPtr->NumMetrics; Metric++) {
+		Permille = (Cycles != 0U) ? Counts[Metric] * 1000U / Cycles : 0U;
+		if (Comma || Metric != 0U) {
+			_XAieTile_ProfPrint(OutPtr, ",");
+		}
+		_XAieTile_ProfPrintStr(OutPtr, KernelPtr->Metrics[Metric].Name);
+		_XAieTile_ProfPrint(OutPtr, ":%llu.%llu",
+				(unsigned long long)(Permille / 10U),
+				(unsigned long long)(Permille % 10U));
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This is an internal API to append a timestamp in micro seconds.
+*
+* @param	OutPtr - Pointer to the output.
+* @param	Cycles - Time in cycles.
+* @param	ClockMHz - Clock of the array.
+*
+* @return	None.
+*
+* @note		Used only within this file.
+*
+*******************************************************************************/
+static void _XAieTile_ProfPrintUs(XAieTile_ProfOut *OutPtr, u64 Cycles,
+		u32 ClockMHz)
+{
+	u64 Ns = Cycles * 1000U / ClockMHz;
+
+	_XAieTile_ProfPrint(OutPtr, "%llu.%03llu",
+			(unsigned long long)(Ns / 1000U),
+			(unsigned long long)(Ns % 1000U));
+}
+
+/*****************************************************************************/
+/**
+*
+* This API writes the collected samples in the Chrome trace event format
+* (JSON), which chrome://tracing and Perfetto display. Each column is a
+* process, and each kernel is a thread named after the kernel.
+*
+* @param	ProfPtr - Pointer to the profiling instance.
+* @param	Buf - Buffer to write to. Can be NULL if Size is 0.
+* @param	Size - Size of the buffer in bytes.
+*
+* @return	Length of the output, excluding the terminating null
+*		character. If it's Size or more, the output was truncated and
+*		the call should be repeated with a larger buffer.
+*
+* @note		Needs at least 2 samples for the metrics.
+*
+*******************************************************************************/
+u32 XAieTile_ProfExport(XAieTile_Prof *ProfPtr, char *Buf, u32 Size)
+{
+	const XAieTile_ProfKernel *KernelPtr;
+	XAieTile_ProfOut Out = {Buf, Size, 0U};
+	u64 Counts[XAIETILE_PROF_MAX_METRICS];
+	u64 First, Prev, Cur;
+	u32 Idx, Sample;
+	u8 Metric;
+	u16 Col, Row;
+
+	XAie_AssertNonvoid(ProfPtr != XAIE_NULL);
+
+	if (Buf != XAIE_NULL && Size != 0U) {
+		Buf[0] = '\0';
+	}
+
+	_XAieTile_ProfPrint(&Out, "{\"displayTimeUnit\":\"ns\","
+			"\"traceEvents\":[");
+
+	for (Idx = 0U; Idx < ProfPtr->NumKernels; Idx++) {
+		KernelPtr = &ProfPtr->Kernels[Idx];
+		Col = KernelPtr->TileInstPtr->ColId;
+		Row = KernelPtr->TileInstPtr->RowId;
+
+		_XAieTile_ProfPrint(&Out, "%s\n{\"name\":\"process_name\","
+				"\"ph\":\"M\",\"pid\":%u,\"args\":{\"name\":"
+				"\"column %u\"}},\n{\"name\":\"thread_name\","
+				"\"ph\":\"M\",\"pid\":%u,\"tid\":%u,\"args\":"
+				"{\"name\":", (Idx != 0U) ? "," : "", Col, Col,
+				Col, Row);
+		_XAieTile_ProfPrintStr(&Out, KernelPtr->Name);
+		_XAieTile_ProfPrint(&Out, "}}");
+
+		if (ProfPtr->NumSamples < 2U) {
+			continue;
+		}
+
+		/* Metrics of each interval, at the start of the interval */
+		First = ProfPtr->Timestamps[Idx];
+		for (Sample = 1U; Sample < ProfPtr->NumSamples; Sample++) {
+			Prev = ProfPtr->Timestamps[(Sample - 1U) *
+				ProfPtr->NumKernels + Idx];
+			Cur = ProfPtr->Timestamps[Sample * ProfPtr->NumKernels +
+				Idx];
+			for (Metric = 0U; Metric < KernelPtr->NumMetrics;
+					Metric++) {
+				Counts[Metric] = _XAieTile_ProfDelta(ProfPtr,
+						Sample, Idx, Metric);
+			}
+
+			_XAieTile_ProfPrint(&Out, ",\n{\"name\":");
+			_XAieTile_ProfPrintStr(&Out, KernelPtr->Name);
+			_XAieTile_ProfPrint(&Out, ",\"ph\":\"C\",\"pid\":%u,"
+					"\"tid\":%u,\"ts\":", Col, Row);
+			_XAieTile_ProfPrintUs(&Out, Prev - First,
+					ProfPtr->ClockMHz);
+			_XAieTile_ProfPrint(&Out, ",\"args\":{");
+			_XAieTile_ProfPrintMetrics(&Out, KernelPtr, Counts,
+					Cur - Prev, 0U);
+			_XAieTile_ProfPrint(&Out, "}}");
+		}
+
+		/* Breakdown over the whole profile */
+		for (Metric = 0U; Metric < KernelPtr->NumMetrics; Metric++) {
+			Counts[Metric] = XAieTile_ProfGetTotal(ProfPtr, Idx,
+					Metric, &Cur);
+		}
+
+		_XAieTile_ProfPrint(&Out, ",\n{\"name\":");
+		_XAieTile_ProfPrintStr(&Out, KernelPtr->Name);
+		_XAieTile_ProfPrint(&Out, ",\"ph\":\"X\",\"pid\":%u,\"tid\":%u,"
+				"\"ts\":0,\"dur\":", Col, Row);
+		_XAieTile_ProfPrintUs(&Out, Cur, ProfPtr->ClockMHz);
+		_XAieTile_ProfPrint(&Out, ",\"args\":{\"cycles\":%llu",
+				(unsigned long long)Cur);
+		_XAieTile_ProfPrintMetrics(&Out, KernelPtr, Counts, Cur, 1U);
+		_XAieTile_ProfPrint(&Out, "}}");
+	}
+
+	_XAieTile_ProfPrint(&Out, "\n]}\n");
+
+	return Out.Len;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API traces the core events of the metrics of a kernel to a host
+* buffer. The trace stream goes down the column of the kernel on a circuit
+* switched route, to a shim DMA S2MM channel.
+*
+* @param	ProfPtr - Pointer to the profiling instance.
+* @param	Kernel - Index of the kernel to trace.
+* @param	ShimTilePtr - Pointer to the shim tile of the column of the
+*		kernel. The tiles of the column must follow it in memory, as
+*		laid out by XAieGbl_CfgInitialize().
+* @param	StrmIdx - Index of the south master and north slave ports used
+*		for the route in the column, 0 to 3.
+* @param	ChNum - XAIEDMA_SHIM_CHNUM_S2MM0 or XAIEDMA_SHIM_CHNUM_S2MM1.
+* @param	BdNum - BD of the channel to use.
+* @param	MemInstPtr - Host buffer for the trace, 128 bit aligned.
+*
+* @return	XAIE_SUCCESS on success, XAIE_FAILURE if a trace is already
+*		running or the kernel has no core metric.
+*
+* @note		The trace stops when the buffer is full. Only one kernel is
+*		traced at a time.
+*
+*******************************************************************************/
+u32 XAieTile_ProfTraceStart(XAieTile_Prof *ProfPtr, u32 Kernel,
+		XAieGbl_Tile *ShimTilePtr, u8 StrmIdx, u8 ChNum, u8 BdNum,
+		XAieLib_MemInst *MemInstPtr)
+{
+	const XAieTile_ProfKernel *KernelPtr;
+	XAieGbl_Tile *TileInstPtr;
+	XAieDma_Shim *DmaPtr = &ProfPtr->TraceDma;
+	u64 Paddr;
+	u16 Row;
+	u8 Metric, Slot = 0U;
+
+	XAie_AssertNonvoid(ProfPtr != XAIE_NULL);
+	XAie_AssertNonvoid(Kernel < ProfPtr->NumKernels);
+	XAie_AssertNonvoid(ShimTilePtr != XAIE_NULL);
+	XAie_AssertNonvoid(MemInstPtr != XAIE_NULL);
+	XAie_AssertNonvoid(StrmIdx < 4U);
+	XAie_AssertNonvoid(ChNum == XAIEDMA_SHIM_CHNUM_S2MM0 ||
+			ChNum == XAIEDMA_SHIM_CHNUM_S2MM1);
+
+	KernelPtr = &ProfPtr->Kernels[Kernel];
+	TileInstPtr = KernelPtr->TileInstPtr;
+	XAie_AssertNonvoid(TileInstPtr->TileType == XAIEGBL_TILE_TYPE_AIETILE);
+	XAie_AssertNonvoid(ShimTilePtr->ColId == TileInstPtr->ColId);
+
+	for (Metric = 0U; Metric < KernelPtr->NumMetrics; Metric++) {
+		if (KernelPtr->Metrics[Metric].Module ==
+				XAIETILE_PROF_MODULE_CORE) {
+			Slot++;
+		}
+	}
+	if (ProfPtr->TraceTilePtr != XAIE_NULL || Slot == 0U) {
+		return XAIE_FAILURE;
+	}
+
+	/* Shim DMA writing the trace to the host buffer */
+	Paddr = XAieLib_MemGetPaddr(MemInstPtr);
+	XAieDma_ShimSoftInitialize(ShimTilePtr, DmaPtr);
+	XAieDma_ShimBdClear(DmaPtr, BdNum);
+	XAieDma_ShimBdSetAddr(DmaPtr, BdNum, (u16)(Paddr >> 32U), (u32)Paddr,
+			(u32)XAieLib_MemGetSize(MemInstPtr) &
+			~XAIEDMA_SHIM_TXFER_LEN32_MASK);
+	XAieDma_ShimBdWrite(DmaPtr, BdNum);
+	XAieDma_ShimChControl(DmaPtr, ChNum, XAIE_DISABLE, XAIE_DISABLE,
+			XAIE_ENABLE);
+	XAieDma_ShimSetStartBd(DmaPtr, ChNum, BdNum);
+
+	/* Route from the trace port down to the shim DMA */
+	XAieTile_StrmConnectCct(TileInstPtr,
+			XAIETILE_STRSW_SPORT_TRACE(TileInstPtr, 0U),
+			XAIETILE_STRSW_MPORT_SOUTH(TileInstPtr, StrmIdx),
+			XAIE_ENABLE);
+	for (Row = TileInstPtr->RowId - 1U; Row > 0U; Row--) {
+		XAieTile_StrmConnectCct(&ShimTilePtr[Row],
+				XAIETILE_STRSW_SPORT_NORTH(&ShimTilePtr[Row],
+					StrmIdx),
+				XAIETILE_STRSW_MPORT_SOUTH(&ShimTilePtr[Row],
+					StrmIdx),
+				XAIE_ENABLE);
+	}
+	XAieTile_StrmConnectCct(ShimTilePtr,
+			XAIETILE_STRSW_SPORT_NORTH(ShimTilePtr, StrmIdx),
+			XAIETILE_STRSW_MPORT_SOUTH(ShimTilePtr, 2U + ChNum),
+			XAIE_ENABLE);
+	XAieTile_ShimStrmDemuxConfig(ShimTilePtr,
+			XAIETILE_SHIM_STRM_DEM_SOUTH2 + ChNum,
+			XAIETILE_SHIM_STRM_DEM_DMA);
+
+	/* Trace the core events of the metrics, from now on */
+	Slot = 0U;
+	for (Metric = 0U; Metric < KernelPtr->NumMetrics; Metric++) {
+		if (KernelPtr->Metrics[Metric].Module ==
+				XAIETILE_PROF_MODULE_CORE) {
+			XAieTileCore_EventTraceEventWriteId(TileInstPtr,
+					KernelPtr->Metrics[Metric].Event,
+					Slot++);
+		}
+	}
+	XAieTileCore_EventTraceControl(TileInstPtr,
+			XAIETILE_EVENT_MODE_EVENT_TIME,
+			XAIETILE_EVENT_CORE_TRUE, XAIETILE_EVENT_CORE_NONE,
+			0U, 0U);
+
+	ProfPtr->TraceTilePtr = TileInstPtr;
+	ProfPtr->TraceChNum = ChNum;
+
+	return XAIE_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This API stops the trace and the shim DMA channel offloading it.
+*
+* @param	ProfPtr - Pointer to the profiling instance.
+*
+* @return	None.
+*
+* @note		The host buffer has to be synchronized with
+*		XAieLib_MemSyncForCPU() before reading the trace. The route is
+*		left in place.
+*
+*******************************************************************************/
+void XAieTile_ProfTraceStop(XAieTile_Prof *ProfPtr)
+{
+	XAie_AssertVoid(ProfPtr != XAIE_NULL);
+
+	if (ProfPtr->TraceTilePtr == XAIE_NULL) {
+		return;
+	}
+
+	/* Stop on the event that's always asserted */
+	XAieTileCore_EventTraceControl(ProfPtr->TraceTilePtr,
+			XAIETILE_EVENT_TRACING_INVALID_VAL,
+			XAIETILE_EVENT_CORE_NONE, XAIETILE_EVENT_CORE_TRUE,
+			XAIETILE_EVENT_TRACING_INVALID_VAL,
+			XAIETILE_EVENT_TRACING_INVALID_VAL);
+	XAieDma_ShimChControl(&ProfPtr->TraceDma, ProfPtr->TraceChNum,
+			XAIE_DISABLE, XAIE_DISABLE, XAIE_DISABLE);
+
+	ProfPtr->TraceTilePtr = XAIE_NULL;
+}
+
+/** @} */
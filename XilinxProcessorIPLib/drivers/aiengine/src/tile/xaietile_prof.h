@@ -0,0 +1,100 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+* @file xaietile_prof.h
+* @{
+*
+*  Header file for the profiling service
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- -----------------------------------------------------
+* 1.0  agt     10/17/2026  Initial creation
+* </pre>
+*
+******************************************************************************/
+#ifndef XAIETILE_PROF_H
+#define XAIETILE_PROF_H
+
+/***************************** Include Files *********************************/
+#include "xaiedma_shim.h"
+
+/***************************** Constant Definitions **************************/
+/* Modules of the metrics */
+#define XAIETILE_PROF_MODULE_CORE		0U
+#define XAIETILE_PROF_MODULE_MEM		1U
+#define XAIETILE_PROF_MODULE_PL			2U
+
+/* Maximum number of metrics of a kernel */
+#define XAIETILE_PROF_MAX_METRICS		8U
+
+/* Number of metrics of XAieTile_ProfCoreStalls[] */
+#define XAIETILE_PROF_NUM_CORE_STALLS		4U
+
+/***************************** Type Definitions ******************************/
+/**
+ * This typedef contains a metric, an event counted by a performance counter.
+ */
+typedef struct {
+	const char *Name;	/**< Name of the metric in the output */
+	u8 Module;		/**< XAIETILE_PROF_MODULE_* */
+	u8 Event;		/**< Event of the module, XAIETILE_EVENT_* */
+} XAieTile_ProfMetric;
+
+/**
+ * This typedef contains a kernel to profile, and the metrics to count in its
+ * tile. A tile has 4 core and 2 memory counters, and a shim tile has 2 PL
+ * counters.
+ */
+typedef struct {
+	XAieGbl_Tile *TileInstPtr;		/**< Tile of the kernel */
+	const char *Name;			/**< Name of the kernel */
+	const XAieTile_ProfMetric *Metrics;	/**< Metrics to count */
+	u8 NumMetrics;				/**< Number of metrics */
+} XAieTile_ProfKernel;
+
+/**
+ * This typedef is the profiling instance. User is required to allocate memory
+ * for this instance and a pointer of the same is passed to the profiling
+ * functions.
+ */
+typedef struct {
+	const XAieTile_ProfKernel *Kernels;	/**< Kernels to profile */
+	u32 NumKernels;				/**< Number of kernels */
+	u32 ClockMHz;				/**< Clock of the array */
+	u8 (*Counters)[XAIETILE_PROF_MAX_METRICS]; /**< Counter of each metric */
+	u32 MaxSamples;				/**< Size of the sample buffers */
+	u32 NumSamples;				/**< Samples collected */
+	u64 *Timestamps;			/**< Timer of each kernel, per sample */
+	u32 *Values;				/**< Counters of each kernel, per sample */
+	XAieGbl_Tile *TraceTilePtr;		/**< Traced tile, NULL if none */
+	XAieDma_Shim TraceDma;			/**< Shim DMA offloading the trace */
+	u8 TraceChNum;				/**< Shim DMA channel of the trace */
+} XAieTile_Prof;
+
+/***************************** Macro Definitions *****************************/
+
+/************************** Variable Definitions *****************************/
+extern const XAieTile_ProfMetric
+XAieTile_ProfCoreStalls[XAIETILE_PROF_NUM_CORE_STALLS];
+
+/************************** Function Prototypes  *****************************/
+u32 XAieTile_ProfInitialize(XAieTile_Prof *ProfPtr, const XAieTile_ProfKernel *Kernels, u32 NumKernels, u32 MaxSamples, u32 ClockMHz);
+void XAieTile_ProfFinish(XAieTile_Prof *ProfPtr);
+u32 XAieTile_ProfSample(XAieTile_Prof *ProfPtr);
+u32 XAieTile_ProfRun(XAieTile_Prof *ProfPtr, u32 NumSamples, u32 PeriodUs);
+u64 XAieTile_ProfGetTotal(XAieTile_Prof *ProfPtr, u32 Kernel, u8 Metric, u64 *CyclesPtr);
+u32 XAieTile_ProfExport(XAieTile_Prof *ProfPtr, char *Buf, u32 Size);
+u32 XAieTile_ProfTraceStart(XAieTile_Prof *ProfPtr, u32 Kernel, XAieGbl_Tile *ShimTilePtr, u8 StrmIdx, u8 ChNum, u8 BdNum, XAieLib_MemInst *MemInstPtr);
+void XAieTile_ProfTraceStop(XAieTile_Prof *ProfPtr);
+
+#endif		/* end of protection macro */
+
+/** @} */
@@ -9,6 +9,7 @@ extern "C" {
 
 #include <xaiengine/xaieconfig.h>
 #include <xaiengine/xaiedma_shim.h>
+#include <xaiengine/xaiedma_queue.h>
 #include <xaiengine/xaiedma_tile.h>
 #include <xaiengine/xaiegbl.h>
 #include <xaiengine/xaiegbl_defs.h>
@@ -26,6 +27,7 @@ extern "C" {
 #include <xaiengine/xaietile_perfcnt.h>
 #include <xaiengine/xaietile_pl.h>
 #include <xaiengine/xaietile_plif.h>
+#include <xaiengine/xaietile_prof.h>
 #include <xaiengine/xaietile_shim.h>
 #include <xaiengine/xaietile_strm.h>
 #include <xaiengine/xaietile_timer.h>
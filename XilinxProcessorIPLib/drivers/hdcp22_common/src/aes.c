@@ -25,6 +25,8 @@
 * ----- ---- -------- -----------------------------------------------
 * 1.00  MH   10/30/15 First Release
 * 1.01  MH   01/28/17 Fixed warnings and errors.
+* 1.10  agt  10/17/26 Added ARMv8 Crypto Extension block cipher with
+*                     runtime selection.
 *</pre>
 *
 *****************************************************************************/
@@ -33,6 +35,10 @@
 #include "string.h"
 #include "stdlib.h"
 #include "xil_types.h"
+#include "xhdcp22_common.h"
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#endif
 
 /************************** Constant Definitions *****************************/
 /* This is the specified AES SBox. To look up a substitution value, put the first
@@ -231,6 +237,10 @@ static void AesMixColumns(u8 State[][4]);
 static void AesInvMixColumns(u8 State[][4]);
 static void AesEncrypt(const u8 In[], u8 Out[], const u32 Key[], int KeySize);
 static void AesDecrypt(const u8 In[], u8 Out[], const u32 Key[], int KeySize);
+#if defined(__aarch64__)
+static void Aes128EncryptCe(const u8 In[], u8 Out[], const u32 Key[]);
+static void Aes128DecryptCe(const u8 In[], u8 Out[], const u32 Key[]);
+#endif
 #ifdef AES_CIPHER_CTR_MODE
 static void Xor(u8 *C, const u8 *A, const u8 *B, u32 Size);
 static void AesIncrementIv(u8 Iv[], int CounterSize);
@@ -262,6 +272,12 @@ void XHdcp22Cmn_Aes128Encrypt(const u8 *Data, const u8 *Key, u8 *Output)
 
 	/* Setup the AES internal key */
 	AesKeySetup(Key, KeySchedule, 128);
+#if defined(__aarch64__)
+	if (XHdcp22Cmn_HasCryptoExt(XHDCP22_CMN_CRYPTO_EXT_AES)) {
+		Aes128EncryptCe(Data, Output, KeySchedule);
+		return;
+	}
+#endif
 	/* Encrypt 128-bits*/
 	AesEncrypt(Data, Output, KeySchedule, 128);
 }
@@ -286,10 +302,99 @@ void XHdcp22Cmn_Aes128Decrypt(const u8 *Data, const u8 *Key, u8 *Output)
 
 	/* Setup the AES internal key */
 	AesKeySetup(Key, KeySchedule, 128);
+#if defined(__aarch64__)
+	if (XHdcp22Cmn_HasCryptoExt(XHDCP22_CMN_CRYPTO_EXT_AES)) {
+		Aes128DecryptCe(Data, Output, KeySchedule);
+		return;
+	}
+#endif
 	/* Encrypt 128-bits*/
 	AesDecrypt(Data, Output, KeySchedule, 128);
 }
 
+#if defined(__aarch64__)
+/*****************************************************************************/
+/**
+*
+* This function loads one round key of the key schedule into a vector.
+* The key schedule words hold the key bytes in big endian order.
+*
+* @param	W is the round key (4 words).
+*
+* @return	Round key vector.
+*
+* @note		None.
+*
+******************************************************************************/
+static inline uint8x16_t AesLoadRoundKey(const u32 W[])
+{
+	return vrev32q_u8(vreinterpretq_u8_u32(vld1q_u32(W)));
+}
+
+/*****************************************************************************/
+/**
+*
+* This function encrypts one block with AES-128 using the ARMv8 Crypto
+* Extension AESE/AESMC instructions.
+*
+* @param	In is 16 bytes of plaintext
+* @param	Out is 16 bytes of ciphertext
+* @param	Key is from the key setup
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+__attribute__((target("+crypto")))
+static void Aes128EncryptCe(const u8 In[], u8 Out[], const u32 Key[])
+{
+	uint8x16_t State = vld1q_u8(In);
+	int Round;
+
+	for (Round = 0; Round < 9; Round++) {
+		State = vaesmcq_u8(vaeseq_u8(State, AesLoadRoundKey(&Key[4 * Round])));
+	}
+	State = vaeseq_u8(State, AesLoadRoundKey(&Key[36]));
+	State = veorq_u8(State, AesLoadRoundKey(&Key[40]));
+
+	vst1q_u8(Out, State);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function decrypts one block with AES-128 using the ARMv8 Crypto
+* Extension AESD/AESIMC instructions. The round keys of the equivalent
+* inverse cipher are derived from the encryption key schedule.
+*
+* @param	In is 16 bytes of ciphertext
+* @param	Out is 16 bytes of plaintext
+* @param	Key is from the key setup
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+__attribute__((target("+crypto")))
+static void Aes128DecryptCe(const u8 In[], u8 Out[], const u32 Key[])
+{
+	uint8x16_t State = vld1q_u8(In);
+	int Round;
+
+	State = vaesimcq_u8(vaesdq_u8(State, AesLoadRoundKey(&Key[40])));
+	for (Round = 9; Round > 1; Round--) {
+		State = vaesimcq_u8(vaesdq_u8(State,
+				vaesimcq_u8(AesLoadRoundKey(&Key[4 * Round]))));
+	}
+	State = vaesdq_u8(State, vaesimcq_u8(AesLoadRoundKey(&Key[4])));
+	State = veorq_u8(State, AesLoadRoundKey(&Key[0]));
+
+	vst1q_u8(Out, State);
+}
+#endif
+
 #ifdef AES_CIPHER_CTR_MODE
 /****************************************************************************/
 /**
@@ -2460,6 +2460,356 @@ u32 spSimpleRand(u32 lower, u32 upper)
 	return rand_between(lower, upper);
 }
 
+/************************/
+/* MONTGOMERY ARITHMETIC */
+/************************/
+/*	Montgomery-form modular arithmetic for odd moduli.
+	Numbers are held as xbar = x * R mod m with R = 2^(BITS_PER_DIGIT * ndigits), so
+	a modular product needs no long division: mpMontMult() interleaves the schoolbook
+	multiply with a word-by-word reduction (CIOS, Koc/Acar/Kaliski 1996) and finishes
+	with a single masked subtraction, making its timing independent of the operands.
+	Ref: Menezes, chap 14, Algorithm 14.36.
+*/
+
+/* Maximum window size for the Montgomery exponentiation tables.
+   The table holds 2^(k-1) (sliding) or 2^k (fixed) entries of MAX_FIXED_DIGITS each,
+   so this bounds the stack usage when NO_ALLOCS is set. */
+#ifndef MONT_MAX_WINLEN
+#define MONT_MAX_WINLEN 4
+#endif
+/* Fixed window size used by the constant-time exponentiation */
+#define MONT_CT_WINLEN 3
+#define MONT_CT_TBLSIZE (1 << MONT_CT_WINLEN)
+/* Number of odd powers held by the sliding-window table */
+#define MONT_SW_TBLSIZE (1 << (MONT_MAX_WINLEN - 1))
+
+/* Number of entries of the workspace table, large enough for both methods */
+#if MONT_SW_TBLSIZE > MONT_CT_TBLSIZE
+#define MONT_WS_TBLSIZE MONT_SW_TBLSIZE
+#else
+#define MONT_WS_TBLSIZE MONT_CT_TBLSIZE
+#endif
+
+#ifdef NO_ALLOCS
+/* Workspace of the Montgomery functions. At MAX_FIXED_DIGITS the table alone is
+   4 KB, more than the stack of the embedded targets allows, so the temps are held
+   statically. The Montgomery functions are therefore not reentrant: mpModExp(),
+   mpModExp_ct() and mpModExpCrt() must not be called from an interrupt handler
+   or another task while one of them is running. The busy flag catches such a
+   call in debug builds. */
+static int mont_ws_busy;
+#define MONT_WS_ENTER() do { assert(mont_ws_busy == 0); mont_ws_busy = 1; } while (0)
+#define MONT_WS_LEAVE() do { mont_ws_busy = 0; } while (0)
+static struct
+{
+	u32 t[MAX_FIXED_DIGITS + 2];	/* mpMontMult() product */
+	u32 d[MAX_FIXED_DIGITS];	/* mpMontMult() and mpMontSetup() difference */
+	u32 a[MAX_FIXED_DIGITS];	/* Accumulator of the exponentiations */
+	u32 u[MAX_FIXED_DIGITS];	/* Table entry or one of the exponentiations */
+	u32 r2[MAX_FIXED_DIGITS];	/* R^2 mod m */
+	u32 gtable[MONT_WS_TBLSIZE][MAX_FIXED_DIGITS];
+} mont_ws;
+#else
+#define MONT_WS_ENTER() do { } while (0)
+#define MONT_WS_LEAVE() do { } while (0)
+#endif
+
+/* Montgomery form needs an odd modulus. For m == 1, R mod m is 0 rather than the
+   1 that mpMontSetup() leaves, so that modulus is sent to the generic methods. */
+#define MONT_MODULUS_OK(m, ndigits) (ISODD((m)[0]) && mpShortCmp((m), 1, (ndigits)) > 0)
+
+/* Returns all-ones if a == b else zero, without branching */
+#define MONT_EQ_MASK(a, b) ((u32)0 - (u32)((((u32)(a) ^ (u32)(b)) - 1) >> (BITS_PER_DIGIT - 1)))
+
+static u32 mpMontInv(u32 m0)
+/* Returns m' = -m0^{-1} mod 2^32 for odd m0 using Newton iteration */
+{
+	u32 inv = m0;	/* Correct to 3 bits since m0 * m0 == 1 mod 8 */
+	int i;
+
+	for (i = 0; i < 4; i++)
+		inv *= 2 - m0 * inv;	/* Doubles the number of correct bits */
+
+	return (u32)0 - inv;
+}
+
+static void mpMontMult(u32 w[], const u32 x[], const u32 y[],
+			const u32 m[], u32 minv, size_t ndigits)
+/* Computes w = x * y * R^{-1} mod m in constant time.
+   Requires m odd and x * y < m * R. w may overlap x or y. */
+{
+	u64 uv;
+	u32 c, u, borrow, mask;
+	size_t i, j;
+#ifdef NO_ALLOCS
+	u32 *t = mont_ws.t;
+	u32 *d = mont_ws.d;
+	assert(ndigits <= MAX_FIXED_DIGITS);
+#else
+	u32 *t, *d;
+	t = mpAlloc(ndigits + 2);
+	d = mpAlloc(ndigits);
+#endif
+
+	mpSetZero(t, ndigits + 2);
+	for (i = 0; i < ndigits; i++)
+	{
+		/* t = t + x * y[i] */
+		c = 0;
+		for (j = 0; j < ndigits; j++)
+		{
+			uv = (u64)x[j] * y[i] + t[j] + c;
+			t[j] = (u32)uv;
+			c = (u32)(uv >> BITS_PER_DIGIT);
+		}
+		uv = (u64)t[ndigits] + c;
+		t[ndigits] = (u32)uv;
+		t[ndigits + 1] = (u32)(uv >> BITS_PER_DIGIT);
+
+		/* t = (t + u * m) / 2^32 where u makes the low digit vanish */
+		u = t[0] * minv;
+		uv = (u64)u * m[0] + t[0];
+		c = (u32)(uv >> BITS_PER_DIGIT);
+		for (j = 1; j < ndigits; j++)
+		{
+			uv = (u64)u * m[j] + t[j] + c;
+			t[j - 1] = (u32)uv;
+			c = (u32)(uv >> BITS_PER_DIGIT);
+		}
+		uv = (u64)t[ndigits] + c;
+		t[ndigits - 1] = (u32)uv;
+		t[ndigits] = t[ndigits + 1] + (u32)(uv >> BITS_PER_DIGIT);
+	}
+
+	/* t < 2m so at most one subtraction; select the result with a mask */
+	borrow = mpSubtract(d, t, m, ndigits);
+	mask = (u32)0 - ((t[ndigits] | (borrow ^ 1)) & 1);
+	for (j = 0; j < ndigits; j++)
+		w[j] = (d[j] & mask) | (t[j] & ~mask);
+
+	mpDESTROY(t, ndigits + 2);
+	mpDESTROY(d, ndigits);
+}
+
+static void mpMontDouble(u32 r[], u32 d[], const u32 m[], size_t ndigits)
+/* Computes r = 2r mod m for r < m using d as temp, without branching on r or m */
+{
+	u32 carry, borrow, mask;
+	size_t j;
+
+	carry = mpShiftLeft(r, r, 1, ndigits);
+	borrow = mpSubtract(d, r, m, ndigits);
+	mask = (u32)0 - ((carry | (borrow ^ 1)) & 1);
+	for (j = 0; j < ndigits; j++)
+		r[j] = (d[j] & mask) | (r[j] & ~mask);
+}
+
+static void mpMontSetup(u32 one[], u32 r2[], const u32 m[], size_t ndigits)
+/* Computes one = R mod m and r2 = R^2 mod m for odd m > 1. The modulus may be
+   secret, so both are found by modular doubling of 1 whose sequence of
+   operations depends only on ndigits. */
+{
+	size_t i;
+#ifdef NO_ALLOCS
+	u32 *d = mont_ws.d;
+	assert(ndigits <= MAX_FIXED_DIGITS);
+#else
+	u32 *d;
+	d = mpAlloc(ndigits);
+#endif
+	assert(MONT_MODULUS_OK(m, ndigits));
+
+	mpSetDigit(one, 1, ndigits);
+	for (i = 0; i < ndigits * BITS_PER_DIGIT; i++)
+		mpMontDouble(one, d, m, ndigits);
+
+	mpSetEqual(r2, one, ndigits);
+	for (i = 0; i < ndigits * BITS_PER_DIGIT; i++)
+		mpMontDouble(r2, d, m, ndigits);
+
+	mpDESTROY(d, ndigits);
+}
+
+static int mpModExp_mont(u32 yout[], const u32 x[], const u32 e[], u32 m[], size_t ndigits)
+/* Computes y = x^e mod m for odd m using sliding-window exponentiation in
+   Montgomery form. Not constant-time: use only with public exponents. */
+{
+	size_t nbits, winlen, ngt;
+	size_t i, l, k;
+	int aisone;
+	u32 minv, idx;
+#ifdef NO_ALLOCS
+	u32 *a = mont_ws.a;
+	u32 *one = mont_ws.u;
+	u32 *r2 = mont_ws.r2;
+	u32 (*gtable)[MAX_FIXED_DIGITS] = mont_ws.gtable;
+	assert(ndigits <= MAX_FIXED_DIGITS);
+#else
+	u32 *a, *one, *r2;
+	u32 *gtable[MONT_SW_TBLSIZE];
+	a = mpAlloc(ndigits);
+	one = mpAlloc(ndigits);
+	r2 = mpAlloc(ndigits);
+	for (i = 0; i < MONT_SW_TBLSIZE; i++)
+		gtable[i] = mpAlloc(ndigits);
+#endif
+	MONT_WS_ENTER();
+
+	nbits = mpBitLength(e, ndigits);
+	/* Catch e==0 => x^0=1 */
+	if (0 == nbits)
+	{
+		mpSetDigit(yout, 1, ndigits);
+		goto done;
+	}
+
+	/* Same break-even points as WindowLenTable[] */
+	if (nbits <= 5)
+		winlen = 1;
+	else if (nbits <= 16)
+		winlen = 2;
+	else if (nbits <= 64)
+		winlen = 3;
+	else
+		winlen = MONT_MAX_WINLEN;
+	ngt = (size_t)1 << (winlen - 1);
+
+	minv = mpMontInv(m[0]);
+	mpMontSetup(one, r2, m, ndigits);
+
+	/* 1. Precomputation: gtable[i] = xbar^(2i+1), using a as xbar^2 */
+	mpMontMult(gtable[0], x, r2, m, minv, ndigits);
+	mpMontMult(a, gtable[0], gtable[0], m, minv, ndigits);
+	for (i = 1; i < ngt; i++)
+		mpMontMult(gtable[i], gtable[i - 1], a, m, minv, ndigits);
+
+	/* 2. A <-- 1, i <-- t */
+	aisone = 1;
+	i = nbits;
+	/* 3. While i >= 0 (i counts bits still to process) */
+	while (i > 0)
+	{
+		if (!mpGetBit((u32 *)e, ndigits, i - 1))
+		{
+			/* 3.1 A <-- A^2 */
+			if (!aisone)
+				mpMontMult(a, a, a, m, minv, ndigits);
+			i--;
+			continue;
+		}
+		/* 3.2 Find the longest window e_i...e_l with e_l = 1 */
+		l = (i > winlen) ? i - winlen : 0;
+		while (!mpGetBit((u32 *)e, ndigits, l))
+			l++;
+		idx = 0;
+		for (k = i; k > l; k--)
+		{
+			idx = (idx << 1) | (u32)mpGetBit((u32 *)e, ndigits, k - 1);
+			if (!aisone)
+				mpMontMult(a, a, a, m, minv, ndigits);
+		}
+		if (aisone)
+		{
+			mpSetEqual(a, gtable[idx >> 1], ndigits);
+			aisone = 0;
+		}
+		else
+		{
+			mpMontMult(a, a, gtable[idx >> 1], m, minv, ndigits);
+		}
+		i = l;
+	}
+
+	/* 4. Return A out of Montgomery form */
+	mpSetZero(one, ndigits);
+	one[0] = 1;
+	mpMontMult(yout, a, one, m, minv, ndigits);
+
+done:
+	mpDESTROY(a, ndigits);
+	mpDESTROY(one, ndigits);
+	mpDESTROY(r2, ndigits);
+	for (i = 0; i < MONT_SW_TBLSIZE; i++)
+		mpDESTROY(gtable[i], ndigits);
+	MONT_WS_LEAVE();
+
+	return 0;
+}
+
+static int mpModExp_mont_ct(u32 yout[], const u32 x[], const u32 e[], u32 m[], size_t ndigits)
+/* Computes y = x^e mod m for odd m using fixed-window exponentiation in
+   Montgomery form. The sequence of operations and memory accesses depends only
+   on ndigits: every window is processed and the table entry is read with a
+   masked scan of the whole table. */
+{
+	size_t i, j, nwin;
+	int b;
+	u32 minv, idx, mask;
+#ifdef NO_ALLOCS
+	u32 *a = mont_ws.a;
+	u32 *t = mont_ws.u;
+	u32 *r2 = mont_ws.r2;
+	u32 (*gtable)[MAX_FIXED_DIGITS] = mont_ws.gtable;
+	assert(ndigits <= MAX_FIXED_DIGITS);
+#else
+	u32 *a, *t, *r2;
+	u32 *gtable[MONT_CT_TBLSIZE];
+	a = mpAlloc(ndigits);
+	t = mpAlloc(ndigits);
+	r2 = mpAlloc(ndigits);
+	for (i = 0; i < MONT_CT_TBLSIZE; i++)
+		gtable[i] = mpAlloc(ndigits);
+#endif
+	MONT_WS_ENTER();
+
+	minv = mpMontInv(m[0]);
+	mpMontSetup(gtable[0], r2, m, ndigits);
+
+	/* gtable[i] = xbar^i */
+	mpMontMult(gtable[1], x, r2, m, minv, ndigits);
+	for (i = 2; i < MONT_CT_TBLSIZE; i++)
+		mpMontMult(gtable[i], gtable[i - 1], gtable[1], m, minv, ndigits);
+
+	/* Process all ndigits * BITS_PER_DIGIT bits of e, top window first */
+	mpSetEqual(a, gtable[0], ndigits);
+	nwin = (ndigits * BITS_PER_DIGIT + MONT_CT_WINLEN - 1) / MONT_CT_WINLEN;
+	while (nwin--)
+	{
+		idx = 0;
+		for (b = MONT_CT_WINLEN - 1; b >= 0; b--)
+		{
+			mpMontMult(a, a, a, m, minv, ndigits);
+			i = nwin * MONT_CT_WINLEN + b;
+			idx <<= 1;
+			if (i < ndigits * BITS_PER_DIGIT)
+				idx |= (e[i / BITS_PER_DIGIT] >> (i % BITS_PER_DIGIT)) & 1;
+		}
+		/* t = gtable[idx] */
+		mpSetZero(t, ndigits);
+		for (i = 0; i < MONT_CT_TBLSIZE; i++)
+		{
+			mask = MONT_EQ_MASK(i, idx);
+			for (j = 0; j < ndigits; j++)
+				t[j] |= gtable[i][j] & mask;
+		}
+		mpMontMult(a, a, t, m, minv, ndigits);
+	}
+
+	/* Return A out of Montgomery form */
+	mpSetZero(t, ndigits);
+	t[0] = 1;
+	mpMontMult(yout, a, t, m, minv, ndigits);
+
+	mpDESTROY(a, ndigits);
+	mpDESTROY(t, ndigits);
+	mpDESTROY(r2, ndigits);
+	for (i = 0; i < MONT_CT_TBLSIZE; i++)
+		mpDESTROY(gtable[i], ndigits);
+	MONT_WS_LEAVE();
+
+	return 0;
+}
+
 /**************************/
 /* MODULAR EXPONENTIATION */
 /**************************/
@@ -2476,6 +2826,9 @@ static int mpModExp_windowed(u32 y[], const u32 x[], const u32 n[], u32 d[], siz
 int mpModExp(u32 y[], const u32 x[], const u32 n[], u32 d[], size_t ndigits)
 	/* Computes y = x^n mod d */
 {
+	/* Odd moduli (all RSA moduli) avoid long division using Montgomery form */
+	if (MONT_MODULUS_OK(d, ndigits))
+		return mpModExp_mont(y, x, n, d, ndigits);
 #ifdef NO_ALLOCS
 	return mpModExp_1(y, x, n, d, ndigits);
 #else
@@ -2559,8 +2912,7 @@ done:
 	return 0;
 }
 
-/**	Computes y = x^e mod m in constant time using Coron's algorithm */
-int mpModExp_ct(u32 yout[], const u32 x[], const u32 e[], u32 m[], size_t ndigits)
+static int mpModExp_coron(u32 yout[], const u32 x[], const u32 e[], u32 m[], size_t ndigits)
 {
 	/* Algorithm: Corons exponentiation (left-to-right)
 	 * Square-and-multiply resistant against simple power attacks (SPA)
@@ -2647,6 +2999,78 @@ done:
 }
 
 
+/**	Computes y = x^e mod m in constant time using Coron's algorithm */
+int mpModExp_ct(u32 yout[], const u32 x[], const u32 e[], u32 m[], size_t ndigits)
+{
+	/* Odd moduli use the fixed-window Montgomery method instead. Dispatched
+	   here so that the double-length temps of Coron's method are not put on
+	   the stack for them. */
+	if (MONT_MODULUS_OK(m, ndigits))
+		return mpModExp_mont_ct(yout, x, e, m, ndigits);
+
+	return mpModExp_coron(yout, x, e, m, ndigits);
+}
+
+
+int mpModExpCrt(u32 y[], const u32 c[], u32 p[], u32 q[],
+			const u32 dp[], const u32 dq[], const u32 qinv[], size_t ndigits)
+{	/*	Computes y = c^d mod (p * q) using the Chinese Remainder Theorem
+		where p, q, dp, dq, qinv are ndigits long and c, y are 2 * ndigits long.
+		Ref: PKCS#1 v2.1, Section 5.1.2 with u = 2.
+		The half-size exponentiations use mpModExp_ct(). */
+	size_t nn = ndigits * 2;
+	u32 borrow, mask;
+	size_t i;
+#ifdef NO_ALLOCS
+	u32 cp[MAX_FIXED_DIGITS];
+	u32 m1[MAX_FIXED_DIGITS];
+	u32 m2[MAX_FIXED_DIGITS];
+	u32 h[MAX_FIXED_DIGITS];
+	u32 t[MAX_FIXED_DIGITS];
+	assert(nn <= MAX_FIXED_DIGITS);
+#else
+	u32 *cp, *m1, *m2, *h, *t;
+	cp = mpAlloc(ndigits);
+	m1 = mpAlloc(ndigits);
+	m2 = mpAlloc(ndigits);
+	h = mpAlloc(ndigits);
+	t = mpAlloc(nn);
+#endif
+
+	/* m1 = c^dp mod p */
+	mpModulo(cp, c, nn, p, ndigits);
+	mpModExp_ct(m1, cp, dp, p, ndigits);
+
+	/* m2 = c^dq mod q */
+	mpModulo(cp, c, nn, q, ndigits);
+	mpModExp_ct(m2, cp, dq, q, ndigits);
+
+	/* h = qinv * (m1 - m2) mod p, adding p back without a branch */
+	mpModulo(cp, m2, ndigits, p, ndigits);
+	borrow = mpSubtract(h, m1, cp, ndigits);
+	mask = (u32)0 - borrow;
+	for (i = 0; i < ndigits; i++)
+		cp[i] = p[i] & mask;
+	mpAdd(h, h, cp, ndigits);
+	mpModMult(h, h, qinv, p, ndigits);
+
+	/* y = m2 + q * h */
+	mpMultiply(t, q, h, ndigits);
+	mpSetZero(y, nn);
+	mpSetEqual(y, m2, ndigits);
+	mpAdd(y, y, t, nn);
+
+	mpDESTROY(cp, ndigits);
+	mpDESTROY(m1, ndigits);
+	mpDESTROY(m2, ndigits);
+	mpDESTROY(h, ndigits);
+	mpDESTROY(t, nn);
+
+	return 0;
+}
+
+
+
 
 /* Use sliding window alternative only if NO_ALLOCS not defined */
 #ifndef NO_ALLOCS
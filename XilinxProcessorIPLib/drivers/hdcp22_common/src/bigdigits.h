@@ -193,17 +193,29 @@ int mpIsZero_q(const u32 a[], size_t ndigits);
 /* [v2.2] removed `const` restriction on m[] for mpModMult and mpModExp
  * (to allow faster in-place manipulation instead of using a temp variable).
  * [v2.5] added mpModExp_ct(), a constant-time variant of mpModExp().
+ * With NO_ALLOCS the Montgomery methods share a static workspace, so
+ * mpModExp(), mpModExp_ct() and mpModExpCrt() are not reentrant. Do not call
+ * them from an interrupt handler or from two tasks at once.
  */
 
-/** Computes y = x^e mod m */
+/** Computes y = x^e mod m
+ *  @remark Odd moduli use sliding-window Montgomery exponentiation. Not constant-time.
+ */
 int mpModExp(u32 y[], const u32 x[], const u32 e[], u32 m[], size_t ndigits);
 
 /**	Computes y = x^e mod m in constant time
  *  @remark Resistant to simple power analysis attack on private exponent.
- *  Slower than mpModExp().
+ *  Slower than mpModExp(). Odd moduli use fixed-window Montgomery exponentiation.
  */
 int mpModExp_ct(u32 yout[], const u32 x[], const u32 e[], u32 m[], size_t ndigits);
 
+/**	Computes y = c^d mod (p * q) using the Chinese Remainder Theorem
+ *  @remark p, q, dp, dq and qinv are ndigits long; c and y are 2 * ndigits long.
+ *  Uses mpModExp_ct() for the half-size exponentiations.
+ */
+int mpModExpCrt(u32 y[], const u32 c[], u32 p[], u32 q[],
+	const u32 dp[], const u32 dq[], const u32 qinv[], size_t ndigits);
+
 /** Computes a = (x * y) mod m */
 int mpModMult(u32 a[], const u32 x[], const u32 y[], u32 m[], size_t ndigits);
 
@@ -16,6 +16,10 @@
 * ----- ---- -------- -----------------------------------------------
 * 1.00  MH   10/30/15 First Release
 * 1.10  GM   10/14/19 Added "volatile" attribute to all "i" variables
+* 1.20  agt  10/17/26 Added ARMv8 Crypto Extension transform with runtime
+*                     selection and hashing of whole blocks in place
+*       agt  10/17/26 Added XHdcp22Cmn_TestUseCryptoExt for the known
+*                     answer tests
 *</pre>
 *
 *****************************************************************************/
@@ -23,6 +27,10 @@
 /***************************** Include Files ********************************/
 #include "string.h"
 #include "xil_types.h"
+#include "xhdcp22_common.h"
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#endif
 
 /**************************** Type Definitions ******************************/
 typedef struct {
@@ -45,6 +53,14 @@ typedef struct {
 #define SIG0(x) (ROTRIGHT(x,7) ^ ROTRIGHT(x,18) ^ ((x) >> 3))
 #define SIG1(x) (ROTRIGHT(x,17) ^ ROTRIGHT(x,19) ^ ((x) >> 10))
 
+#if defined(__aarch64__)
+/* ID_AA64ISAR0_EL1 fields */
+#define ISAR0_AES_SHIFT  4
+#define ISAR0_SHA2_SHIFT 12
+#define ISAR0_FIELD_MASK 0xF
+#define CRYPTO_EXT_UNKNOWN 0xFF
+#endif
+
 /************************** Variable Definitions ****************************/
 static const u32 k[64] = {
    0x428a2f98,0x71374491,0xb5c0fbcf,0xe9b5dba5,0x3956c25b,0x59f111f1,0x923f82a4,0xab1c5ed5,
@@ -57,10 +73,19 @@ static const u32 k[64] = {
    0x748f82ee,0x78a5636f,0x84c87814,0x8cc70208,0x90befffa,0xa4506ceb,0xbef9a3f7,0xc67178f2
 };
 
+#ifdef _XHDCP22_COMMON_TEST_
+/* Cleared by the known answer tests to run the portable C code */
+static u8 CryptoExtEnabled = TRUE;
+#endif
+
 /************************** Function Prototypes *****************************/
 
 /* SHA-256 Hashing */
-static void Sha256Transform(Sha256Type *Ctx, u8 *Data);
+static void Sha256Transform(Sha256Type *Ctx, const u8 *Data);
+static void Sha256TransformC(Sha256Type *Ctx, const u8 *Data);
+#if defined(__aarch64__)
+static void Sha256TransformCe(Sha256Type *Ctx, const u8 *Data);
+#endif
 static void Sha256Init(Sha256Type *Ctx);
 static void Sha256Update(Sha256Type *Ctx, const u8 *Data, u32 Len);
 static void Sha256Final(Sha256Type *Ctx, u8 *Hash);
@@ -93,17 +118,150 @@ void XHdcp22Cmn_Sha256Hash(const u8 *Data, u32 DataSize, u8 *HashedData)
 
 /*****************************************************************************/
 /**
-* This function executes a SHA256 transformation.
+*
+* This function reports the ARMv8 Crypto Extension instructions implemented
+* by the processor. The ID register is read once and the result is cached.
+*
+* @param  Feature is XHDCP22_CMN_CRYPTO_EXT_AES or
+*         XHDCP22_CMN_CRYPTO_EXT_SHA2.
+*
+* @return TRUE if the instructions are implemented, FALSE otherwise.
+*
+* @note   Always FALSE for processors other than ARMv8-A AArch64.
+*
+******************************************************************************/
+u8 XHdcp22Cmn_HasCryptoExt(u32 Feature)
+{
+#if defined(__aarch64__)
+	static u32 Aes = CRYPTO_EXT_UNKNOWN;
+	static u32 Sha2 = CRYPTO_EXT_UNKNOWN;
+	u64 Isar0;
+
+#ifdef _XHDCP22_COMMON_TEST_
+	if (!CryptoExtEnabled)
+		return FALSE;
+#endif
+	if (Aes == CRYPTO_EXT_UNKNOWN) {
+		__asm__ __volatile__("mrs %0, ID_AA64ISAR0_EL1" : "=r" (Isar0));
+		Aes = (Isar0 >> ISAR0_AES_SHIFT) & ISAR0_FIELD_MASK;
+		Sha2 = (Isar0 >> ISAR0_SHA2_SHIFT) & ISAR0_FIELD_MASK;
+	}
+
+	if (Feature == XHDCP22_CMN_CRYPTO_EXT_AES)
+		return (Aes != 0) ? TRUE : FALSE;
+	if (Feature == XHDCP22_CMN_CRYPTO_EXT_SHA2)
+		return (Sha2 != 0) ? TRUE : FALSE;
+#else
+	(void)Feature;
+#endif
+	return FALSE;
+}
+
+#ifdef _XHDCP22_COMMON_TEST_
+/*****************************************************************************/
+/**
+*
+* This function selects whether XHdcp22Cmn_HasCryptoExt reports the ARMv8
+* Crypto Extension, so the known answer tests can run both the Crypto
+* Extension code and the portable C code.
+*
+* @param  Enable is FALSE to run the portable C code, TRUE to use the
+*         Crypto Extension when the processor implements it.
+*
+* @return None.
+*
+* @note   None.
+*
+******************************************************************************/
+void XHdcp22Cmn_TestUseCryptoExt(u8 Enable)
+{
+	CryptoExtEnabled = Enable;
+}
+#endif
+
+/*****************************************************************************/
+/**
+* This function executes a SHA256 transformation using the fastest
+* implementation available on the processor.
 *
 * @param  Ctx is the context data for SHA256.
-* @param  Data is the data to transform.
+* @param  Data is the 64 byte block to transform.
 *
 * @return None.
 *
 * @note   None.
 *
 ******************************************************************************/
-static void Sha256Transform(Sha256Type *Ctx, u8 *Data)
+static void Sha256Transform(Sha256Type *Ctx, const u8 *Data)
+{
+#if defined(__aarch64__)
+	if (XHdcp22Cmn_HasCryptoExt(XHDCP22_CMN_CRYPTO_EXT_SHA2)) {
+		Sha256TransformCe(Ctx, Data);
+		return;
+	}
+#endif
+	Sha256TransformC(Ctx, Data);
+}
+
+#if defined(__aarch64__)
+/*****************************************************************************/
+/**
+* This function executes a SHA256 transformation with the ARMv8 Crypto
+* Extension SHA256H/SHA256H2/SHA256SU0/SHA256SU1 instructions. Each loop
+* iteration does four rounds and extends the message schedule by four words.
+*
+* @param  Ctx is the context data for SHA256.
+* @param  Data is the 64 byte block to transform.
+*
+* @return None.
+*
+* @note   None.
+*
+******************************************************************************/
+__attribute__((target("+crypto")))
+static void Sha256TransformCe(Sha256Type *Ctx, const u8 *Data)
+{
+	uint32x4_t Abcd, Efgh, Abcd0, Efgh0, AbcdPrev, Tmp, Msg[4];
+	u32 i;
+
+	Abcd0 = vld1q_u32(&Ctx->state[0]);
+	Efgh0 = vld1q_u32(&Ctx->state[4]);
+	Abcd = Abcd0;
+	Efgh = Efgh0;
+
+	for (i = 0; i < 4; i++)
+		Msg[i] = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(&Data[16 * i])));
+
+	for (i = 0; i < 16; i++) {
+		Tmp = vaddq_u32(Msg[i % 4], vld1q_u32(&k[4 * i]));
+		if (i < 12) {
+			Msg[i % 4] = vsha256su1q_u32(
+				vsha256su0q_u32(Msg[i % 4], Msg[(i + 1) % 4]),
+				Msg[(i + 2) % 4], Msg[(i + 3) % 4]);
+		}
+		AbcdPrev = Abcd;
+		Abcd = vsha256hq_u32(Abcd, Efgh, Tmp);
+		Efgh = vsha256h2q_u32(Efgh, AbcdPrev, Tmp);
+	}
+
+	vst1q_u32(&Ctx->state[0], vaddq_u32(Abcd, Abcd0));
+	vst1q_u32(&Ctx->state[4], vaddq_u32(Efgh, Efgh0));
+}
+#endif
+
+/*****************************************************************************/
+/**
+* This function executes a SHA256 transformation in portable C.
+*
+* @param  Ctx is the context data for SHA256.
+* @param  Data is the 64 byte block to transform.
+*
+* @return None.
+*
+* @note   None.
+*
+******************************************************************************/
+static void Sha256TransformC(Sha256Type *Ctx, const u8 *Data)
 {
   volatile u32 i;
   u32 a,b,c,d,e,f,g,h,j,t1,t2,m[64];
@@ -187,17 +345,33 @@ static void Sha256Init(Sha256Type *Ctx)
 ******************************************************************************/
 static void Sha256Update(Sha256Type *Ctx, const u8 *Data, u32 Len)
 {
-   volatile u32 i;
+   volatile u32 i = 0;
 
-   for (i=0; i < Len; ++i) {
+   // Complete a partially filled block first.
+   while ((Ctx->datalen != 0) && (i < Len)) {
       Ctx->data[Ctx->datalen] = Data[i];
       Ctx->datalen++;
+      i++;
       if (Ctx->datalen == 64) {
-	  Sha256Transform(Ctx,Ctx->data);
+         Sha256Transform(Ctx,Ctx->data);
          DBL_INT_ADD(Ctx->bitlen[0],Ctx->bitlen[1],512);
          Ctx->datalen = 0;
       }
    }
+
+   // Whole blocks are transformed in place without copying.
+   while ((Len - i) >= 64) {
+      Sha256Transform(Ctx,&Data[i]);
+      DBL_INT_ADD(Ctx->bitlen[0],Ctx->bitlen[1],512);
+      i += 64;
+   }
+
+   // Keep the tail for the next update or the final padding.
+   while (i < Len) {
+      Ctx->data[Ctx->datalen] = Data[i];
+      Ctx->datalen++;
+      i++;
+   }
 }
 
 /*****************************************************************************/
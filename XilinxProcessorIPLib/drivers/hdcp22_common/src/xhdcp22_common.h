@@ -17,6 +17,8 @@
 * 1.00  MH   10/30/15 First Release.
 * 1.01  MH   01/15/16 Added prefix to function names.
 * 2.00  MH   06/21/17 Changed DIGIT_T type to u32 for ARM support.
+* 2.10  agt  10/17/26 Added XHdcp22Cmn_HasCryptoExt.
+*       agt  10/17/26 Added known answer tests of the crypto functions.
 *</pre>
 *
 *****************************************************************************/
@@ -32,6 +34,9 @@ extern "C" {
 #include "bigdigits.h"
 
 /************************** Constant Definitions ****************************/
+/* ARMv8 Crypto Extension features */
+#define XHDCP22_CMN_CRYPTO_EXT_AES  0
+#define XHDCP22_CMN_CRYPTO_EXT_SHA2 1
 
 /**************************** Type Definitions ******************************/
 
@@ -44,6 +49,13 @@ void XHdcp22Cmn_Sha256Hash(const u8 *Data, u32 DataSize, u8 *HashedData);
 int  XHdcp22Cmn_HmacSha256Hash(const u8 *Data, int DataSize, const u8 *Key, int KeySize, u8  *HashedData);
 void XHdcp22Cmn_Aes128Encrypt(const u8 *Data, const u8 *Key, u8 *Output);
 void XHdcp22Cmn_Aes128Decrypt(const u8 *Data, const u8 *Key, u8 *Output);
+u8   XHdcp22Cmn_HasCryptoExt(u32 Feature);
+
+#ifdef _XHDCP22_COMMON_TEST_
+/* Functions used for self-testing */
+int  XHdcp22Cmn_TestCrypto(void);
+void XHdcp22Cmn_TestUseCryptoExt(u8 Enable);
+#endif
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,461 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xhdcp22_common_test.c
+*
+* This file contains the known answer tests of the HDCP22 common crypto.
+* Every test vector is run through the portable C code and, when the
+* processor implements the ARMv8 Crypto Extension, through the Crypto
+* Extension code as well. The results of both paths are also compared with
+* each other over a range of data lengths.
+*
+* The test vectors are from FIPS-197 appendix B and C.1 for AES-128 and from
+* FIPS-180-2 appendix B for SHA-256. The modular exponentiation vectors are a
+* 512-bit RSA key made for this test, with the results computed by an
+* independent big integer implementation.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -----------------------------------------------
+* 2.10  agt  10/17/26 First Release
+*       agt  10/17/26 Added the modular exponentiation known answer tests
+*</pre>
+*
+*****************************************************************************/
+#ifdef _XHDCP22_COMMON_TEST_
+
+/***************************** Include Files ********************************/
+#include "string.h"
+#include "xil_types.h"
+#include "xstatus.h"
+#include "xhdcp22_common.h"
+
+/************************** Constant Definitions ****************************/
+#define XHDCP22_CMN_TEST_AES_SIZE    16
+#define XHDCP22_CMN_TEST_SHA_SIZE    32
+/* Longest message of the cross check, covers padding into a third block */
+#define XHDCP22_CMN_TEST_MAX_MSG_LEN 193
+/* Digits of the RSA modulus and of its primes */
+#define XHDCP22_CMN_TEST_RSA_DIGITS  (512 / BITS_PER_DIGIT)
+#define XHDCP22_CMN_TEST_RSA_PDIGITS (XHDCP22_CMN_TEST_RSA_DIGITS / 2)
+#define XHDCP22_CMN_TEST_RSA_E       65537
+
+/**************************** Type Definitions ******************************/
+typedef struct {
+	u8 Key[XHDCP22_CMN_TEST_AES_SIZE];
+	u8 PlainText[XHDCP22_CMN_TEST_AES_SIZE];
+	u8 CipherText[XHDCP22_CMN_TEST_AES_SIZE];
+} XHdcp22Cmn_TestAesVector;
+
+typedef struct {
+	const char *Msg;
+	u8 Hash[XHDCP22_CMN_TEST_SHA_SIZE];
+} XHdcp22Cmn_TestShaVector;
+
+/************************** Variable Definitions ****************************/
+static const XHdcp22Cmn_TestAesVector XHdcp22Cmn_TestAes[] = {
+	{
+		{0x2B, 0x7E, 0x15, 0x16, 0x28, 0xAE, 0xD2, 0xA6,
+		 0xAB, 0xF7, 0x15, 0x88, 0x09, 0xCF, 0x4F, 0x3C},
+		{0x32, 0x43, 0xF6, 0xA8, 0x88, 0x5A, 0x30, 0x8D,
+		 0x31, 0x31, 0x98, 0xA2, 0xE0, 0x37, 0x07, 0x34},
+		{0x39, 0x25, 0x84, 0x1D, 0x02, 0xDC, 0x09, 0xFB,
+		 0xDC, 0x11, 0x85, 0x97, 0x19, 0x6A, 0x0B, 0x32}
+	},
+	{
+		{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+		 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F},
+		{0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+		 0x88, 0x99, 0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF},
+		{0x69, 0xC4, 0xE0, 0xD8, 0x6A, 0x7B, 0x04, 0x30,
+		 0xD8, 0xCD, 0xB7, 0x80, 0x70, 0xB4, 0xC5, 0x5A}
+	}
+};
+
+static const XHdcp22Cmn_TestShaVector XHdcp22Cmn_TestSha[] = {
+	{
+		"",
+		{0xE3, 0xB0, 0xC4, 0x42, 0x98, 0xFC, 0x1C, 0x14,
+		 0x9A, 0xFB, 0xF4, 0xC8, 0x99, 0x6F, 0xB9, 0x24,
+		 0x27, 0xAE, 0x41, 0xE4, 0x64, 0x9B, 0x93, 0x4C,
+		 0xA4, 0x95, 0x99, 0x1B, 0x78, 0x52, 0xB8, 0x55}
+	},
+	{
+		"abc",
+		{0xBA, 0x78, 0x16, 0xBF, 0x8F, 0x01, 0xCF, 0xEA,
+		 0x41, 0x41, 0x40, 0xDE, 0x5D, 0xAE, 0x22, 0x23,
+		 0xB0, 0x03, 0x61, 0xA3, 0x96, 0x17, 0x7A, 0x9C,
+		 0xB4, 0x10, 0xFF, 0x61, 0xF2, 0x00, 0x15, 0xAD}
+	},
+	{
+		"abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+		{0x24, 0x8D, 0x6A, 0x61, 0xD2, 0x06, 0x38, 0xB8,
+		 0xE5, 0xC0, 0x26, 0x93, 0x0C, 0x3E, 0x60, 0x39,
+		 0xA3, 0x3C, 0xE4, 0x59, 0x64, 0xFF, 0x21, 0x67,
+		 0xF6, 0xEC, 0xED, 0xD4, 0x19, 0xDB, 0x06, 0xC1}
+	},
+	{
+		"abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmn"
+		"hijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu",
+		{0xCF, 0x5B, 0x16, 0xA7, 0x78, 0xAF, 0x83, 0x80,
+		 0x03, 0x6C, 0xE5, 0x9E, 0x7B, 0x04, 0x92, 0x37,
+		 0x0B, 0x24, 0x9B, 0x11, 0xE8, 0xF0, 0x7A, 0x51,
+		 0xAF, 0xAC, 0x45, 0x03, 0x7A, 0xFE, 0xE9, 0xD1}
+	}
+};
+
+static const u8 XHdcp22Cmn_TestRsaN[] = {
+	0xBB, 0x57, 0x10, 0x49, 0x57, 0x72, 0xC1, 0xD8,
+	0xA9, 0xF8, 0xD2, 0x74, 0xFA, 0x89, 0xFE, 0xE6,
+	0x61, 0x93, 0xF9, 0xB4, 0x70, 0xD5, 0xB3, 0x1D,
+	0x91, 0xEF, 0x0E, 0x9A, 0x58, 0xF4, 0x6A, 0x4B,
+	0xB7, 0x50, 0x04, 0x0B, 0xBE, 0x37, 0xC4, 0xEA,
+	0x8C, 0x20, 0x20, 0x54, 0xD1, 0xCD, 0x96, 0x1F,
+	0x0B, 0x01, 0x9C, 0x12, 0x36, 0xA5, 0x1F, 0x7A,
+	0xA0, 0x07, 0xAA, 0xB2, 0x10, 0x38, 0x2E, 0xD5
+};
+
+static const u8 XHdcp22Cmn_TestRsaD[] = {
+	0x69, 0xE5, 0xBF, 0x29, 0x16, 0x2B, 0xA2, 0x74,
+	0x0D, 0x30, 0xC0, 0x16, 0xAC, 0x01, 0x11, 0x7B,
+	0xBD, 0x30, 0xDE, 0x78, 0x27, 0x48, 0x45, 0x65,
+	0xB3, 0xB6, 0x84, 0x74, 0xAF, 0x50, 0x0A, 0x3D,
+	0x26, 0x70, 0xDB, 0x9A, 0xF6, 0x54, 0x10, 0x60,
+	0x7F, 0x67, 0x4E, 0xAB, 0x17, 0x98, 0x3C, 0x3D,
+	0x1F, 0x5D, 0x4A, 0x48, 0x00, 0x57, 0xFE, 0x54,
+	0xD2, 0x64, 0x6F, 0x32, 0x23, 0xAA, 0x60, 0x49
+};
+
+static const u8 XHdcp22Cmn_TestRsaP[] = {
+	0xEB, 0xCB, 0xA8, 0x04, 0x32, 0x36, 0xC8, 0xEC,
+	0x94, 0xB8, 0x8E, 0x19, 0x99, 0x58, 0xCE, 0x83,
+	0x53, 0x22, 0x30, 0x0E, 0xDB, 0x03, 0xCD, 0x77,
+	0x38, 0x47, 0x62, 0xA8, 0xF1, 0xFA, 0x26, 0xFF
+};
+
+static const u8 XHdcp22Cmn_TestRsaQ[] = {
+	0xCB, 0x64, 0x80, 0xA7, 0xCC, 0x3F, 0xBD, 0x33,
+	0x70, 0xA7, 0x8F, 0x73, 0x5B, 0xB4, 0x17, 0xE2,
+	0x11, 0x71, 0x09, 0xEE, 0xCD, 0x63, 0x54, 0x7E,
+	0xD1, 0x98, 0x46, 0x00, 0x01, 0x1E, 0x5E, 0x2B
+};
+
+static const u8 XHdcp22Cmn_TestRsaDp[] = {
+	0x68, 0xF3, 0x62, 0xBB, 0x4B, 0x66, 0x5B, 0x14,
+	0x02, 0x36, 0x0A, 0xF9, 0x95, 0xE9, 0x93, 0x31,
+	0x9C, 0xA5, 0x10, 0xE2, 0xEB, 0xD4, 0xCB, 0x75,
+	0x0F, 0x15, 0xA6, 0xF2, 0x2F, 0x91, 0xFA, 0x1D
+};
+
+static const u8 XHdcp22Cmn_TestRsaDq[] = {
+	0x61, 0x63, 0xE5, 0x6A, 0xF3, 0x95, 0x4D, 0xAE,
+	0x54, 0xF2, 0x16, 0xF1, 0x60, 0xE6, 0xD2, 0x4C,
+	0xD0, 0x97, 0x34, 0xEF, 0x60, 0xEF, 0x80, 0x25,
+	0x1D, 0x8D, 0x71, 0x6F, 0x4D, 0x19, 0xD2, 0x73
+};
+
+static const u8 XHdcp22Cmn_TestRsaQinv[] = {
+	0x72, 0xCC, 0x30, 0x96, 0x94, 0x3F, 0x98, 0xD1,
+	0x3B, 0x6A, 0x53, 0x55, 0x80, 0x14, 0xD0, 0x43,
+	0xED, 0xD7, 0x52, 0xA9, 0x7B, 0x6B, 0x68, 0x12,
+	0xF5, 0x89, 0x95, 0xE6, 0x59, 0x97, 0xC6, 0xE2
+};
+
+static const u8 XHdcp22Cmn_TestRsaMsg[] = {
+	0x1E, 0xAA, 0x1A, 0xD6, 0x90, 0xA7, 0x8C, 0x64,
+	0x47, 0xFC, 0x8D, 0x05, 0x35, 0xCE, 0x24, 0x50,
+	0x7E, 0x12, 0x84, 0x75, 0x84, 0xDB, 0x1D, 0x6B,
+	0xBC, 0x62, 0x53, 0xA4, 0xD2, 0xBA, 0x86, 0x36,
+	0x89, 0xFB, 0x2B, 0x15, 0x98, 0xCF, 0xE8, 0x23,
+	0x68, 0x95, 0x3C, 0x39, 0xAE, 0x07, 0xCA, 0xE7,
+	0x7D, 0xED, 0x27, 0xF8, 0x70, 0xC5, 0x5A, 0x6A,
+	0xCB, 0x60, 0xDB, 0x17, 0x4E, 0xBD, 0x3C, 0xEC
+};
+
+static const u8 XHdcp22Cmn_TestRsaCipher[] = {
+	0x88, 0x07, 0x6D, 0xBD, 0xC6, 0x55, 0x95, 0xAE,
+	0x10, 0xE0, 0xAF, 0xBB, 0xBB, 0x0B, 0xBB, 0x41,
+	0x1A, 0x89, 0xA1, 0x53, 0x3A, 0xF1, 0xA9, 0xB3,
+	0xC8, 0xAA, 0x09, 0xCD, 0x81, 0x2C, 0x91, 0x83,
+	0x34, 0x54, 0x08, 0xDB, 0x6B, 0xAF, 0x5E, 0x8B,
+	0x3B, 0xA8, 0x9F, 0x51, 0x9E, 0xC5, 0x84, 0xFD,
+	0x0C, 0xF9, 0x58, 0x65, 0x21, 0x38, 0xBC, 0xE9,
+	0xE5, 0x1D, 0x3B, 0x62, 0x6A, 0xFC, 0xB2, 0x3F
+};
+
+/************************** Function Prototypes *****************************/
+static int XHdcp22Cmn_TestAesKat(void);
+static int XHdcp22Cmn_TestShaKat(void);
+static int XHdcp22Cmn_TestModExpKat(void);
+static int XHdcp22Cmn_TestAesCrossCheck(void);
+static int XHdcp22Cmn_TestShaCrossCheck(void);
+
+/************************** Function Implementation *****************************/
+
+/*****************************************************************************/
+/**
+*
+* This function runs the known answer tests of AES-128 and SHA-256 on the
+* portable C code and, when available, on the ARMv8 Crypto Extension code.
+* The Crypto Extension results are also compared with the C results.
+* The known answer tests of the modular exponentiation are run as well.
+*
+* @return XST_SUCCESS if all the tests pass, XST_FAILURE otherwise.
+*
+* @note   The Crypto Extension is enabled again when the function returns.
+*
+******************************************************************************/
+int XHdcp22Cmn_TestCrypto(void)
+{
+	int Status = XST_SUCCESS;
+
+	/* Portable C code */
+	XHdcp22Cmn_TestUseCryptoExt(FALSE);
+	if (XHdcp22Cmn_TestAesKat() != XST_SUCCESS)
+		Status = XST_FAILURE;
+	if (XHdcp22Cmn_TestShaKat() != XST_SUCCESS)
+		Status = XST_FAILURE;
+	XHdcp22Cmn_TestUseCryptoExt(TRUE);
+
+	/* Modular exponentiation */
+	if (XHdcp22Cmn_TestModExpKat() != XST_SUCCESS)
+		Status = XST_FAILURE;
+
+	/* Crypto Extension code */
+	if (XHdcp22Cmn_HasCryptoExt(XHDCP22_CMN_CRYPTO_EXT_AES)) {
+		if (XHdcp22Cmn_TestAesKat() != XST_SUCCESS)
+			Status = XST_FAILURE;
+		if (XHdcp22Cmn_TestAesCrossCheck() != XST_SUCCESS)
+			Status = XST_FAILURE;
+	}
+	if (XHdcp22Cmn_HasCryptoExt(XHDCP22_CMN_CRYPTO_EXT_SHA2)) {
+		if (XHdcp22Cmn_TestShaKat() != XST_SUCCESS)
+			Status = XST_FAILURE;
+		if (XHdcp22Cmn_TestShaCrossCheck() != XST_SUCCESS)
+			Status = XST_FAILURE;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function encrypts and decrypts the AES-128 test vectors.
+*
+* @return XST_SUCCESS if all the results match, XST_FAILURE otherwise.
+*
+* @note   None.
+*
+******************************************************************************/
+static int XHdcp22Cmn_TestAesKat(void)
+{
+	u8 Output[XHDCP22_CMN_TEST_AES_SIZE];
+	u32 i;
+
+	for (i = 0; i < sizeof(XHdcp22Cmn_TestAes) / sizeof(XHdcp22Cmn_TestAes[0]); i++) {
+		XHdcp22Cmn_Aes128Encrypt(XHdcp22Cmn_TestAes[i].PlainText,
+			XHdcp22Cmn_TestAes[i].Key, Output);
+		if (memcmp(Output, XHdcp22Cmn_TestAes[i].CipherText, sizeof(Output)) != 0)
+			return XST_FAILURE;
+
+		XHdcp22Cmn_Aes128Decrypt(XHdcp22Cmn_TestAes[i].CipherText,
+			XHdcp22Cmn_TestAes[i].Key, Output);
+		if (memcmp(Output, XHdcp22Cmn_TestAes[i].PlainText, sizeof(Output)) != 0)
+			return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function hashes the SHA-256 test vectors.
+*
+* @return XST_SUCCESS if all the results match, XST_FAILURE otherwise.
+*
+* @note   None.
+*
+******************************************************************************/
+static int XHdcp22Cmn_TestShaKat(void)
+{
+	u8 Hash[XHDCP22_CMN_TEST_SHA_SIZE];
+	u32 i;
+
+	for (i = 0; i < sizeof(XHdcp22Cmn_TestSha) / sizeof(XHdcp22Cmn_TestSha[0]); i++) {
+		XHdcp22Cmn_Sha256Hash((const u8 *)XHdcp22Cmn_TestSha[i].Msg,
+			strlen(XHdcp22Cmn_TestSha[i].Msg), Hash);
+		if (memcmp(Hash, XHdcp22Cmn_TestSha[i].Hash, sizeof(Hash)) != 0)
+			return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function runs the modular exponentiation test vectors through the
+* fixed-window exponentiation of mpModExp_ct(), the sliding-window
+* exponentiation of mpModExp() and the CRT exponentiation of mpModExpCrt().
+* A modulus of 1 must give 0.
+*
+* @return XST_SUCCESS if all the results match, XST_FAILURE otherwise.
+*
+* @note   None.
+*
+******************************************************************************/
+static int XHdcp22Cmn_TestModExpKat(void)
+{
+	u32 N[XHDCP22_CMN_TEST_RSA_DIGITS];
+	u32 D[XHDCP22_CMN_TEST_RSA_DIGITS];
+	u32 E[XHDCP22_CMN_TEST_RSA_DIGITS];
+	u32 Msg[XHDCP22_CMN_TEST_RSA_DIGITS];
+	u32 Cipher[XHDCP22_CMN_TEST_RSA_DIGITS];
+	u32 Result[XHDCP22_CMN_TEST_RSA_DIGITS];
+	u32 P[XHDCP22_CMN_TEST_RSA_PDIGITS];
+	u32 Q[XHDCP22_CMN_TEST_RSA_PDIGITS];
+	u32 Dp[XHDCP22_CMN_TEST_RSA_PDIGITS];
+	u32 Dq[XHDCP22_CMN_TEST_RSA_PDIGITS];
+	u32 Qinv[XHDCP22_CMN_TEST_RSA_PDIGITS];
+
+	mpConvFromOctets(N, XHDCP22_CMN_TEST_RSA_DIGITS,
+		XHdcp22Cmn_TestRsaN, sizeof(XHdcp22Cmn_TestRsaN));
+	mpConvFromOctets(D, XHDCP22_CMN_TEST_RSA_DIGITS,
+		XHdcp22Cmn_TestRsaD, sizeof(XHdcp22Cmn_TestRsaD));
+	mpConvFromOctets(Msg, XHDCP22_CMN_TEST_RSA_DIGITS,
+		XHdcp22Cmn_TestRsaMsg, sizeof(XHdcp22Cmn_TestRsaMsg));
+	mpConvFromOctets(Cipher, XHDCP22_CMN_TEST_RSA_DIGITS,
+		XHdcp22Cmn_TestRsaCipher, sizeof(XHdcp22Cmn_TestRsaCipher));
+	mpConvFromOctets(P, XHDCP22_CMN_TEST_RSA_PDIGITS,
+		XHdcp22Cmn_TestRsaP, sizeof(XHdcp22Cmn_TestRsaP));
+	mpConvFromOctets(Q, XHDCP22_CMN_TEST_RSA_PDIGITS,
+		XHdcp22Cmn_TestRsaQ, sizeof(XHdcp22Cmn_TestRsaQ));
+	mpConvFromOctets(Dp, XHDCP22_CMN_TEST_RSA_PDIGITS,
+		XHdcp22Cmn_TestRsaDp, sizeof(XHdcp22Cmn_TestRsaDp));
+	mpConvFromOctets(Dq, XHDCP22_CMN_TEST_RSA_PDIGITS,
+		XHdcp22Cmn_TestRsaDq, sizeof(XHdcp22Cmn_TestRsaDq));
+	mpConvFromOctets(Qinv, XHDCP22_CMN_TEST_RSA_PDIGITS,
+		XHdcp22Cmn_TestRsaQinv, sizeof(XHdcp22Cmn_TestRsaQinv));
+	mpSetDigit(E, XHDCP22_CMN_TEST_RSA_E, XHDCP22_CMN_TEST_RSA_DIGITS);
+
+	/* Private key operation, fixed window */
+	mpModExp_ct(Result, Cipher, D, N, XHDCP22_CMN_TEST_RSA_DIGITS);
+	if (!mpEqual(Result, Msg, XHDCP22_CMN_TEST_RSA_DIGITS))
+		return XST_FAILURE;
+
+	/* Public key operation, sliding window */
+	mpModExp(Result, Msg, E, N, XHDCP22_CMN_TEST_RSA_DIGITS);
+	if (!mpEqual(Result, Cipher, XHDCP22_CMN_TEST_RSA_DIGITS))
+		return XST_FAILURE;
+
+	/* Private key operation, CRT */
+	mpModExpCrt(Result, Cipher, P, Q, Dp, Dq, Qinv,
+		XHDCP22_CMN_TEST_RSA_PDIGITS);
+	if (!mpEqual(Result, Msg, XHDCP22_CMN_TEST_RSA_DIGITS))
+		return XST_FAILURE;
+
+	/* Anything mod 1 is 0 */
+	mpSetDigit(N, 1, XHDCP22_CMN_TEST_RSA_DIGITS);
+	mpModExp_ct(Result, Cipher, D, N, XHDCP22_CMN_TEST_RSA_DIGITS);
+	if (!mpIsZero(Result, XHDCP22_CMN_TEST_RSA_DIGITS))
+		return XST_FAILURE;
+	mpModExp(Result, Msg, E, N, XHDCP22_CMN_TEST_RSA_DIGITS);
+	if (!mpIsZero(Result, XHDCP22_CMN_TEST_RSA_DIGITS))
+		return XST_FAILURE;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function compares AES-128 results of the Crypto Extension code with
+* the C code for a set of keys and blocks derived from each other.
+*
+* @return XST_SUCCESS if all the results match, XST_FAILURE otherwise.
+*
+* @note   None.
+*
+******************************************************************************/
+static int XHdcp22Cmn_TestAesCrossCheck(void)
+{
+	u8 Key[XHDCP22_CMN_TEST_AES_SIZE];
+	u8 Block[XHDCP22_CMN_TEST_AES_SIZE];
+	u8 OutputCe[XHDCP22_CMN_TEST_AES_SIZE];
+	u8 OutputC[XHDCP22_CMN_TEST_AES_SIZE];
+	int Status = XST_SUCCESS;
+	u32 i;
+
+	memcpy(Key, XHdcp22Cmn_TestAes[0].Key, sizeof(Key));
+	memcpy(Block, XHdcp22Cmn_TestAes[0].PlainText, sizeof(Block));
+
+	for (i = 0; i < 64; i++) {
+		XHdcp22Cmn_Aes128Encrypt(Block, Key, OutputCe);
+		XHdcp22Cmn_TestUseCryptoExt(FALSE);
+		XHdcp22Cmn_Aes128Encrypt(Block, Key, OutputC);
+		XHdcp22Cmn_TestUseCryptoExt(TRUE);
+		if (memcmp(OutputCe, OutputC, sizeof(OutputC)) != 0) {
+			Status = XST_FAILURE;
+			break;
+		}
+
+		XHdcp22Cmn_Aes128Decrypt(Block, Key, OutputCe);
+		XHdcp22Cmn_TestUseCryptoExt(FALSE);
+		XHdcp22Cmn_Aes128Decrypt(Block, Key, OutputC);
+		XHdcp22Cmn_TestUseCryptoExt(TRUE);
+		if (memcmp(OutputCe, OutputC, sizeof(OutputC)) != 0) {
+			Status = XST_FAILURE;
+			break;
+		}
+
+		/* Next key is the ciphertext, next block the plaintext */
+		memcpy(Key, OutputC, sizeof(Key));
+		memcpy(Block, OutputCe, sizeof(Block));
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function compares SHA-256 results of the Crypto Extension code with
+* the C code for every message length up to XHDCP22_CMN_TEST_MAX_MSG_LEN.
+*
+* @return XST_SUCCESS if all the results match, XST_FAILURE otherwise.
+*
+* @note   None.
+*
+******************************************************************************/
+static int XHdcp22Cmn_TestShaCrossCheck(void)
+{
+	u8 Msg[XHDCP22_CMN_TEST_MAX_MSG_LEN];
+	u8 HashCe[XHDCP22_CMN_TEST_SHA_SIZE];
+	u8 HashC[XHDCP22_CMN_TEST_SHA_SIZE];
+	u32 Len;
+
+	for (Len = 0; Len < sizeof(Msg); Len++)
+		Msg[Len] = (u8)(Len * 7 + 3);
+
+	for (Len = 0; Len <= sizeof(Msg); Len++) {
+		XHdcp22Cmn_Sha256Hash(Msg, Len, HashCe);
+		XHdcp22Cmn_TestUseCryptoExt(FALSE);
+		XHdcp22Cmn_Sha256Hash(Msg, Len, HashC);
+		XHdcp22Cmn_TestUseCryptoExt(TRUE);
+		if (memcmp(HashCe, HashC, sizeof(HashC)) != 0)
+			return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+#endif /* _XHDCP22_COMMON_TEST_ */
@@ -0,0 +1,264 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/****************************************************************************/
+/**
+*
+* @file xipipsu_stream.c
+* @addtogroup Overview
+* @{
+*
+* The xipipsu_stream.c file contains the FreeRTOS message buffer interface of
+* the XIpiPsu driver.
+* Refer to the header file xipipsu_stream.h for more detailed information.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver	Who	Date	Changes
+* ----- ------ -------- ----------------------------------------------
+* 2.11	agt	10/17/26	First release
+* </pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files ********************************/
+#include "xipipsu_stream.h"
+
+#ifdef FREERTOS_BSP
+
+#include "task.h"
+
+/************************** Variable Definitions *****************************/
+
+/****************************************************************************/
+/**
+ * @brief	Create the message buffer of a stream instance and enable the
+ *		IPIs of the given sources
+ *
+ * @param	StreamPtr is the pointer to the stream instance
+ * @param	IpiPtr is the pointer to an initialized IPI instance
+ * @param	SrcMask is the mask of the CPUs whose IPIs are received
+ * @param	MsgCount is the number of messages the message buffer holds
+ *
+ * @return	XST_SUCCESS if the instance was initialized
+ *		XST_FAILURE if the message buffer or the semaphore could not
+ *		be allocated
+ *
+ * @note	The IPI interrupt must be connected to
+ *		XIpiPsu_StreamIntrHandler() and enabled in the interrupt
+ *		controller by the caller.
+ */
+XStatus XIpiPsu_StreamInitialize(XIpiPsu_Stream *StreamPtr, XIpiPsu *IpiPtr,
+		u32 SrcMask, u32 MsgCount)
+{
+	Xil_AssertNonvoid(StreamPtr != NULL);
+	Xil_AssertNonvoid(IpiPtr != NULL);
+	Xil_AssertNonvoid(IpiPtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(MsgCount != 0U);
+
+	StreamPtr->IpiPtr = IpiPtr;
+	StreamPtr->SrcMask = SrcMask & XIPIPSU_ALL_MASK;
+	StreamPtr->RxDropped = 0U;
+	StreamPtr->TxWaitMask = 0U;
+
+	StreamPtr->RxBuffer = xMessageBufferCreate((size_t)MsgCount *
+			XIPIPSU_STREAM_MSG_SIZE);
+	if (StreamPtr->RxBuffer == NULL) {
+		return (XStatus)XST_FAILURE;
+	}
+
+	StreamPtr->TxAckSem = xSemaphoreCreateBinary();
+	if (StreamPtr->TxAckSem == NULL) {
+		vMessageBufferDelete(StreamPtr->RxBuffer);
+		StreamPtr->RxBuffer = NULL;
+		return (XStatus)XST_FAILURE;
+	}
+
+	XIpiPsu_ClearInterruptStatus(IpiPtr, StreamPtr->SrcMask);
+	XIpiPsu_InterruptEnable(IpiPtr, StreamPtr->SrcMask);
+
+	return (XStatus)XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+ * @brief	Disable the IPIs of a stream instance and delete its message
+ *		buffer and semaphore
+ *
+ * @param	StreamPtr is the pointer to the stream instance
+ *
+ * @note	No task may be blocked on the instance.
+ */
+void XIpiPsu_StreamDelete(XIpiPsu_Stream *StreamPtr)
+{
+	Xil_AssertVoid(StreamPtr != NULL);
+
+	XIpiPsu_InterruptDisable(StreamPtr->IpiPtr, StreamPtr->SrcMask);
+
+	if (StreamPtr->RxBuffer != NULL) {
+		vMessageBufferDelete(StreamPtr->RxBuffer);
+		StreamPtr->RxBuffer = NULL;
+	}
+
+	if (StreamPtr->TxAckSem != NULL) {
+		vSemaphoreDelete(StreamPtr->TxAckSem);
+		StreamPtr->TxAckSem = NULL;
+	}
+}
+
+/****************************************************************************/
+/**
+ * @brief	Post a message to a CPU
+ *
+ * Waits until the previous IPI to the destination has been acknowledged,
+ * then writes the message and triggers the IPI. The acknowledge of this
+ * message is not waited for. The wait polls the observation register for
+ * XIPIPSU_STREAM_ACK_POLL reads, then blocks on the semaphore given by
+ * XIpiPsu_StreamIntrHandler(), rechecking at least once a tick.
+ *
+ * @param	StreamPtr is the pointer to the stream instance
+ * @param	DestCpuMask is the mask of the destination CPU
+ * @param	MsgPtr is the pointer to the message
+ * @param	MsgLength is the length of the message in words
+ * @param	TicksToWait is the maximum time to wait for the destination
+ *
+ * @return	XST_SUCCESS if the message was posted
+ *		XST_DEVICE_BUSY if the destination did not acknowledge its
+ *		previous message in time
+ *		XST_FAILURE if the message could not be written
+ */
+XStatus XIpiPsu_StreamSend(XIpiPsu_Stream *StreamPtr, u32 DestCpuMask,
+		u32 *MsgPtr, u32 MsgLength, TickType_t TicksToWait)
+{
+	TimeOut_t TimeOut;
+	XStatus Status;
+
+	Xil_AssertNonvoid(StreamPtr != NULL);
+	Xil_AssertNonvoid(MsgPtr != NULL);
+
+	if (XIpiPsu_PollForAck(StreamPtr->IpiPtr, DestCpuMask,
+			XIPIPSU_STREAM_ACK_POLL) != (XStatus)XST_SUCCESS) {
+		vTaskSetTimeOutState(&TimeOut);
+		taskENTER_CRITICAL();
+		StreamPtr->TxWaitMask |= DestCpuMask;
+		taskEXIT_CRITICAL();
+
+		while ((XIpiPsu_GetObsStatus(StreamPtr->IpiPtr) &
+				DestCpuMask) != 0U) {
+			if (xTaskCheckForTimeOut(&TimeOut, &TicksToWait) !=
+					pdFALSE) {
+				break;
+			}
+			(void)xSemaphoreTake(StreamPtr->TxAckSem, 1U);
+		}
+
+		taskENTER_CRITICAL();
+		StreamPtr->TxWaitMask &= ~DestCpuMask;
+		taskEXIT_CRITICAL();
+
+		if ((XIpiPsu_GetObsStatus(StreamPtr->IpiPtr) &
+				DestCpuMask) != 0U) {
+			return (XStatus)XST_DEVICE_BUSY;
+		}
+	}
+
+	Status = XIpiPsu_WriteMessage(StreamPtr->IpiPtr, DestCpuMask, MsgPtr,
+			MsgLength, XIPIPSU_BUF_TYPE_MSG);
+	if (Status != (XStatus)XST_SUCCESS) {
+		return Status;
+	}
+
+	return XIpiPsu_TriggerIpi(StreamPtr->IpiPtr, DestCpuMask);
+}
+
+/****************************************************************************/
+/**
+ * @brief	Receive the next message
+ *
+ * @param	StreamPtr is the pointer to the stream instance
+ * @param	SrcCpuMaskPtr is where the mask of the source CPU is stored
+ * @param	MsgPtr is the pointer to a buffer of XIPIPSU_MAX_MSG_LEN words
+ * @param	TicksToWait is the maximum time to block for a message
+ *
+ * @return	The length of the message in words, 0 if none was received
+ */
+u32 XIpiPsu_StreamRecv(XIpiPsu_Stream *StreamPtr, u32 *SrcCpuMaskPtr,
+		u32 *MsgPtr, TickType_t TicksToWait)
+{
+	u32 Record[1U + XIPIPSU_MAX_MSG_LEN];
+	size_t Length;
+	u32 Index;
+
+	Xil_AssertNonvoid(StreamPtr != NULL);
+	Xil_AssertNonvoid(SrcCpuMaskPtr != NULL);
+	Xil_AssertNonvoid(MsgPtr != NULL);
+
+	Length = xMessageBufferReceive(StreamPtr->RxBuffer, Record,
+			sizeof(Record), TicksToWait);
+	if (Length == 0U) {
+		return 0U;
+	}
+
+	*SrcCpuMaskPtr = Record[0];
+	for (Index = 0U; Index < XIPIPSU_MAX_MSG_LEN; Index++) {
+		MsgPtr[Index] = Record[1U + Index];
+	}
+
+	return XIPIPSU_MAX_MSG_LEN;
+}
+
+/****************************************************************************/
+/**
+ * @brief	Interrupt handler of the stream interface
+ *
+ * Copies the message of each pending source to the message buffer, then
+ * acknowledges all of them at once. Gives the semaphore of a blocked sender
+ * if one of the targets it waits for has acknowledged.
+ *
+ * @param	CallBackRef is the pointer to the stream instance
+ */
+void XIpiPsu_StreamIntrHandler(void *CallBackRef)
+{
+	XIpiPsu_Stream *StreamPtr = (XIpiPsu_Stream *)CallBackRef;
+	XIpiPsu *IpiPtr;
+	u32 Record[1U + XIPIPSU_MAX_MSG_LEN];
+	BaseType_t Woken = pdFALSE;
+	u32 IpiSrcMask;
+	u32 Index;
+
+	Xil_AssertVoid(StreamPtr != NULL);
+
+	IpiPtr = StreamPtr->IpiPtr;
+	IpiSrcMask = XIpiPsu_GetInterruptStatus(IpiPtr) & StreamPtr->SrcMask;
+
+	for (Index = 0U; Index < IpiPtr->Config.TargetCount; Index++) {
+		Record[0] = IpiPtr->Config.TargetList[Index].Mask;
+		if ((IpiSrcMask & Record[0]) == 0U) {
+			continue;
+		}
+		if ((XIpiPsu_ReadMessage(IpiPtr, Record[0], &Record[1],
+				XIPIPSU_MAX_MSG_LEN, XIPIPSU_BUF_TYPE_MSG) !=
+				(XStatus)XST_SUCCESS) ||
+				(xMessageBufferSendFromISR(StreamPtr->RxBuffer,
+				Record, sizeof(Record), &Woken) == 0U)) {
+			StreamPtr->RxDropped++;
+		}
+	}
+
+	XIpiPsu_ClearInterruptStatus(IpiPtr, IpiSrcMask);
+
+	/* Wake a sender whose target has acknowledged meanwhile */
+	if ((StreamPtr->TxWaitMask != 0U) &&
+			((XIpiPsu_GetObsStatus(IpiPtr) & StreamPtr->TxWaitMask) !=
+			StreamPtr->TxWaitMask)) {
+		(void)xSemaphoreGiveFromISR(StreamPtr->TxAckSem, &Woken);
+	}
+
+	portYIELD_FROM_ISR(Woken);
+}
+
+#endif /* FREERTOS_BSP */
+/** @} */
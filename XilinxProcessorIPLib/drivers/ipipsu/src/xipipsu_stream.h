@@ -0,0 +1,110 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+ * @file xipipsu_stream.h
+ * @addtogroup Overview
+ * @{
+ *
+ * The xipipsu_stream.h file contains the FreeRTOS message buffer interface of
+ * the IPIPSU driver. It is only built when the driver is part of a FreeRTOS
+ * BSP.
+ *
+ * XIpiPsu_StreamIntrHandler() reads the message of every pending source,
+ * appends it to a FreeRTOS message buffer and acknowledges all of them with a
+ * single status write, so a burst of IPIs costs one interrupt and at most one
+ * task wake up. XIpiPsu_StreamSend() posts a message without waiting for the
+ * acknowledge; it only blocks when the previous message to the same target
+ * has not been acknowledged yet.
+ *
+ * The IPI block raises no interrupt when a target acknowledges. A sender
+ * first polls the observation register for XIPIPSU_STREAM_ACK_POLL reads,
+ * which covers a target that acknowledges from its interrupt handler, then
+ * blocks on a semaphore. XIpiPsu_StreamIntrHandler() gives the semaphore when
+ * an incoming IPI finds the awaited target acknowledged, as when the target
+ * answers. The semaphore is also taken with a one tick timeout so a target
+ * that never sends back is still noticed.
+ *
+ * Only one task may call XIpiPsu_StreamRecv() for an instance, and it must
+ * run on the core that services the IPI interrupt.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver  Who Date     Changes
+ * ---- --- -------- --------------------------------------------------
+ * 2.11 agt 10/17/26 First release
+ * </pre>
+ *
+ *****************************************************************************/
+#ifndef XIPIPSU_STREAM_H_
+#define XIPIPSU_STREAM_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "bspconfig.h"
+
+#ifdef FREERTOS_BSP
+
+#include "FreeRTOS.h"
+#include "message_buffer.h"
+#include "semphr.h"
+#include "xipipsu.h"
+
+/************************** Constant Definitions *****************************/
+
+/**
+ * Message buffer space taken by one received message: its length word, the
+ * source mask and the message itself
+ */
+#define XIPIPSU_STREAM_MSG_SIZE	(sizeof(size_t) + \
+				 ((1U + XIPIPSU_MAX_MSG_LEN) * sizeof(u32)))
+
+/**
+ * Observation register reads made by XIpiPsu_StreamSend() before blocking
+ */
+#define XIPIPSU_STREAM_ACK_POLL	1000U
+
+/**************************** Type Definitions *******************************/
+
+/**
+ * The message buffer interface instance data
+ */
+typedef struct {
+	XIpiPsu *IpiPtr; /**< Initialized IPI driver instance */
+	MessageBufferHandle_t RxBuffer; /**< Received messages */
+	u32 SrcMask; /**< Sources whose IPIs are received */
+	u32 RxDropped; /**< Messages lost as RxBuffer was full */
+	SemaphoreHandle_t TxAckSem; /**< Given when TxWaitMask is acknowledged */
+	volatile u32 TxWaitMask; /**< Targets a sender is blocked on */
+} XIpiPsu_Stream;
+
+/************************** Function Prototypes ******************************/
+
+XStatus XIpiPsu_StreamInitialize(XIpiPsu_Stream *StreamPtr, XIpiPsu *IpiPtr,
+		u32 SrcMask, u32 MsgCount);
+
+void XIpiPsu_StreamDelete(XIpiPsu_Stream *StreamPtr);
+
+XStatus XIpiPsu_StreamSend(XIpiPsu_Stream *StreamPtr, u32 DestCpuMask,
+		u32 *MsgPtr, u32 MsgLength, TickType_t TicksToWait);
+
+u32 XIpiPsu_StreamRecv(XIpiPsu_Stream *StreamPtr, u32 *SrcCpuMaskPtr,
+		u32 *MsgPtr, TickType_t TicksToWait);
+
+void XIpiPsu_StreamIntrHandler(void *CallBackRef);
+
+#endif /* FREERTOS_BSP */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XIPIPSU_STREAM_H_ */
+/** @} */
@@ -0,0 +1,345 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/****************************************************************************/
+/**
+*
+* @file xuartps_stream.c
+* @addtogroup uartps_v3_11
+* @{
+*
+* This file contains the FreeRTOS stream buffer interface of the UART driver.
+* Refer to the header file xuartps_stream.h for more detailed information.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ------ -------- ----------------------------------------------
+* 3.11  agt    10/17/26 First release
+* </pre>
+*
+*****************************************************************************/
+
+/***************************** Include Files ********************************/
+
+#include "xuartps_stream.h"
+
+#ifdef FREERTOS_BSP
+
+/************************** Constant Definitions ****************************/
+
+/* Interrupts serviced by XUartPs_StreamIntrHandler() */
+#define XUARTPS_STREAM_RX_IXR	(XUARTPS_IXR_RXOVR | XUARTPS_IXR_RXFULL | \
+				 XUARTPS_IXR_TOUT)
+#define XUARTPS_STREAM_ERR_IXR	(XUARTPS_IXR_OVER | XUARTPS_IXR_FRAMING | \
+				 XUARTPS_IXR_PARITY)
+
+/**************************** Type Definitions ******************************/
+
+/***************** Macros (Inline Functions) Definitions ********************/
+
+/************************** Function Prototypes *****************************/
+
+static void XUartPs_StreamRxFifo(XUartPs_Stream *StreamPtr,
+				 BaseType_t *WokenPtr);
+static void XUartPs_StreamTxFifo(XUartPs_Stream *StreamPtr,
+				 BaseType_t *WokenPtr);
+
+/************************** Variable Definitions ****************************/
+
+/****************************************************************************/
+/**
+*
+* Creates the stream buffers of a stream interface instance and sets up the
+* UART so received data raises an interrupt at the RX FIFO trigger level or
+* after the line has been idle for the receive timeout.
+*
+* @param	StreamPtr is a pointer to the XUartPs_Stream instance.
+* @param	UartPtr is a pointer to an initialized XUartPs instance.
+* @param	RxStreamSize is the size of the receive stream buffer in bytes.
+* @param	TxStreamSize is the size of the transmit stream buffer in bytes.
+* @param	RxTriggerLevel is the RX FIFO trigger level, 1 to 63 bytes.
+* @param	RxTimeout is the receive timeout in units of 4 bit periods,
+*		0 disables the timeout.
+*
+* @return
+*		- XST_SUCCESS if the instance was initialized.
+*		- XST_FAILURE if the stream buffers could not be allocated.
+*
+* @note		The interrupt must be connected to XUartPs_StreamIntrHandler()
+*		and enabled in the interrupt controller by the caller.
+*
+*****************************************************************************/
+s32 XUartPs_StreamInitialize(XUartPs_Stream *StreamPtr, XUartPs *UartPtr,
+			     size_t RxStreamSize, size_t TxStreamSize,
+			     u8 RxTriggerLevel, u8 RxTimeout)
+{
+	u32 Mask;
+
+	Xil_AssertNonvoid(StreamPtr != NULL);
+	Xil_AssertNonvoid(UartPtr != NULL);
+	Xil_AssertNonvoid(UartPtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid((RxTriggerLevel > 0U) &&
+			  (RxTriggerLevel < XUARTPS_STREAM_FIFO_SIZE));
+
+	StreamPtr->UartPtr = UartPtr;
+	StreamPtr->RxDropped = 0U;
+	StreamPtr->RxErrors = 0U;
+
+	/*
+	 * A trigger level of one byte wakes the reader on every interrupt;
+	 * the FIFO trigger level and timeout already batch the data.
+	 */
+	StreamPtr->RxStream = xStreamBufferCreate(RxStreamSize, 1);
+	StreamPtr->TxStream = xStreamBufferCreate(TxStreamSize, 1);
+	if ((StreamPtr->RxStream == NULL) || (StreamPtr->TxStream == NULL)) {
+		XUartPs_StreamDelete(StreamPtr);
+		return (s32)XST_FAILURE;
+	}
+
+	XUartPs_SetInterruptMask(UartPtr, 0U);
+	XUartPs_SetFifoThreshold(UartPtr, RxTriggerLevel);
+	XUartPs_SetRecvTimeout(UartPtr, RxTimeout);
+
+	/* Discard anything received before the stream was set up */
+	while (XUartPs_IsReceiveData(UartPtr->Config.BaseAddress)) {
+		(void)XUartPs_ReadReg(UartPtr->Config.BaseAddress,
+				      XUARTPS_FIFO_OFFSET);
+	}
+	XUartPs_WriteReg(UartPtr->Config.BaseAddress, XUARTPS_ISR_OFFSET,
+			 XUARTPS_IXR_MASK);
+
+	Mask = XUARTPS_STREAM_RX_IXR | XUARTPS_STREAM_ERR_IXR;
+	if (RxTimeout == 0U) {
+		Mask &= ~(u32)XUARTPS_IXR_TOUT;
+	}
+	XUartPs_SetInterruptMask(UartPtr, Mask);
+
+	return (s32)XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+*
+* Disables the UART interrupts and deletes the stream buffers of a stream
+* interface instance.
+*
+* @param	StreamPtr is a pointer to the XUartPs_Stream instance.
+*
+* @return	None.
+*
+* @note		No task may be blocked on the instance.
+*
+*****************************************************************************/
+void XUartPs_StreamDelete(XUartPs_Stream *StreamPtr)
+{
+	Xil_AssertVoid(StreamPtr != NULL);
+
+	XUartPs_SetInterruptMask(StreamPtr->UartPtr, 0U);
+
+	if (StreamPtr->RxStream != NULL) {
+		vStreamBufferDelete(StreamPtr->RxStream);
+		StreamPtr->RxStream = NULL;
+	}
+	if (StreamPtr->TxStream != NULL) {
+		vStreamBufferDelete(StreamPtr->TxStream);
+		StreamPtr->TxStream = NULL;
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* Queues data for transmission. The data is copied to the transmit stream
+* buffer and moved to the TX FIFO by the interrupt handler each time the FIFO
+* empties.
+*
+* @param	StreamPtr is a pointer to the XUartPs_Stream instance.
+* @param	BufferPtr is a pointer to the data to send.
+* @param	NumBytes is the number of bytes to send.
+* @param	TicksToWait is the maximum time to block for space in the
+*		transmit stream buffer.
+*
+* @return	The number of bytes queued.
+*
+* @note		None.
+*
+*****************************************************************************/
+size_t XUartPs_StreamSend(XUartPs_Stream *StreamPtr, const u8 *BufferPtr,
+			  size_t NumBytes, TickType_t TicksToWait)
+{
+	size_t Sent;
+
+	Xil_AssertNonvoid(StreamPtr != NULL);
+	Xil_AssertNonvoid(BufferPtr != NULL);
+
+	Sent = xStreamBufferSend(StreamPtr->TxStream, BufferPtr, NumBytes,
+				 TicksToWait);
+
+	/*
+	 * The handler disables the TX empty interrupt once the stream is
+	 * drained. Enabling it again raises it at once if the FIFO is empty.
+	 */
+	if (Sent != 0U) {
+		XUartPs_WriteReg(StreamPtr->UartPtr->Config.BaseAddress,
+				 XUARTPS_IER_OFFSET, XUARTPS_IXR_TXEMPTY);
+	}
+
+	return Sent;
+}
+
+/****************************************************************************/
+/**
+*
+* Receives data from the receive stream buffer, blocking until at least one
+* byte is available or TicksToWait expires.
+*
+* @param	StreamPtr is a pointer to the XUartPs_Stream instance.
+* @param	BufferPtr is a pointer to the buffer for the data.
+* @param	NumBytes is the size of the buffer in bytes.
+* @param	TicksToWait is the maximum time to block.
+*
+* @return	The number of bytes received.
+*
+* @note		None.
+*
+*****************************************************************************/
+size_t XUartPs_StreamRecv(XUartPs_Stream *StreamPtr, u8 *BufferPtr,
+			  size_t NumBytes, TickType_t TicksToWait)
+{
+	Xil_AssertNonvoid(StreamPtr != NULL);
+	Xil_AssertNonvoid(BufferPtr != NULL);
+
+	return xStreamBufferReceive(StreamPtr->RxStream, BufferPtr, NumBytes,
+				    TicksToWait);
+}
+
+/****************************************************************************/
+/**
+*
+* Interrupt handler of the stream interface. Moves the RX FIFO contents to
+* the receive stream buffer and refills the TX FIFO from the transmit stream
+* buffer, waking at most one reader and one writer.
+*
+* @param	CallBackRef is a pointer to the XUartPs_Stream instance.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+void XUartPs_StreamIntrHandler(void *CallBackRef)
+{
+	XUartPs_Stream *StreamPtr = (XUartPs_Stream *)CallBackRef;
+	UINTPTR BaseAddress;
+	BaseType_t Woken = pdFALSE;
+	u32 IsrStatus;
+
+	Xil_AssertVoid(StreamPtr != NULL);
+
+	BaseAddress = StreamPtr->UartPtr->Config.BaseAddress;
+
+	IsrStatus = XUartPs_ReadReg(BaseAddress, XUARTPS_IMR_OFFSET);
+	IsrStatus &= XUartPs_ReadReg(BaseAddress, XUARTPS_ISR_OFFSET);
+	XUartPs_WriteReg(BaseAddress, XUARTPS_ISR_OFFSET, IsrStatus);
+
+	if ((IsrStatus & XUARTPS_STREAM_ERR_IXR) != 0U) {
+		StreamPtr->RxErrors++;
+	}
+
+	if ((IsrStatus & XUARTPS_STREAM_RX_IXR) != 0U) {
+		XUartPs_StreamRxFifo(StreamPtr, &Woken);
+	}
+
+	if ((IsrStatus & XUARTPS_IXR_TOUT) != 0U) {
+		/* Restart the receiver timeout for the next idle period */
+		XUartPs_WriteReg(BaseAddress, XUARTPS_CR_OFFSET,
+			XUartPs_ReadReg(BaseAddress, XUARTPS_CR_OFFSET) |
+			XUARTPS_CR_TORST);
+	}
+
+	if ((IsrStatus & XUARTPS_IXR_TXEMPTY) != 0U) {
+		XUartPs_StreamTxFifo(StreamPtr, &Woken);
+	}
+
+	portYIELD_FROM_ISR(Woken);
+}
+
+/****************************************************************************/
+/**
+*
+* Empties the RX FIFO into the receive stream buffer with a single stream
+* buffer write.
+*
+* @param	StreamPtr is a pointer to the XUartPs_Stream instance.
+* @param	WokenPtr is set to pdTRUE if a higher priority task was woken.
+*
+* @return	None.
+*
+* @note		Bytes that do not fit in the stream buffer are dropped and
+*		counted in RxDropped.
+*
+*****************************************************************************/
+static void XUartPs_StreamRxFifo(XUartPs_Stream *StreamPtr,
+				 BaseType_t *WokenPtr)
+{
+	UINTPTR BaseAddress = StreamPtr->UartPtr->Config.BaseAddress;
+	u8 Data[XUARTPS_STREAM_FIFO_SIZE];
+	size_t Count = 0U;
+	size_t Sent;
+
+	while ((Count < sizeof(Data)) &&
+	       XUartPs_IsReceiveData(BaseAddress)) {
+		Data[Count] = (u8)XUartPs_ReadReg(BaseAddress,
+						  XUARTPS_FIFO_OFFSET);
+		Count++;
+	}
+
+	if (Count != 0U) {
+		Sent = xStreamBufferSendFromISR(StreamPtr->RxStream, Data,
+						Count, WokenPtr);
+		StreamPtr->RxDropped += (u32)(Count - Sent);
+	}
+}
+
+/****************************************************************************/
+/**
+*
+* Fills the empty TX FIFO from the transmit stream buffer, and disables the
+* TX empty interrupt once there is nothing left to send.
+*
+* @param	StreamPtr is a pointer to the XUartPs_Stream instance.
+* @param	WokenPtr is set to pdTRUE if a higher priority task was woken.
+*
+* @return	None.
+*
+* @note		None.
+*
+*****************************************************************************/
+static void XUartPs_StreamTxFifo(XUartPs_Stream *StreamPtr,
+				 BaseType_t *WokenPtr)
+{
+	UINTPTR BaseAddress = StreamPtr->UartPtr->Config.BaseAddress;
+	u8 Data[XUARTPS_STREAM_FIFO_SIZE];
+	size_t Count;
+	size_t Index;
+
+	Count = xStreamBufferReceiveFromISR(StreamPtr->TxStream, Data,
+					    sizeof(Data), WokenPtr);
+	if (Count == 0U) {
+		XUartPs_WriteReg(BaseAddress, XUARTPS_IDR_OFFSET,
+				 XUARTPS_IXR_TXEMPTY);
+		return;
+	}
+
+	for (Index = 0U; Index < Count; Index++) {
+		XUartPs_WriteReg(BaseAddress, XUARTPS_FIFO_OFFSET,
+				 (u32)Data[Index]);
+	}
+}
+
+#endif /* FREERTOS_BSP */
+/** @} */
@@ -0,0 +1,103 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/****************************************************************************/
+/**
+*
+* @file xuartps_stream.h
+* @addtogroup uartps_v3_11
+* @{
+*
+* This file contains the FreeRTOS stream buffer interface of the UART driver.
+* It is only built when the driver is part of a FreeRTOS BSP.
+*
+* The interrupt handler moves received data from the RX FIFO to a FreeRTOS
+* stream buffer, and data to be sent from a second stream buffer to the TX
+* FIFO, a FIFO worth of bytes at a time. The RX FIFO trigger level and the
+* receive timeout decide when the interrupt fires, so a task blocked in
+* XUartPs_StreamRecv() is woken once per threshold or idle line rather than
+* once per character.
+*
+* Each stream buffer has a single reader and a single writer: only one task
+* may call XUartPs_StreamRecv() and only one task may call
+* XUartPs_StreamSend() for an instance, and both must run on the core that
+* services the UART interrupt.
+*
+* The application connects XUartPs_StreamIntrHandler() to the interrupt
+* system in place of XUartPs_InterruptHandler(), with the XUartPs_Stream
+* instance as the callback reference.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who    Date     Changes
+* ----- ------ -------- ----------------------------------------------
+* 3.11  agt    10/17/26 First release
+* </pre>
+*
+*****************************************************************************/
+
+#ifndef XUARTPS_STREAM_H		/* prevent circular inclusions */
+#define XUARTPS_STREAM_H		/* by using protection macros */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files ********************************/
+
+#include "bspconfig.h"
+
+#ifdef FREERTOS_BSP
+
+#include "FreeRTOS.h"
+#include "stream_buffer.h"
+#include "xuartps.h"
+
+/************************** Constant Definitions ****************************/
+
+/**
+ * Depth of the RX and TX FIFOs in bytes
+ */
+#define XUARTPS_STREAM_FIFO_SIZE	64U
+
+/**************************** Type Definitions ******************************/
+
+/**
+ * The stream interface instance data. The user allocates one for each UART
+ * used through the stream interface.
+ */
+typedef struct {
+	XUartPs *UartPtr;		/**< Initialized UART driver instance */
+	StreamBufferHandle_t RxStream;	/**< Received data */
+	StreamBufferHandle_t TxStream;	/**< Data waiting for the TX FIFO */
+	u32 RxDropped;			/**< Bytes lost as RxStream was full */
+	u32 RxErrors;			/**< Overrun, framing and parity errors */
+} XUartPs_Stream;
+
+/************************** Function Prototypes *****************************/
+
+s32 XUartPs_StreamInitialize(XUartPs_Stream *StreamPtr, XUartPs *UartPtr,
+			     size_t RxStreamSize, size_t TxStreamSize,
+			     u8 RxTriggerLevel, u8 RxTimeout);
+
+void XUartPs_StreamDelete(XUartPs_Stream *StreamPtr);
+
+size_t XUartPs_StreamSend(XUartPs_Stream *StreamPtr, const u8 *BufferPtr,
+			  size_t NumBytes, TickType_t TicksToWait);
+
+size_t XUartPs_StreamRecv(XUartPs_Stream *StreamPtr, u8 *BufferPtr,
+			  size_t NumBytes, TickType_t TicksToWait);
+
+void XUartPs_StreamIntrHandler(void *CallBackRef);
+
+#endif /* FREERTOS_BSP */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* end of protection macro */
+/** @} */
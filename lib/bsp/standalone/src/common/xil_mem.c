@@ -8,8 +8,8 @@
 /**
 * @file xil_mem.c
 *
-* This file contains xil mem copy function to use in case of word aligned
-* data copies.
+* This file contains xil mem copy, set and move functions to use in case of
+* word aligned data copies.
 *
 * <pre>
 * MODIFICATION HISTORY:
@@ -22,6 +22,11 @@
 * 			  violations.
 * 7.7	sk	 01/10/22 Include xil_mem.h header file to fix Xil_MemCpy
 * 			  prototype misra_c_2012_rule_8_4 violation.
+* 7.8   agt      10/17/26 Align and unroll word copies in Xil_MemCpy, added
+*                         Xil_MemSet and Xil_MemMove functions.
+* 7.8   agt      10/17/26 Keep the compiler from turning the Xil_MemCpy and
+*                         Xil_MemSet loops into memcpy/memset calls, fixed
+*                         overlap check of Xil_MemMove at the top of memory.
 *
 * </pre>
 *
@@ -32,10 +37,34 @@
 #include "xil_types.h"
 #include "xil_mem.h"
 
+/************************** Constant Definitions ****************************/
+#define XIL_MEM_WORD_MASK	((UINTPTR)sizeof(u32) - 1U)
+#define XIL_MEM_BLOCK_WORDS	8U	/* Words moved per unrolled iteration */
+#define XIL_MEM_BLOCK_SIZE	(XIL_MEM_BLOCK_WORDS * (u32)sizeof(u32))
+
+/*
+ * The copy and fill loops below are what the compiler recognizes as memcpy
+ * and memset. Stop it from replacing them with library calls, which would
+ * recurse when the library routines are built on these functions.
+ */
+#if defined (__clang__)
+#define XIL_MEM_NO_LIBCALL	__attribute__((no_builtin("memcpy", "memset")))
+#elif defined (__GNUC__)
+#define XIL_MEM_NO_LIBCALL	\
+	__attribute__((optimize("no-tree-loop-distribute-patterns")))
+#else
+#define XIL_MEM_NO_LIBCALL
+#endif
+
 /***************** Inline Functions Definitions ********************/
 /*****************************************************************************/
 /**
 * @brief       This  function copies memory from once location to other.
+*              When source and destination have the same word alignment,
+*              leading bytes are copied till destination is word aligned
+*              and the bulk of the data is copied in blocks of 8 words,
+*              which the compiler maps to ldm/stm on Cortex-R5 and
+*              ldp/stp on Cortex-A53/A72.
 *
 * @param       dst: pointer pointing to destination memory
 *
@@ -44,10 +73,39 @@
 * @param       cnt: 32 bit length of bytes to be copied
 *
 *****************************************************************************/
+XIL_MEM_NO_LIBCALL
 void Xil_MemCpy(void* dst, const void* src, u32 cnt)
 {
 	char *d = (char*)(void *)dst;
 	const char *s = src;
+	u32 *dw;
+	const u32 *sw;
+
+	if ((((UINTPTR)d ^ (UINTPTR)s) & XIL_MEM_WORD_MASK) == 0U) {
+		while ((cnt > 0U) && (((UINTPTR)d & XIL_MEM_WORD_MASK) != 0U)) {
+			*d = *s;
+			d += 1U;
+			s += 1U;
+			cnt -= 1U;
+		}
+		dw = (u32 *)(void *)d;
+		sw = (const u32 *)(const void *)s;
+		while (cnt >= XIL_MEM_BLOCK_SIZE) {
+			dw[0] = sw[0];
+			dw[1] = sw[1];
+			dw[2] = sw[2];
+			dw[3] = sw[3];
+			dw[4] = sw[4];
+			dw[5] = sw[5];
+			dw[6] = sw[6];
+			dw[7] = sw[7];
+			dw += XIL_MEM_BLOCK_WORDS;
+			sw += XIL_MEM_BLOCK_WORDS;
+			cnt -= XIL_MEM_BLOCK_SIZE;
+		}
+		d = (char *)(void *)dw;
+		s = (const char *)(const void *)sw;
+	}
 
 	while (cnt >= sizeof (s32)) {
 		*(s32*)d = *(s32*)s;
@@ -68,3 +126,106 @@ void Xil_MemCpy(void* dst, const void* src, u32 cnt)
 		cnt -= 1U;
 	}
 }
+
+/*****************************************************************************/
+/**
+* @brief       This function fills memory with a constant byte. Leading bytes
+*              are written till destination is word aligned and the bulk of
+*              the memory is written in blocks of 8 words.
+*
+* @param       dst: pointer pointing to destination memory
+*
+* @param       val: byte value to be written
+*
+* @param       cnt: 32 bit length of bytes to be written
+*
+*****************************************************************************/
+XIL_MEM_NO_LIBCALL
+void Xil_MemSet(void* dst, u8 val, u32 cnt)
+{
+	char *d = (char*)(void *)dst;
+	u32 *dw;
+	u32 Word = (u32)val * 0x01010101U;
+
+	while ((cnt > 0U) && (((UINTPTR)d & XIL_MEM_WORD_MASK) != 0U)) {
+		*d = (char)val;
+		d += 1U;
+		cnt -= 1U;
+	}
+	dw = (u32 *)(void *)d;
+	while (cnt >= XIL_MEM_BLOCK_SIZE) {
+		dw[0] = Word;
+		dw[1] = Word;
+		dw[2] = Word;
+		dw[3] = Word;
+		dw[4] = Word;
+		dw[5] = Word;
+		dw[6] = Word;
+		dw[7] = Word;
+		dw += XIL_MEM_BLOCK_WORDS;
+		cnt -= XIL_MEM_BLOCK_SIZE;
+	}
+	while (cnt >= sizeof (u32)) {
+		*dw = Word;
+		dw += 1U;
+		cnt -= sizeof (u32);
+	}
+	d = (char *)(void *)dw;
+	while ((cnt) > 0U){
+		*d = (char)val;
+		d += 1U;
+		cnt -= 1U;
+	}
+}
+
+/*****************************************************************************/
+/**
+* @brief       This function copies memory from one location to other where
+*              the source and destination regions may overlap. If the
+*              destination does not start inside the source region, data is
+*              copied forward using Xil_MemCpy, else it is copied backward
+*              starting from the end of the regions.
+*
+* @param       dst: pointer pointing to destination memory
+*
+* @param       src: pointer pointing to source memory
+*
+* @param       cnt: 32 bit length of bytes to be copied
+*
+*****************************************************************************/
+void Xil_MemMove(void* dst, const void* src, u32 cnt)
+{
+	char *d = (char*)(void *)dst;
+	const char *s = src;
+
+	/* Unsigned difference, s + cnt could wrap at the top of memory */
+	if (((UINTPTR)d <= (UINTPTR)s) ||
+		(((UINTPTR)d - (UINTPTR)s) >= (UINTPTR)cnt)) {
+		Xil_MemCpy(dst, src, cnt);
+	}
+	else {
+		d += cnt;
+		s += cnt;
+		if ((((UINTPTR)d ^ (UINTPTR)s) & XIL_MEM_WORD_MASK) == 0U) {
+			while ((cnt > 0U) &&
+				(((UINTPTR)d & XIL_MEM_WORD_MASK) != 0U)) {
+				d -= 1U;
+				s -= 1U;
+				*d = *s;
+				cnt -= 1U;
+			}
+			while (cnt >= sizeof (u32)) {
+				d -= sizeof (u32);
+				s -= sizeof (u32);
+				*(u32 *)(void *)d = *(const u32 *)(const void *)s;
+				cnt -= sizeof (u32);
+			}
+		}
+		while ((cnt) > 0U){
+			d -= 1U;
+			s -= 1U;
+			*d = *s;
+			cnt -= 1U;
+		}
+	}
+}
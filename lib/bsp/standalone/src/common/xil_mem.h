@@ -22,6 +22,7 @@
 * ----- -------- -------- -----------------------------------------------
 * 6.1   nsk      11/07/16 First release.
 * 7.0   mus      01/07/19 Add cpp extern macro
+* 7.8   agt      10/17/26 Added Xil_MemSet and Xil_MemMove functions
 *
 * </pre>
 *
@@ -36,6 +37,8 @@ extern "C" {
 /************************** Function Prototypes *****************************/
 
 void Xil_MemCpy(void* dst, const void* src, u32 cnt);
+void Xil_MemSet(void* dst, u8 val, u32 cnt);
+void Xil_MemMove(void* dst, const void* src, u32 cnt);
 
 #ifdef __cplusplus
 }
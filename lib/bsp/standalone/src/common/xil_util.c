@@ -73,6 +73,10 @@
 * 			  fix misra_c_2012_rule_13_3 violation.
 * 7.7	sk	 03/02/22 Update values from signed to unsigned to fix
 * 			  misra_c_2012_rule_10_4 violation.
+* 7.8   agt      10/17/26 Use word wide accesses in Xil_SecureMemCpy,
+*                         Xil_SecureZeroize and Xil_SMemCmp_CT and added
+*                         compiler barriers in Xil_SecureZeroize and
+*                         Xil_SMemSet
 *
 * </pre>
 *
@@ -84,6 +88,16 @@
 
 /************************** Constant Definitions ****************************/
 #define MAX_NIBBLES			8U
+#define XIL_WORD_ALIGN_MASK		((UINTPTR)sizeof(u32) - 1U)
+#define XIL_WORDS_PER_BLOCK		8U /* Words compared per block */
+
+/***************** Macros (Inline Functions) Definitions *********************/
+/* Prevents the compiler from eliding or reordering memory accesses */
+#if defined (__GNUC__) || defined (__clang__)
+#define XIL_COMPILER_BARRIER()		__asm__ volatile ("" : : : "memory")
+#else
+#define XIL_COMPILER_BARRIER()
+#endif
 
 /************************** Function Prototypes *****************************/
 
@@ -724,12 +738,24 @@ int Xil_SecureMemCpy(void * DestPtr, u32 DestPtrLen, const void * SrcPtr, u32 Le
 	}
 
 	if (Len > DestPtrLen) {
-		while (DestPtrLen != 0U) {
-			*Dest = 0U;
+		(void)Xil_SecureZeroize(Dest, DestPtrLen);
+		goto END;
+	}
+
+	/* Copy word wise when source and destination have same alignment */
+	if ((((UINTPTR)Dest ^ (UINTPTR)Src) & XIL_WORD_ALIGN_MASK) == 0U) {
+		while ((Len != 0U) && (((UINTPTR)Dest & XIL_WORD_ALIGN_MASK) != 0U)) {
+			*Dest = *Src;
 			Dest++;
-			DestPtrLen--;
+			Src++;
+			Len--;
+		}
+		while (Len >= sizeof(u32)) {
+			*(u32 *)(void *)Dest = *(const u32 *)(const void *)Src;
+			Dest += sizeof(u32);
+			Src += sizeof(u32);
+			Len -= (u32)sizeof(u32);
 		}
-		goto END;
 	}
 
 	/* Loop and copy.  */
@@ -808,23 +834,37 @@ END:
  ********************************************************************************/
 int Xil_SecureZeroize(u8 *DataPtr, const u32 Length)
 {
-	u32 Index;
+	u32 Index = 0U;
+	u32 Data = 0U;
 	int Status = XST_FAILURE;
 
 	/* Clear the data */
 	(void)memset(DataPtr, 0, Length);
 
+	/*
+	 * Barrier makes sure the clear is not elided and the read back is not
+	 * folded into the known result of memset
+	 */
+	XIL_COMPILER_BARRIER();
+
 	/* Read it back to verify */
-	 for (Index = 0U; Index < Length; Index++) {
-		if (DataPtr[Index] != 0x00U) {
-			goto END;
-		}
+	while ((Index < Length) &&
+		((((UINTPTR)DataPtr + Index) & XIL_WORD_ALIGN_MASK) != 0U)) {
+		Data |= DataPtr[Index];
+		Index++;
+	}
+	while ((Length - Index) >= sizeof(u32)) {
+		Data |= *(const u32 *)(const void *)&DataPtr[Index];
+		Index += (u32)sizeof(u32);
+	}
+	while (Index < Length) {
+		Data |= DataPtr[Index];
+		Index++;
 	}
-	if (Index == Length) {
+	if ((Data == 0U) && (Index == Length)) {
 		Status = XST_SUCCESS;
 	}
 
-END:
 	return Status;
 }
 
@@ -899,6 +939,10 @@ int Xil_SMemCmp_CT(const void *Src1, const u32 Src1Size,
 	u32 Cnt = CmpLen;
 	const u8 *Src_1 = (const u8 *)Src1;
 	const u8 *Src_2 = (const u8 *)Src2;
+	const u32 *Word1;
+	const u32 *Word2;
+	u32 Diff;
+	u32 Idx;
 
 
 	if ((Src1 == NULL) || (Src2 == NULL)) {
@@ -908,6 +952,26 @@ int Xil_SMemCmp_CT(const void *Src1, const u32 Src1Size,
 		Status =  XST_INVALID_PARAM;
 	}
 	else {
+		/*
+		 * Compare a block of words at a time and accumulate the
+		 * difference in a register before updating the volatile
+		 * accumulators, all blocks are compared irrespective of the
+		 * content
+		 */
+		while (Cnt >= (XIL_WORDS_PER_BLOCK * sizeof(u32))) {
+			Word1 = (const u32 *)(const void *)Src_1;
+			Word2 = (const u32 *)(const void *)Src_2;
+			Diff = 0U;
+			for (Idx = 0U; Idx < XIL_WORDS_PER_BLOCK; Idx++) {
+				Diff |= (Word1[Idx] ^ Word2[Idx]);
+			}
+			Data |= Diff;
+			DataRedundant &= ~Data;
+			Src_1 += (XIL_WORDS_PER_BLOCK * sizeof(u32));
+			Src_2 += (XIL_WORDS_PER_BLOCK * sizeof(u32));
+			Cnt -= (XIL_WORDS_PER_BLOCK * (u32)sizeof(u32));
+		}
+
 		while (Cnt >= sizeof(u32)) {
 			Data |= (*(const u32 *)Src_1 ^ *(const u32 *)Src_2);
 			DataRedundant &= ~Data;
@@ -1007,6 +1071,8 @@ int Xil_SMemSet(void *Dest, const u32 DestSize,
 	}
 	else {
 		(void)memset(Dest, (s32)Data, Len);
+		/* Make sure the writes are not elided */
+		XIL_COMPILER_BARRIER();
 		Status = XST_SUCCESS;
 	}
 
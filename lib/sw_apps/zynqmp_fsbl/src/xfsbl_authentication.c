@@ -39,6 +39,8 @@
 *       bsv  05/03/21 Add provision to load bitstream from OCM with DDR
 *                     present in design
 * 8.0   bsv  07/13/21 Remove unwanted CsuDma initializations
+* 9.0   agt  10/17/26 Added cache of successful RSA signature verifications
+*       agt  10/17/26 Added redundant check of the RSA cache lookup status
 *
 * </pre>
 *
@@ -63,6 +65,30 @@ extern u8 ReadBuffer[READ_BUFFER_SIZE];
 u8 EfusePpkKey[XFSBL_PPK_SIZE]__attribute__ ((aligned (32))) = {0U};
 static XSecure_Rsa SecureRsa;
 
+#ifndef FSBL_RSA_VERIFY_CACHE_EXCLUDE
+#define XFSBL_RSA_CACHE_TYPE_SPK		(0x5C3A96E1U)
+#define XFSBL_RSA_CACHE_TYPE_PART		(0xA3C5691EU)
+
+/**
+ * Each entry holds a hash whose RSA signature was verified successfully and
+ * the type of key used. The entry is also stored inverted, and an entry is
+ * used only when both copies agree, so a corrupted or glitched entry can not
+ * turn into a cache hit.
+ */
+typedef struct {
+	u32 Type;
+	u32 TypeInv;
+	u32 Hash[XFSBL_HASH_TYPE_SHA3 / 4U];
+	u32 HashInv[XFSBL_HASH_TYPE_SHA3 / 4U];
+} XFsbl_RsaCacheEntry;
+
+static XFsbl_RsaCacheEntry RsaCache[XFSBL_RSA_CACHE_ENTRIES];
+static u32 RsaCacheNext;
+
+static u32 XFsbl_RsaCacheLookup(u32 Type, const u8 *Hash);
+static void XFsbl_RsaCacheAdd(u32 Type, const u8 *Hash);
+#endif
+
 /*****************************************************************************/
 /**
  * Configure the RSA and SHA for the SPK
@@ -98,6 +124,10 @@ u32 XFsbl_SpkVer(u64 AcOffset, u32 HashLen)
 	u32 *SpkId = (u32 *)(AcPtr + XFSBL_SPKID_AC_ALIGN);
 	u32 UserFuseAddr;
 	u32 UserFuseVal;
+#ifndef FSBL_RSA_VERIFY_CACHE_EXCLUDE
+	volatile u32 CacheStatus = XFSBL_FAILURE;
+	volatile u32 CacheStatusTmp = XFSBL_FAILURE;
+#endif
 
 	(void)XFsbl_ShaStart(ShaCtx, HashLen);
 	if (SpkIdFuseSel == XFSBL_SPKID_EFUSE) {
@@ -126,6 +156,22 @@ u32 XFsbl_SpkVer(u64 AcOffset, u32 HashLen)
 
 	XFsbl_ShaFinish(ShaCtx, (u8 *)SpkHash, HashLen);
 
+#ifndef FSBL_RSA_VERIFY_CACHE_EXCLUDE
+	/*
+	 * Skip the RSA operation if this SPK is already verified with the PPK.
+	 * The lookup is done twice so a single glitch can not skip it.
+	 */
+	CacheStatus = XFsbl_RsaCacheLookup(XFSBL_RSA_CACHE_TYPE_SPK, SpkHash);
+	CacheStatusTmp = XFsbl_RsaCacheLookup(XFSBL_RSA_CACHE_TYPE_SPK,
+			SpkHash);
+	if ((CacheStatus == XFSBL_SUCCESS) &&
+			(CacheStatusTmp == XFSBL_SUCCESS)) {
+		XFsbl_Printf(DEBUG_INFO, "XFsbl_SpkVer: SPK verified from cache\r\n");
+		Status = XFSBL_SUCCESS;
+		goto SPK_REVOKE_CHECK;
+	}
+#endif
+
 	/* Set PPK pointer */
 	PpkModular = (u8 *)PpkKey;
 	PpkKey += XFSBL_PPK_MOD_SIZE;
@@ -177,6 +223,11 @@ u32 XFsbl_SpkVer(u64 AcOffset, u32 HashLen)
 		goto END;
 	}
 
+#ifndef FSBL_RSA_VERIFY_CACHE_EXCLUDE
+	XFsbl_RsaCacheAdd(XFSBL_RSA_CACHE_TYPE_SPK, SpkHash);
+
+SPK_REVOKE_CHECK:
+#endif
 	/* SPK revocation check */
 	if ((EfuseRsa & EFUSE_SEC_CTRL_RSA_EN_MASK) != 0x00) {
 		EfuseSpkId = Xil_In32(EFUSE_SPKID);
@@ -259,6 +310,11 @@ static u32 XFsbl_PartitionSignVer(const XFsblPs *FsblInstancePtr, u64 PartitionO
 	u8 XFsbl_RsaSha3Array[512] = {0};
 	u32 HashLen = XFSBL_HASH_TYPE_SHA3;
 	s32 SStatus;
+#if !defined(FSBL_RSA_VERIFY_CACHE_EXCLUDE) && \
+	(XFSBL_RSA_CACHE_POLICY == XFSBL_RSA_CACHE_POLICY_ALL)
+	volatile u32 CacheStatus = XFSBL_FAILURE;
+	volatile u32 CacheStatusTmp = XFSBL_FAILURE;
+#endif
 
 	XFsbl_Printf(DEBUG_INFO, "Doing Partition Sign verification\r\n");
 
@@ -312,6 +368,26 @@ static u32 XFsbl_PartitionSignVer(const XFsblPs *FsblInstancePtr, u64 PartitionO
 
 	XFsbl_ShaFinish(ShaCtx, (u8 *)PartitionHash, HashLen);
 
+#if !defined(FSBL_RSA_VERIFY_CACHE_EXCLUDE) && \
+	(XFSBL_RSA_CACHE_POLICY == XFSBL_RSA_CACHE_POLICY_ALL)
+	/*
+	 * Partition hash covers the SPK in the AC, so a hit means this
+	 * partition was already verified with the same SPK. The lookup is
+	 * done twice so a single glitch can not skip the RSA operation.
+	 */
+	CacheStatus = XFsbl_RsaCacheLookup(XFSBL_RSA_CACHE_TYPE_PART,
+			PartitionHash);
+	CacheStatusTmp = XFsbl_RsaCacheLookup(XFSBL_RSA_CACHE_TYPE_PART,
+			PartitionHash);
+	if ((CacheStatus == XFSBL_SUCCESS) &&
+			(CacheStatusTmp == XFSBL_SUCCESS)) {
+		XFsbl_Printf(DEBUG_INFO,
+			"XFsbl_PartVer: Partition verified from cache\r\n");
+		Status = XFSBL_SUCCESS;
+		goto END;
+	}
+#endif
+
 	/* Set SPK pointer */
 	AcPtr += (XFSBL_RSA_AC_ALIGN + XFSBL_PPK_SIZE);
 	SpkModular = AcPtr;
@@ -367,6 +443,10 @@ static u32 XFsbl_PartitionSignVer(const XFsblPs *FsblInstancePtr, u64 PartitionO
 		Status = XFSBL_ERROR_PART_SIGNATURE;
 		goto END;
 	}
+#if !defined(FSBL_RSA_VERIFY_CACHE_EXCLUDE) && \
+	(XFSBL_RSA_CACHE_POLICY == XFSBL_RSA_CACHE_POLICY_ALL)
+	XFsbl_RsaCacheAdd(XFSBL_RSA_CACHE_TYPE_PART, PartitionHash);
+#endif
 	Status = XFSBL_SUCCESS;
 END:
 	return Status;
@@ -611,6 +691,10 @@ u32 XFsbl_BhAuthentication(const XFsblPs * FsblInstancePtr, u8 *Data,
 	/* Copy PPK to global variable for future use */
 	XFsbl_MemCpy(EfusePpkKey, AcPtr + XFSBL_AUTH_CERT_PPK_OFFSET,
 						XFSBL_PPK_SIZE);
+#ifndef FSBL_RSA_VERIFY_CACHE_EXCLUDE
+	/* Cached verifications belong to the previous PPK */
+	XFsbl_RsaCacheInvalidate();
+#endif
 
 	/* SPK verify */
 	Status = XFsbl_SpkVer(AcOffset, HashLen);
@@ -695,6 +779,106 @@ END:
 	return Status;
 }
 
+#ifndef FSBL_RSA_VERIFY_CACHE_EXCLUDE
+/*****************************************************************************/
+/**
+ * This function invalidates all the entries of RSA verification cache.
+ *
+ * @param	None
+ *
+ * @return	None
+ *
+ ******************************************************************************/
+void XFsbl_RsaCacheInvalidate(void)
+{
+	(void)memset(RsaCache, 0U, sizeof(RsaCache));
+	RsaCacheNext = 0U;
+}
+
+/*****************************************************************************/
+/**
+ * This function looks up a hash in the RSA verification cache.
+ *
+ * @param	Type is the type of key the hash was verified with
+ * @param	Hash is the calculated hash of the data to be authenticated
+ *
+ * @return	XFSBL_SUCCESS if the hash is already verified
+ *		XFSBL_FAILURE otherwise
+ *
+ * @note	An entry whose inverted copy does not match is treated as
+ *		tampered and the whole cache is invalidated.
+ *
+ ******************************************************************************/
+static u32 XFsbl_RsaCacheLookup(u32 Type, const u8 *Hash)
+{
+	volatile u32 Status = XFSBL_FAILURE;
+	u32 HashWord[XFSBL_HASH_TYPE_SHA3 / 4U];
+	const XFsbl_RsaCacheEntry *Entry;
+	u32 Index;
+	u32 WordIndex;
+	u32 Match;
+	u32 Intact;
+
+	(void)XFsbl_MemCpy(HashWord, Hash, XFSBL_HASH_TYPE_SHA3);
+
+	for (Index = 0U; Index < XFSBL_RSA_CACHE_ENTRIES; Index++) {
+		Entry = &RsaCache[Index];
+		if ((Entry->Type != XFSBL_RSA_CACHE_TYPE_SPK) &&
+			(Entry->Type != XFSBL_RSA_CACHE_TYPE_PART)) {
+			continue;
+		}
+		Intact = (u32)(Entry->Type == ~Entry->TypeInv);
+		Match = (u32)(Entry->Type == Type);
+		for (WordIndex = 0U; WordIndex < (XFSBL_HASH_TYPE_SHA3 / 4U);
+				WordIndex++) {
+			Intact &= (u32)(Entry->Hash[WordIndex] ==
+					~Entry->HashInv[WordIndex]);
+			Match &= (u32)(Entry->Hash[WordIndex] == HashWord[WordIndex]);
+		}
+		if (Intact != 1U) {
+			XFsbl_Printf(DEBUG_GENERAL,
+				"XFsbl_RsaCacheLookup: Cache entry corrupted\r\n");
+			XFsbl_RsaCacheInvalidate();
+			Status = XFSBL_FAILURE;
+			break;
+		}
+		if ((Match == 1U) && (WordIndex == (XFSBL_HASH_TYPE_SHA3 / 4U))) {
+			Status = XFSBL_SUCCESS;
+			break;
+		}
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function adds a successfully verified hash to the RSA verification
+ * cache, replacing the oldest entry when the cache is full.
+ *
+ * @param	Type is the type of key the hash was verified with
+ * @param	Hash is the hash whose signature was verified
+ *
+ * @return	None
+ *
+ ******************************************************************************/
+static void XFsbl_RsaCacheAdd(u32 Type, const u8 *Hash)
+{
+	XFsbl_RsaCacheEntry *Entry = &RsaCache[RsaCacheNext];
+	u32 WordIndex;
+
+	(void)XFsbl_MemCpy(Entry->Hash, Hash, XFSBL_HASH_TYPE_SHA3);
+	for (WordIndex = 0U; WordIndex < (XFSBL_HASH_TYPE_SHA3 / 4U);
+			WordIndex++) {
+		Entry->HashInv[WordIndex] = ~Entry->Hash[WordIndex];
+	}
+	Entry->TypeInv = ~Type;
+	Entry->Type = Type;
+
+	RsaCacheNext = (RsaCacheNext + 1U) % XFSBL_RSA_CACHE_ENTRIES;
+}
+#endif
+
 #endif /* end of XFSBL_SECURE */
 #ifdef XFSBL_PL_LOAD_FROM_OCM
 #ifdef XFSBL_BS
@@ -28,6 +28,7 @@
 *       bsv  04/01/21 Added TPM support
 *       bsv  05/03/21 Add provision to load bitstream from OCM with DDR
 *                     present in design
+* 6.0   agt  10/17/26 Added RSA signature verification cache
 *
 * </pre>
 *
@@ -97,6 +98,34 @@ extern "C" {
 /*User eFuse 0 */
 #define XFSBL_USER_EFUSE_ADDR					0xFFCC1020U
 
+/**
+ * RSA verification cache configuration.
+ * XFSBL_RSA_CACHE_ENTRIES is the number of verified hashes remembered.
+ * XFSBL_RSA_CACHE_POLICY selects which verifications are cached:
+ *  - XFSBL_RSA_CACHE_POLICY_SPK caches only SPK signatures, which are
+ *    otherwise verified again with the PPK for every partition
+ *  - XFSBL_RSA_CACHE_POLICY_ALL also caches partition signatures
+ * The cache is always invalidated when a new PPK is loaded during boot
+ * header authentication, and can be invalidated explicitly with
+ * XFsbl_RsaCacheInvalidate().
+ */
+#define XFSBL_RSA_CACHE_POLICY_SPK			(0U)
+#define XFSBL_RSA_CACHE_POLICY_ALL			(1U)
+
+#ifndef XFSBL_RSA_CACHE_ENTRIES
+#define XFSBL_RSA_CACHE_ENTRIES				(4U)
+#endif
+
+#ifndef XFSBL_RSA_CACHE_POLICY
+#define XFSBL_RSA_CACHE_POLICY				XFSBL_RSA_CACHE_POLICY_SPK
+#endif
+
+/* A cache without entries is compiled out */
+#if (XFSBL_RSA_CACHE_ENTRIES == 0U) && \
+	(!defined(FSBL_RSA_VERIFY_CACHE_EXCLUDE))
+#define FSBL_RSA_VERIFY_CACHE_EXCLUDE
+#endif
+
 
 /**
 * CSU RSA Register Map
@@ -121,6 +150,9 @@ u32 XFsbl_CompareHashs(u8 *Hash1, u8 *Hash2, u32 HashLen);
 u32 XFsbl_Sha3PadSelect(XSecure_Sha3PadType PadType);
 u32 XFsbl_BhAuthentication(const XFsblPs * FsblInstancePtr, u8 *Data,
 					u64 AcOffset, u8 IsEfuseRsa);
+#ifndef FSBL_RSA_VERIFY_CACHE_EXCLUDE
+void XFsbl_RsaCacheInvalidate(void);
+#endif
 #endif
 
 extern XCsuDma CsuDma;  /* CSU DMA instance */
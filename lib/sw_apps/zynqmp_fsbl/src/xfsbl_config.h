@@ -30,6 +30,7 @@
 *       bsv  05/15/21 Support to ensure authenticated images boot as
 *                     non-secure when RSA_EN is not programmed is disabled by
 *                     default
+* 5.0   agt  10/17/26 Added FSBL_RSA_VERIFY_CACHE_EXCLUDE_VAL configuration
 *
 *</pre>
 *
@@ -138,6 +139,9 @@ extern "C" {
  *     - FSBL_UNPROVISIONED_AUTH_SIGN_EXCLUDE_VAL Code to "load authenticated
  *       partitions as non secure when EFUSEs are not programmed and when boot
  *       header is not authenticated" is excluded
+ *     - FSBL_RSA_VERIFY_CACHE_EXCLUDE_VAL Caching of successful RSA signature
+ *       verifications, which avoids repeating the RSA operation for an SPK
+ *       or partition that is already verified, is excluded
  */
 #ifndef FSBL_NAND_EXCLUDE_VAL
 #define FSBL_NAND_EXCLUDE_VAL			(0U)
@@ -211,6 +215,10 @@ extern "C" {
 #define FSBL_UNPROVISIONED_AUTH_SIGN_EXCLUDE_VAL	(1U)
 #endif
 
+#ifndef FSBL_RSA_VERIFY_CACHE_EXCLUDE_VAL
+#define FSBL_RSA_VERIFY_CACHE_EXCLUDE_VAL	(0U)
+#endif
+
 #if (FSBL_NAND_EXCLUDE_VAL) && (!defined(FSBL_NAND_EXCLUDE))
 #define FSBL_NAND_EXCLUDE
 #endif
@@ -286,6 +294,11 @@ extern "C" {
 #define FSBL_UNPROVISIONED_AUTH_SIGN_EXCLUDE
 #endif
 
+#if (FSBL_RSA_VERIFY_CACHE_EXCLUDE_VAL == 1U) && \
+	(!defined(FSBL_RSA_VERIFY_CACHE_EXCLUDE))
+#define FSBL_RSA_VERIFY_CACHE_EXCLUDE
+#endif
+
 /************************** Function Prototypes ******************************/
 
 /************************** Variable Definitions *****************************/
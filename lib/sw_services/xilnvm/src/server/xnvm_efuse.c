@@ -80,6 +80,9 @@
 *                       Added checks for return value for
 *                       XNvm_EfuseDisableProgramming() and XNvm_EfuseResetReadMode()
 *       am   02/28/2022 Resolved MISRA C violations
+* 2.6   agt  10/17/2026 Added shadow copy of eFUSE cache to serve cache reads
+*                       Program all bits of a row before verifying the row
+*                       with a single read in XNvm_EfusePgmAndVerifyRows
 *
 * </pre>
 *
@@ -118,6 +121,8 @@
 #define XNVM_EFUSE_TSU_H_CS_DIV			(5434783UL)
 /**< Efuse total number of rows */
 #define XNVM_EFUSE_TOTAL_NUM_OF_ROWS		(768U)
+/**< Marker indicating shadow copy of eFuse cache is valid */
+#define XNVM_EFUSE_SHADOW_VALID			(0x5A5AA5A5U)
 /**< PPK hash number of eFuse rows */
 #define XNVM_EFUSE_TOTAL_PPK_HASH_ROWS  (XNVM_EFUSE_PPK_HASH_NUM_OF_ROWS * 3U)
 /**< eFuse word length */
@@ -210,9 +215,13 @@ static inline int XNvm_EfuseResetReadMode(void);
 static inline void XNvm_EfuseInitTimers(void);
 static int XNvm_EfuseSetupController(XNvm_EfuseOpMode Op, XNvm_EfuseRdMode RdMode);
 static int XNvm_EfuseReadCache(u32 Row, u32* RowData);
+static int XNvm_EfuseReadCacheRow(u32 Row, u32* RowData);
+static int XNvm_EfuseLoadShadow(void);
+static inline void XNvm_EfuseInvalidateShadow(void);
 static int XNvm_EfuseReadCacheRange(u32 StartRow, u8 RowCount, u32* RowData);
 static int XNvm_EfusePgmBit(XNvm_EfuseType Page, u32 Row, u32 Col);
 static int XNvm_EfuseVerifyBit(XNvm_EfuseType Page, u32 Row, u32 Col);
+static int XNvm_EfuseVerifyRow(XNvm_EfuseType Page, u32 Row, u32 Mask);
 static int XNvm_EfusePgmAndVerifyBit(XNvm_EfuseType Page, u32 Row, u32 Col);
 static int XNvm_EfuseCacheLoad(void);
 static int XNvm_EfuseCheckForTBits(void);
@@ -267,6 +276,10 @@ static int XNvm_EfusePrgmPufFuses(const XNvm_EfusePufFuse *WritePufFuses);
 #endif
 
 /*************************** Variable Definitions *****************************/
+/**< Shadow copy of eFuse cache, filled on first cache read (3KB of RAM) */
+static u32 EfuseShadow[XNVM_EFUSE_TOTAL_NUM_OF_ROWS];
+/**< XNVM_EFUSE_SHADOW_VALID when EfuseShadow matches eFuse cache */
+static volatile u32 EfuseShadowValid = 0U;
 
 /*************************** Function Definitions *****************************/
 
@@ -4509,7 +4522,8 @@ END:
 /******************************************************************************/
 /**
  * @brief	This function sets and then verifies the specified bits
- *		in the eFUSE.
+ *		in the eFUSE. All bits of a row are programmed first and then
+ *		verified together with one read of the row.
  *
  * @param	StartRow  - Starting Row number (0-based addressing).
  * @param	RowCount  - Number of Rows to be written.
@@ -4551,8 +4565,7 @@ static int XNvm_EfusePgmAndVerifyRows(u32 StartRow, u8 RowCount,
 		Idx = 0U;
 		while ((Data != 0U) && (Idx < XNVM_EFUSE_MAX_BITS_IN_ROW)) {
 			if ((Data & 0x01U) == 0x01U) {
-				Status = XNvm_EfusePgmAndVerifyBit(EfuseType,
-								Row, Idx);
+				Status = XNvm_EfusePgmBit(EfuseType, Row, Idx);
 				if (Status != XST_SUCCESS) {
 					goto END;
 				}
@@ -4561,6 +4574,16 @@ static int XNvm_EfusePgmAndVerifyRows(u32 StartRow, u8 RowCount,
 			Data = Data >> 1U;
 		}
 
+		/* Verify all programmed bits of the row with a single read */
+		if (DataPtr[Count] != 0U) {
+			Status = XST_FAILURE;
+			Status = XNvm_EfuseVerifyRow(EfuseType, Row,
+						DataPtr[Count]);
+			if (Status != XST_SUCCESS) {
+				goto END;
+			}
+		}
+
 		Count++;
 		Row++;
 	}
@@ -4861,6 +4884,7 @@ static int XNvm_EfuseSetupController(XNvm_EfuseOpMode Op,
 	XNvm_EfuseSetRefClk();
 
 	if (XNVM_EFUSE_MODE_PGM == Op) {
+		XNvm_EfuseInvalidateShadow();
 		XNvm_EfuseEnableProgramming();
 	}
 
@@ -4884,6 +4908,9 @@ END:
 /******************************************************************************/
 /**
  * @brief	This function reads 32-bit data from cache specified by Row.
+ *		Data is served from the shadow copy of eFUSE cache, which is
+ *		filled on first use. If the shadow copy can not be filled the
+ *		row is read directly from eFUSE cache.
  *
  * @param	Row 	- Starting Row number (0-based addressing).
  * @param	RowData	- Pointer to memory location where read 32-bit row data
@@ -4894,6 +4921,47 @@ END:
  *
  ******************************************************************************/
 static int XNvm_EfuseReadCache(u32 Row, u32* RowData)
+{
+	volatile int Status = XST_FAILURE;
+
+	if (Row > (XNVM_EFUSE_TOTAL_NUM_OF_ROWS - 1U)) {
+		Status = (int)XNVM_EFUSE_ERR_INVALID_PARAM;
+		goto END;
+	}
+	if (RowData == NULL) {
+		Status = (int)XNVM_EFUSE_ERR_INVALID_PARAM;
+		goto END;
+	}
+
+	if (EfuseShadowValid != XNVM_EFUSE_SHADOW_VALID) {
+		Status = XNvm_EfuseLoadShadow();
+		if (Status != XST_SUCCESS) {
+			Status = XST_FAILURE;
+			Status = XNvm_EfuseReadCacheRow(Row, RowData);
+			goto END;
+		}
+	}
+	*RowData = EfuseShadow[Row];
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/******************************************************************************/
+/**
+ * @brief	This function reads 32-bit data directly from eFUSE cache
+ *		specified by Row.
+ *
+ * @param	Row 	- Starting Row number (0-based addressing).
+ * @param	RowData	- Pointer to memory location where read 32-bit row data
+ *					  is to be stored.
+ *
+ * @return	- XST_SUCCESS - Specified data read.
+ *		- XNVM_EFUSE_ERR_CACHE_PARITY - Parity Error exist in cache.
+ *
+ ******************************************************************************/
+static int XNvm_EfuseReadCacheRow(u32 Row, u32* RowData)
 {
 	int Status = XST_FAILURE;
 	u32 CacheData;
@@ -4923,6 +4991,53 @@ END:
 	return Status;
 }
 
+/******************************************************************************/
+/**
+ * @brief	This function copies the complete eFUSE cache into the shadow
+ *		copy and marks the shadow copy as valid.
+ *
+ * @return	- XST_SUCCESS - Shadow copy of eFUSE cache is filled.
+ *		- XNVM_EFUSE_ERR_CACHE_PARITY - Parity Error exist in cache.
+ *
+ ******************************************************************************/
+static int XNvm_EfuseLoadShadow(void)
+{
+	int Status = XST_FAILURE;
+	u32 IsrStatus;
+	volatile u32 Row;
+
+	for (Row = 0U; Row < XNVM_EFUSE_TOTAL_NUM_OF_ROWS; Row++) {
+		EfuseShadow[Row] = Xil_In32(XNVM_EFUSE_CACHE_BASEADDR +
+					(Row * sizeof(u32)));
+	}
+
+	IsrStatus = XNvm_EfuseReadReg(XNVM_EFUSE_CTRL_BASEADDR,
+					XNVM_EFUSE_ISR_REG_OFFSET);
+	/* Row is volatile, so a glitch that ends the copy early is caught */
+	if ((Row != XNVM_EFUSE_TOTAL_NUM_OF_ROWS) ||
+		((IsrStatus & XNVM_EFUSE_ISR_CACHE_ERROR)
+			== XNVM_EFUSE_ISR_CACHE_ERROR)) {
+		Status = (int)XNVM_EFUSE_ERR_CACHE_PARITY;
+		goto END;
+	}
+	EfuseShadowValid = XNVM_EFUSE_SHADOW_VALID;
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/******************************************************************************/
+/**
+ * @brief	This function invalidates the shadow copy of eFUSE cache so
+ *		that the next cache read refills it.
+ *
+ ******************************************************************************/
+static inline void XNvm_EfuseInvalidateShadow(void)
+{
+	EfuseShadowValid = 0U;
+}
+
 /******************************************************************************/
 /**
  * @brief	This function reads 32-bit rows from eFUSE cache.
@@ -5027,20 +5142,21 @@ END:
 
 /******************************************************************************/
 /**
- * @brief	This function verify the specified bit set in the eFUSE.
+ * @brief	This function verifies that all bits in Mask are set in the
+ *		specified eFUSE row.
  *
  * @param	Page - It is an enum variable of type XNvm_EfuseType.
- * @param	Row - It is an 32-bit Row number (0-based addressing).
- * @param	Col - It is an 32-bit Col number (0-based addressing).
+ * @param	Row  - It is an 32-bit Row number (0-based addressing).
+ * @param	Mask - Bitmap of the bits to be verified in the row.
  *
- * @return	- XST_SUCCESS - Specified bit set in eFUSE.
- *		- XNVM_EFUSE_ERR_PGM_VERIFY  - Verification failed, specified bit
- *						   is not set.
+ * @return	- XST_SUCCESS - Specified bits set in eFUSE.
+ *		- XNVM_EFUSE_ERR_PGM_VERIFY  - Verification failed, specified bits
+ *						   are not set.
  *		- XNVM_EFUSE_ERR_PGM_TIMEOUT - If Programming timeout has occured.
  *		- XST_FAILURE                - Unexpected error.
  *
  ******************************************************************************/
-static int XNvm_EfuseVerifyBit(XNvm_EfuseType Page, u32 Row, u32 Col)
+static int XNvm_EfuseVerifyRow(XNvm_EfuseType Page, u32 Row, u32 Mask)
 {
 	int Status = XST_FAILURE;
 	u32 RdAddr;
@@ -5077,7 +5193,7 @@ static int XNvm_EfuseVerifyBit(XNvm_EfuseType Page, u32 Row, u32 Col)
 					== XNVM_EFUSE_ISR_RD_DONE) {
 		RegData = XNvm_EfuseReadReg(XNVM_EFUSE_CTRL_BASEADDR,
 					XNVM_EFUSE_RD_DATA_REG_OFFSET);
-		if ((RegData & (((u32)0x01U) << Col)) != 0U) {
+		if ((RegData & Mask) == Mask) {
 			Status = XST_SUCCESS;
 		}
 		else {
@@ -5093,6 +5209,26 @@ END:
 	return Status;
 }
 
+/******************************************************************************/
+/**
+ * @brief	This function verify the specified bit set in the eFUSE.
+ *
+ * @param	Page - It is an enum variable of type XNvm_EfuseType.
+ * @param	Row - It is an 32-bit Row number (0-based addressing).
+ * @param	Col - It is an 32-bit Col number (0-based addressing).
+ *
+ * @return	- XST_SUCCESS - Specified bit set in eFUSE.
+ *		- XNVM_EFUSE_ERR_PGM_VERIFY  - Verification failed, specified bit
+ *						   is not set.
+ *		- XNVM_EFUSE_ERR_PGM_TIMEOUT - If Programming timeout has occured.
+ *		- XST_FAILURE                - Unexpected error.
+ *
+ ******************************************************************************/
+static int XNvm_EfuseVerifyBit(XNvm_EfuseType Page, u32 Row, u32 Col)
+{
+	return XNvm_EfuseVerifyRow(Page, Row, ((u32)0x01U) << Col);
+}
+
 /******************************************************************************/
 /**
  * @brief	This function sets and then verifies the specified
@@ -5387,6 +5523,8 @@ static int XNvm_EfuseCacheLoad(void)
 	u32 RegStatus;
 	volatile u32 CacheStatus;
 
+	XNvm_EfuseInvalidateShadow();
+
 	RegStatus = XNvm_EfuseReadReg(XNVM_EFUSE_CTRL_BASEADDR,
 					XNVM_EFUSE_WR_LOCK_REG_OFFSET);
 	/* Check the unlock status */
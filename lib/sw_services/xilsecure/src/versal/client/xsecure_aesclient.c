@@ -27,6 +27,8 @@
 *                     user
 *       am   03/08/22 Fixed MISRA C violations
 *       kpt  03/16/22 Removed IPI related code and added mailbox support
+* 4.8   agt  10/17/26 Added XSecure_AesEncryptStream and
+*                     XSecure_AesDecryptStream
 *
 * </pre>
 * @note
@@ -737,3 +739,125 @@ int XSecure_AesDecryptData(XSecure_ClientInstance *InstancePtr, XSecure_AesKeySo
 END:
 	return Status;
 }
+
+/*****************************************************************************/
+/**
+ * @brief	This function sends IPI request to encrypt a chunk of data of any
+ * 		size on the AES engine. The data is transferred by the server
+ * 		in pieces of XSECURE_AES_STREAM_CHUNK_SIZE bytes and the input
+ * 		and output buffers may be the same.
+ *
+ * @param	InstancePtr	Pointer to the client instance
+ * @param	InDataAddr	Address of the input data which needs to be
+ * 				encrypted
+ * @param	OutDataAddr	Address of the buffer where the encrypted data
+ * 				to be updated
+ * @param	Size		Size of the input data
+ * @param	IsLast		If this is the last chunk of data, this parameter
+ * 				should be set to TRUE otherwise FALSE
+ *
+ * @return
+ *	-	XST_SUCCESS - On successful encryption of the data
+ *	-	XSECURE_AES_INVALID_PARAM - On invalid parameter
+ *	-	XSECURE_AES_STATE_MISMATCH_ERROR - If there is state mismatch
+ *	-	XST_FAILURE - On failure
+ *
+ *****************************************************************************/
+int XSecure_AesEncryptStream(XSecure_ClientInstance *InstancePtr, u64 InDataAddr,
+	u64 OutDataAddr, u64 Size, u32 IsLast)
+{
+	volatile int Status = XST_FAILURE;
+	XSecure_AesStreamParams *StreamParams = NULL;
+	u64 SrcAddr;
+	u32 MemSize;
+	u32 Payload[XSECURE_PAYLOAD_LEN_3U];
+
+	if ((InstancePtr == NULL) || (InstancePtr->MailboxPtr == NULL)) {
+		goto END;
+	}
+
+	MemSize = XMailbox_GetSharedMem(InstancePtr->MailboxPtr, (u64**)(UINTPTR)&StreamParams);
+
+	if ((StreamParams == NULL) || (MemSize < sizeof(XSecure_AesStreamParams))) {
+		goto END;
+	}
+
+	StreamParams->InDataAddr = InDataAddr;
+	StreamParams->OutDataAddr = OutDataAddr;
+	StreamParams->Size = Size;
+	StreamParams->IsLast = IsLast;
+	SrcAddr = (u64)(UINTPTR)StreamParams;
+
+	XSecure_DCacheFlushRange(StreamParams, sizeof(XSecure_AesStreamParams));
+
+	/* Fill IPI Payload */
+	Payload[0U] = HEADER(0U, XSECURE_API_AES_ENCRYPT_STREAM);
+	Payload[1U] = (u32)SrcAddr;
+	Payload[2U] = (u32)(SrcAddr >> 32U);
+
+	Status = XSecure_ProcessMailbox(InstancePtr->MailboxPtr, Payload, sizeof(Payload)/sizeof(u32));
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function sends IPI request to decrypt a chunk of data of any
+ * 		size on the AES engine. The data is transferred by the server
+ * 		in pieces of XSECURE_AES_STREAM_CHUNK_SIZE bytes and the input
+ * 		and output buffers may be the same.
+ *
+ * @param	InstancePtr	Pointer to the client instance
+ * @param	InDataAddr	Address of the input data which needs to be
+ * 				decrypted
+ * @param	OutDataAddr	Address of the buffer where the decrypted data
+ * 				to be updated
+ * @param	Size		Size of the input data
+ * @param	IsLast		If this is the last chunk of data, this parameter
+ * 				should be set to TRUE otherwise FALSE
+ *
+ * @return
+ *	-	XST_SUCCESS - On successful decryption of the data
+ *	-	XSECURE_AES_INVALID_PARAM - On invalid parameter
+ *	-	XSECURE_AES_STATE_MISMATCH_ERROR - If there is state mismatch
+ *	-	XST_FAILURE - On failure
+ *
+ *****************************************************************************/
+int XSecure_AesDecryptStream(XSecure_ClientInstance *InstancePtr, u64 InDataAddr,
+	u64 OutDataAddr, u64 Size, u32 IsLast)
+{
+	volatile int Status = XST_FAILURE;
+	XSecure_AesStreamParams *StreamParams = NULL;
+	u64 SrcAddr;
+	u32 MemSize;
+	u32 Payload[XSECURE_PAYLOAD_LEN_3U];
+
+	if ((InstancePtr == NULL) || (InstancePtr->MailboxPtr == NULL)) {
+		goto END;
+	}
+
+	MemSize = XMailbox_GetSharedMem(InstancePtr->MailboxPtr, (u64**)(UINTPTR)&StreamParams);
+
+	if ((StreamParams == NULL) || (MemSize < sizeof(XSecure_AesStreamParams))) {
+		goto END;
+	}
+
+	StreamParams->InDataAddr = InDataAddr;
+	StreamParams->OutDataAddr = OutDataAddr;
+	StreamParams->Size = Size;
+	StreamParams->IsLast = IsLast;
+	SrcAddr = (u64)(UINTPTR)StreamParams;
+
+	XSecure_DCacheFlushRange(StreamParams, sizeof(XSecure_AesStreamParams));
+
+	/* Fill IPI Payload */
+	Payload[0U] = HEADER(0U, XSECURE_API_AES_DECRYPT_STREAM);
+	Payload[1U] = (u32)SrcAddr;
+	Payload[2U] = (u32)(SrcAddr >> 32U);
+
+	Status = XSecure_ProcessMailbox(InstancePtr->MailboxPtr, Payload, sizeof(Payload)/sizeof(u32));
+
+END:
+	return Status;
+}
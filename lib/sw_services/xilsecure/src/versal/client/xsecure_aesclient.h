@@ -21,6 +21,8 @@
 * 4.5   kal  03/23/20 Updated file version to sync with library version
 *       har  04/14/21 Added XSecure_AesEncryptData and XSecure_AesDecryptData
 *       kpt  03/16/22 Removed IPI related code and added mailbox support
+* 4.8   agt  10/17/26 Added XSecure_AesEncryptStream and
+*                     XSecure_AesDecryptStream
 *
 * </pre>
 * @note
@@ -99,6 +101,10 @@ int XSecure_AesEncryptData(XSecure_ClientInstance *InstancePtr, XSecure_AesKeySo
 	u64 InDataAddr, u64 OutDataAddr, u32 Size, u64 GcmTagAddr);
 int XSecure_AesDecryptData(XSecure_ClientInstance *InstancePtr, XSecure_AesKeySource KeySrc, u32 KeySize, u64 IvAddr,
 	u64 InDataAddr, u64 OutDataAddr, u32 Size, u64 GcmTagAddr);
+int XSecure_AesEncryptStream(XSecure_ClientInstance *InstancePtr, u64 InDataAddr,
+	u64 OutDataAddr, u64 Size, u32 IsLast);
+int XSecure_AesDecryptStream(XSecure_ClientInstance *InstancePtr, u64 InDataAddr,
+	u64 OutDataAddr, u64 Size, u32 IsLast);
 
 #ifdef __cplusplus
 }
@@ -25,6 +25,7 @@
 *                     user
 *       am   03/08/22 Fixed MISRA C violations
 *       kpt  03/16/22 Removed IPI related code and added mailbox support
+* 4.8   agt  10/17/26 Added XSecure_EllipticVerifySignBatch
 *
 * </pre>
 * @note
@@ -285,3 +286,69 @@ int XSecure_EllipticKat(XSecure_ClientInstance *InstancePtr, u32 CurveType)
 END:
 	return Status;
 }
+
+/*****************************************************************************/
+/**
+ *
+ * @brief	This function sends IPI request to verify a batch of signatures
+ *		made with the same public key and curve type
+ *
+ * @param	InstancePtr	Pointer to the client instance
+ * @param	CurveType	- Type of elliptic curve
+ * @param	Size		- Length of the hash in bytes
+ * @param	PubKeyAddr	- Address of the public key
+ * @param	Req		- Pointer to an array of requests, each holding
+ *				the address of a hash and of its signature
+ * @param	NumReq		- Number of requests in the array, up to 8
+ *
+ * @return
+ *	-	XST_SUCCESS - When all the signatures are verified successfully
+ *	-	XSECURE_ELLIPTIC_INVALID_PARAM - On invalid argument
+ *	-	Status of the first request which failed verification. Refer
+ *		XSecure_EllipticVerifySign for the list of error codes
+ *	-	XST_FAILURE - On failure
+ *
+ * @note	The server updates Status of each request in the array. The
+ *		array shall be invalidated from the cache before reading it.
+ *
+ *****************************************************************************/
+int XSecure_EllipticVerifySignBatch(XSecure_ClientInstance *InstancePtr, u32 CurveType, u32 Size,
+			u64 PubKeyAddr, XSecure_EllipticVerifyBatchReq *Req, u32 NumReq)
+{
+	volatile int Status = XST_FAILURE;
+	XSecure_EllipticVerifyBatchParams *EcdsaParams = NULL;
+	u64 Buffer;
+	u32 MemSize;
+	u32 Payload[XSECURE_PAYLOAD_LEN_3U];
+
+	if ((InstancePtr == NULL) || (InstancePtr->MailboxPtr == NULL) ||
+		(Req == NULL) || (NumReq == 0U)) {
+		goto END;
+	}
+
+	MemSize = XMailbox_GetSharedMem(InstancePtr->MailboxPtr, (u64**)(UINTPTR)&EcdsaParams);
+
+	if ((EcdsaParams == NULL) || (MemSize < sizeof(XSecure_EllipticVerifyBatchParams))) {
+		goto END;
+	}
+
+	EcdsaParams->CurveType = CurveType;
+	EcdsaParams->Size = Size;
+	EcdsaParams->PubKeyAddr = PubKeyAddr;
+	EcdsaParams->ReqAddr = (u64)(UINTPTR)Req;
+	EcdsaParams->NumReq = NumReq;
+	Buffer = (u64)(UINTPTR)EcdsaParams;
+
+	XSecure_DCacheFlushRange(EcdsaParams, sizeof(XSecure_EllipticVerifyBatchParams));
+	XSecure_DCacheFlushRange(Req, NumReq * sizeof(XSecure_EllipticVerifyBatchReq));
+
+	/* Fill IPI Payload */
+	Payload[0U] = HEADER(0U, XSECURE_API_ELLIPTIC_VERIFY_SIGN_BATCH);
+	Payload[1U] = (u32)Buffer;
+	Payload[2U] = (u32)(Buffer >> 32);
+
+	Status = XSecure_ProcessMailbox(InstancePtr->MailboxPtr, Payload, sizeof(Payload)/sizeof(u32));
+
+END:
+	return Status;
+}
@@ -20,6 +20,7 @@
 * 1.0   kal  03/23/21 Initial release
 * 4.5   kal  03/23/20 Updated file version to sync with library version
 *       kpt  03/16/22 Removed IPI related code and added mailbox support
+* 4.8   agt  10/17/26 Added XSecure_EllipticVerifySignBatch
 *
 * </pre>
 * @note
@@ -52,6 +53,8 @@ int XSecure_EllipticValidateKey(XSecure_ClientInstance *InstancePtr, u32 CurveTy
 int XSecure_EllipticVerifySign(XSecure_ClientInstance *InstancePtr, u32 CurveType, u64 HashAddr, u32 Size,
                         u64 PubKeyAddr, u64 SignAddr);
 int XSecure_EllipticKat(XSecure_ClientInstance *InstancePtr, u32 CurveType);
+int XSecure_EllipticVerifySignBatch(XSecure_ClientInstance *InstancePtr, u32 CurveType, u32 Size,
+			u64 PubKeyAddr, XSecure_EllipticVerifyBatchReq *Req, u32 NumReq);
 
 #ifdef __cplusplus
 }
@@ -19,6 +19,9 @@
 * 4.5   kal  03/23/20 Updated file version to sync with library version
 * 4.6   har  07/14/21 Fixed doxygen warnings
 * 4.7   kpt  11/29/21 Added macro XSecure_DCacheFlushRange
+* 4.8   agt  10/17/26 Added AES stream API IDs and XSecure_AesStreamParams
+*       agt  10/17/26 Added batched ECDSA signature verification API ID and
+*                     parameter structures
 *
 * </pre>
 * @note
@@ -103,6 +106,21 @@ typedef struct {
 	u32 Size;		/**< Length of hash */
 } XSecure_EllipticSignVerifyParams;
 
+typedef struct {
+	u64 HashAddr;	/**< Hash address */
+	u64 SignAddr;	/**< Signature Address */
+	u32 Status;	/**< Verification status, updated by the server */
+	u32 Reserved;	/**< Keeps the array layout same for client and server */
+} XSecure_EllipticVerifyBatchReq;
+
+typedef struct {
+	u64 PubKeyAddr;	/**< Public key Address */
+	u64 ReqAddr;	/**< Address of XSecure_EllipticVerifyBatchReq array */
+	u32 CurveType;	/**< ECC curve type */
+	u32 Size;		/**< Length of hash */
+	u32 NumReq;	/**< Number of requests in the array */
+} XSecure_EllipticVerifyBatchParams;
+
 typedef struct {
 	u64 IvAddr;	/**< IV address */
 	u32 OperationId;/**< Operation type - Encrypt or decrypt */
@@ -116,6 +134,13 @@ typedef struct {
 	u32 IsLast;	/**< Flag to indicate last update of data*/
 } XSecure_AesInParams;
 
+typedef struct {
+	u64 InDataAddr;	/**< Address of input data*/
+	u64 OutDataAddr;	/**< Address of output data*/
+	u64 Size;	/**< Length of input data*/
+	u32 IsLast;	/**< Flag to indicate last chunk of data*/
+} XSecure_AesStreamParams;
+
 typedef enum {
 	XSECURE_ENCRYPT,	/**< Encrypt operation */
 	XSECURE_DECRYPT,	/**< Decrypt operation */
@@ -135,6 +160,7 @@ typedef enum {
 	XSECURE_API_ELLIPTIC_VALIDATE_KEY,	/**< 66U */
 	XSECURE_API_ELLIPTIC_VERIFY_SIGN,	/**< 67U */
 	XSECURE_API_ELLIPTIC_KAT,		/**< 68U */
+	XSECURE_API_ELLIPTIC_VERIFY_SIGN_BATCH,	/**< 69U */
 	XSECURE_API_AES_INIT = 96U,		/**< 96U */
 	XSECURE_API_AES_OP_INIT,		/**< 97U */
 	XSECURE_API_AES_UPDATE_AAD,		/**< 98U */
@@ -149,7 +175,9 @@ typedef enum {
 	XSECURE_API_AES_SET_DPA_CM,		/**< 107U */
 	XSECURE_API_AES_DECRYPT_KAT,		/**< 108U */
 	XSECURE_API_AES_DECRYPT_CM_KAT,		/**< 109U */
-	XSECURE_API_MAX,			/**< 110U */
+	XSECURE_API_AES_ENCRYPT_STREAM,		/**< 110U */
+	XSECURE_API_AES_DECRYPT_STREAM,		/**< 111U */
+	XSECURE_API_MAX,			/**< 112U */
 } XSecure_ApiId;
 
 #ifdef __cplusplus
@@ -72,6 +72,9 @@
 *       har  01/20/2022 Added glitch checks for clearing keys in
 *                       XSecure_AesWriteKey()
 *       har  02/16/2022 Updated Status with ClearStatus only in case of success
+* 4.8   agt  10/17/2026 Added XSecure_AesEncryptStream and
+*                       XSecure_AesDecryptStream for large and in-place
+*                       buffers
 *
 * </pre>
 *
@@ -195,6 +198,11 @@ static int XSecure_AesOpInit(const XSecure_Aes *InstancePtr,
 	XSecure_AesKeySrc KeySrc, XSecure_AesKeySize KeySize, u64 IvAddr);
 static int XSecure_AesPmcDmaCfgAndXfer(const XSecure_Aes *InstancePtr,
 	XSecure_AesDmaCfg AesDmaCfg, u32 Size);
+static int XSecure_AesStreamXfer(XSecure_Aes *InstancePtr, u64 InDataAddr,
+	u64 OutDataAddr, u64 Size, u8 IsLastChunk);
+static int XSecure_AesPmcDmaWaitAndAck(const XSecure_Aes *InstancePtr,
+	XPmcDma_Channel Channel);
+static void XSecure_AesStreamReset(XSecure_Aes *InstancePtr);
 
 /************************** Variable Definitions *****************************/
 static const XSecure_AesKeyLookup AesKeyLookupTbl [XSECURE_MAX_KEY_SOURCES] =
@@ -1337,6 +1345,111 @@ END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function encrypts the data of any size up to the 64-bit
+ *		address range. Data is transferred in chunks of
+ *		XSECURE_AES_STREAM_CHUNK_SIZE and the source DMA of the next
+ *		chunk is started as soon as the source DMA of the current chunk
+ *		is done, so both PMC DMA channels stay busy till the end of the
+ *		data. InDataAddr and OutDataAddr can be same for in-place
+ *		encryption.
+ *
+ * @param	InstancePtr	Pointer to the XSecure_Aes instance
+ * @param	InDataAddr	Address of the data which needs to be encrypted
+ * @param	OutDataAddr	Address of output buffer where the encrypted data
+ *				  to be updated
+ * @param	Size		Size of data to be encrypted in bytes, whereas
+ *				  number of bytes provided should be multiples of 4
+ * @param	IsLastChunk	If this is the last update of data to be encrypted,
+ *				  this parameter should be set to TRUE otherwise FALSE
+ *
+ * @return
+ *	-	XST_SUCCESS - On successful encryption of the data
+ *	-	XSECURE_AES_INVALID_PARAM - On invalid parameter
+ *	-	XSECURE_AES_STATE_MISMATCH_ERROR - If State mismatch is occurred
+ *	-	XST_FAILURE - On failure
+ *
+ ******************************************************************************/
+int XSecure_AesEncryptStream(XSecure_Aes *InstancePtr, u64 InDataAddr,
+	u64 OutDataAddr, u64 Size, u8 IsLastChunk)
+{
+	int Status = XST_FAILURE;
+
+	/* Validate the input arguments */
+	if (InstancePtr == NULL) {
+		Status = (int)XSECURE_AES_INVALID_PARAM;
+		goto END;
+	}
+
+	if (InstancePtr->AesState != XSECURE_AES_ENCRYPT_INITIALIZED) {
+		Status = (int)XSECURE_AES_STATE_MISMATCH_ERROR;
+		if (InstancePtr->AesState != XSECURE_AES_UNINITIALIZED) {
+			XSecure_AesStreamReset(InstancePtr);
+		}
+		goto END;
+	}
+
+	Status = XSecure_AesStreamXfer(InstancePtr, InDataAddr, OutDataAddr,
+		Size, IsLastChunk);
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function decrypts the data of any size up to the 64-bit
+ *		address range. Data is transferred in chunks of
+ *		XSECURE_AES_STREAM_CHUNK_SIZE and the source DMA of the next
+ *		chunk is started as soon as the source DMA of the current chunk
+ *		is done, so both PMC DMA channels stay busy till the end of the
+ *		data. InDataAddr and OutDataAddr can be same for in-place
+ *		decryption.
+ *
+ * @param	InstancePtr	Pointer to the XSecure_Aes instance
+ * @param	InDataAddr	Address of the encrypted data which needs to be
+ *				  decrypted
+ * @param	OutDataAddr	Address of output buffer where the decrypted data
+ *				  to be updated
+ * @param	Size		Size of data to be decrypted in bytes, whereas
+ *				  number of bytes provided should be multiples of 4
+ * @param	IsLastChunk	If this is the last update of data to be decrypted,
+ *				  this parameter should be set to TRUE otherwise FALSE
+ *
+ * @return
+ *	-	XST_SUCCESS - On successful decryption of the data
+ *	-	XSECURE_AES_INVALID_PARAM - On invalid parameter
+ *	-	XSECURE_AES_STATE_MISMATCH_ERROR - If State mismatch is occurred
+ *	-	XST_FAILURE - On failure
+ *
+ ******************************************************************************/
+int XSecure_AesDecryptStream(XSecure_Aes *InstancePtr, u64 InDataAddr,
+	u64 OutDataAddr, u64 Size, u8 IsLastChunk)
+{
+	int Status = XST_FAILURE;
+
+	/* Validate the input arguments */
+	if (InstancePtr == NULL) {
+		Status = (int)XSECURE_AES_INVALID_PARAM;
+		goto END;
+	}
+
+	if (InstancePtr->AesState != XSECURE_AES_DECRYPT_INITIALIZED) {
+		Status = (int)XSECURE_AES_STATE_MISMATCH_ERROR;
+		if (InstancePtr->AesState != XSECURE_AES_UNINITIALIZED) {
+			XSecure_AesStreamReset(InstancePtr);
+		}
+		goto END;
+	}
+
+	Status = XSecure_AesStreamXfer(InstancePtr, InDataAddr, OutDataAddr,
+		Size, IsLastChunk);
+
+END:
+	return Status;
+}
+
 /*****************************************************************************/
 /**
  * @brief	This function updates the GCM tag for the encrypted data
@@ -2319,3 +2432,184 @@ static int XSecure_AesPmcDmaCfgAndXfer(const XSecure_Aes *InstancePtr,
 END:
 	return Status;
 }
+
+/*****************************************************************************/
+/**
+ *
+ * @brief	This function waits for the PMC DMA channel to be done and
+ *		acknowledges the completion
+ *
+ * @param	InstancePtr	Pointer to the XSecure_Aes instance
+ * @param	Channel		PMC DMA channel
+ *
+ * @return
+ *	-	XST_SUCCESS - If the DMA transfer is done
+ *	-	Error code on timeout
+ *
+ ******************************************************************************/
+static int XSecure_AesPmcDmaWaitAndAck(const XSecure_Aes *InstancePtr,
+	XPmcDma_Channel Channel)
+{
+	int Status = XST_FAILURE;
+
+	Status = XPmcDma_WaitForDoneTimeout(InstancePtr->PmcDmaPtr, Channel);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	/* Acknowledge the transfer has completed */
+	XPmcDma_IntrClear(InstancePtr->PmcDmaPtr, Channel,
+		XPMCDMA_IXR_DONE_MASK);
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * @brief	This function transfers the data through AES engine in chunks.
+ *		SSS and PMC DMA endianness are configured once for all chunks.
+ *		The source transfer of a chunk is issued while the destination
+ *		transfer of the previous chunk is in progress. As destination
+ *		always lags behind source, in-place operation is safe.
+ *
+ * @param	InstancePtr	Pointer to the XSecure_Aes instance
+ * @param	InDataAddr	Address of the input data
+ * @param	OutDataAddr	Address of the output buffer
+ * @param	Size		Size of data in bytes
+ * @param	IsLastChunk	TRUE if this is the last update of data
+ *
+ * @return
+ *	-	XST_SUCCESS - On successful transfer of all the chunks
+ *	-	XSECURE_AES_INVALID_PARAM - On invalid parameter
+ *	-	Error code on failure
+ *
+ ******************************************************************************/
+static int XSecure_AesStreamXfer(XSecure_Aes *InstancePtr, u64 InDataAddr,
+	u64 OutDataAddr, u64 Size, u8 IsLastChunk)
+{
+	int Status = XST_FAILURE;
+	u64 SrcOffset = 0U;
+	u64 DstOffset = 0U;
+	u32 SrcLen;
+	u32 DstLen;
+	u8 IsLastSrc;
+
+	if (((IsLastChunk != TRUE) && (IsLastChunk != FALSE)) ||
+		((Size % XSECURE_WORD_SIZE) != 0x00U) || (Size == 0x00U)) {
+		Status = (int)XSECURE_AES_INVALID_PARAM;
+		goto END_RST;
+	}
+
+	/* Configure the SSS for AES. */
+	if (InstancePtr->PmcDmaPtr->Config.DeviceId == (u16)PMCDMA_0_DEVICE_ID) {
+		Status = XSecure_SssAes(&InstancePtr->SssInstance,
+				XSECURE_SSS_DMA0, XSECURE_SSS_DMA0);
+	}
+	else {
+		Status = XSecure_SssAes(&InstancePtr->SssInstance,
+				XSECURE_SSS_DMA1, XSECURE_SSS_DMA1);
+	}
+	if (Status != XST_SUCCESS) {
+		goto END_RST;
+	}
+
+	XSecure_AesPmcDmaCfgEndianness(InstancePtr->PmcDmaPtr,
+		XPMCDMA_SRC_CHANNEL, XSECURE_ENABLE_BYTE_SWAP);
+	XSecure_AesPmcDmaCfgEndianness(InstancePtr->PmcDmaPtr,
+		XPMCDMA_DST_CHANNEL, XSECURE_ENABLE_BYTE_SWAP);
+
+	/* Prime the destination and source channels with the first chunk */
+	DstLen = (Size > XSECURE_AES_STREAM_CHUNK_SIZE) ?
+		XSECURE_AES_STREAM_CHUNK_SIZE : (u32)Size;
+	SrcLen = DstLen;
+	IsLastSrc = ((SrcLen == Size) && (IsLastChunk == TRUE)) ?
+		TRUE : FALSE;
+	XPmcDma_64BitTransfer(InstancePtr->PmcDmaPtr, XPMCDMA_DST_CHANNEL,
+		(u32)OutDataAddr, (u32)(OutDataAddr >> 32U),
+		DstLen / XSECURE_WORD_SIZE, FALSE);
+	XPmcDma_64BitTransfer(InstancePtr->PmcDmaPtr, XPMCDMA_SRC_CHANNEL,
+		(u32)InDataAddr, (u32)(InDataAddr >> 32U),
+		SrcLen / XSECURE_WORD_SIZE, IsLastSrc);
+	SrcOffset = SrcLen;
+
+	while (DstOffset < Size) {
+		Status = XST_FAILURE;
+		if (SrcLen != 0U) {
+			Status = XSecure_AesPmcDmaWaitAndAck(InstancePtr,
+				XPMCDMA_SRC_CHANNEL);
+			if (Status != XST_SUCCESS) {
+				goto END_RST;
+			}
+		}
+
+		/* Keep the source channel busy with the next chunk */
+		SrcLen = 0U;
+		if (SrcOffset < Size) {
+			SrcLen = ((Size - SrcOffset) > XSECURE_AES_STREAM_CHUNK_SIZE) ?
+				XSECURE_AES_STREAM_CHUNK_SIZE : (u32)(Size - SrcOffset);
+			IsLastSrc = (((SrcOffset + SrcLen) == Size) &&
+				(IsLastChunk == TRUE)) ? TRUE : FALSE;
+			XPmcDma_64BitTransfer(InstancePtr->PmcDmaPtr,
+				XPMCDMA_SRC_CHANNEL, (u32)(InDataAddr + SrcOffset),
+				(u32)((InDataAddr + SrcOffset) >> 32U),
+				SrcLen / XSECURE_WORD_SIZE, IsLastSrc);
+		}
+
+		Status = XST_FAILURE;
+		Status = XSecure_AesPmcDmaWaitAndAck(InstancePtr,
+			XPMCDMA_DST_CHANNEL);
+		if (Status != XST_SUCCESS) {
+			goto END_RST;
+		}
+		DstOffset += DstLen;
+
+		if (SrcLen != 0U) {
+			DstLen = SrcLen;
+			XPmcDma_64BitTransfer(InstancePtr->PmcDmaPtr,
+				XPMCDMA_DST_CHANNEL, (u32)(OutDataAddr + DstOffset),
+				(u32)((OutDataAddr + DstOffset) >> 32U),
+				DstLen / XSECURE_WORD_SIZE, FALSE);
+			SrcOffset += SrcLen;
+		}
+	}
+
+END_RST:
+	if (Status != XST_SUCCESS) {
+		XSecure_AesStreamReset(InstancePtr);
+	}
+	else {
+		/* Clear endianness */
+		XSecure_AesPmcDmaCfgEndianness(InstancePtr->PmcDmaPtr,
+				XPMCDMA_SRC_CHANNEL, XSECURE_DISABLE_BYTE_SWAP);
+		XSecure_AesPmcDmaCfgEndianness(InstancePtr->PmcDmaPtr,
+				XPMCDMA_DST_CHANNEL, XSECURE_DISABLE_BYTE_SWAP);
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * @brief	This function clears the PMC DMA endianness, issues a soft reset
+ *		to AES engine and sets the AES state back to initialization
+ *		state, after a failed or out of sequence AES stream request
+ *
+ * @param	InstancePtr	Pointer to the XSecure_Aes instance
+ *
+ ******************************************************************************/
+static void XSecure_AesStreamReset(XSecure_Aes *InstancePtr)
+{
+	/* Clear endianness */
+	XSecure_AesPmcDmaCfgEndianness(InstancePtr->PmcDmaPtr,
+				XPMCDMA_SRC_CHANNEL, XSECURE_DISABLE_BYTE_SWAP);
+	XSecure_AesPmcDmaCfgEndianness(InstancePtr->PmcDmaPtr,
+				XPMCDMA_DST_CHANNEL, XSECURE_DISABLE_BYTE_SWAP);
+
+	InstancePtr->NextBlkLen = 0U;
+	InstancePtr->AesState = XSECURE_AES_INITIALIZED;
+	XSecure_SetReset(InstancePtr->BaseAddress,
+		XSECURE_AES_SOFT_RST_OFFSET);
+}
@@ -35,6 +35,7 @@
 *       ana  10/15/2020 Updated doxygen tags
 * 4.5   har  03/02/2021 Added prototype for XSecure_AesUpdateAad
 * 4.6   har  07/14/2021 Fixed doxygen warnings
+* 4.8   agt  10/17/2026 Added prototypes for AES stream APIs
 *
 * </pre>
 *
@@ -80,6 +81,11 @@ extern "C" {
 #define XSECURE_AES_DMA_SIZE				(16U)
 #define XSECURE_AES_DMA_LAST_WORD_ENABLE		(0x1U)
 #define XSECURE_AES_DMA_LAST_WORD_DISABLE		(0x0U)
+#ifndef XSECURE_AES_STREAM_CHUNK_SIZE
+#define XSECURE_AES_STREAM_CHUNK_SIZE			(0x100000U)
+					/**< Size of one DMA transfer of AES
+					  *  stream APIs, multiple of 16 bytes */
+#endif
 /* Key select values */
 #define XSECURE_AES_KEY_SEL_BBRAM_KEY			(0xBBDE6600U)
 #define XSECURE_AES_KEY_SEL_BBRAM_RD_KEY		(0xBBDE8200U)
@@ -197,6 +203,12 @@ int XSecure_AesEncryptFinal(XSecure_Aes *InstancePtr, u64 GcmTagAddr);
 int XSecure_AesEncryptData(XSecure_Aes *InstancePtr, u64 InDataAddr,
 	u64 OutDataAddr, u32 Size, u64 GcmTagAddr);
 
+int XSecure_AesEncryptStream(XSecure_Aes *InstancePtr, u64 InDataAddr,
+	u64 OutDataAddr, u64 Size, u8 IsLastChunk);
+
+int XSecure_AesDecryptStream(XSecure_Aes *InstancePtr, u64 InDataAddr,
+	u64 OutDataAddr, u64 Size, u8 IsLastChunk);
+
 int XSecure_AesDecryptKat(XSecure_Aes *AesInstance);
 
 int XSecure_AesDecryptCmKat(const XSecure_Aes *AesInstance);
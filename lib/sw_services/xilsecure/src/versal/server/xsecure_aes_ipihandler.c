@@ -29,6 +29,7 @@
 *       har   09/14/2021 Added check for DecKeySrc in XSecure_AesKekDecrypt
 * 4.7   am    03/08/2022 Fixed MISRA C violations
 *       kpt   03/18/2022 Replaced XPlmi_Dmaxfr with XPlmi_MemCpy64
+* 4.8   agt   10/17/2026 Added handlers for AES encrypt and decrypt stream
 *
 * </pre>
 *
@@ -73,6 +74,8 @@ static int XSecure_AesDecryptKek(u32 KeyInfo, u32 IvAddrLow, u32 IvAddrHigh);
 static int XSecure_AesSetDpaCmConfig(u8 DpaCmCfg);
 static int XSecure_AesExecuteDecKat(void);
 static int XSecure_AesExecuteDecCmKat(void);
+static int XSecure_AesEncStream(u32 SrcAddrLow, u32 SrcAddrHigh);
+static int XSecure_AesDecStream(u32 SrcAddrLow, u32 SrcAddrHigh);
 
 /*****************************************************************************/
 /**
@@ -133,6 +136,12 @@ int XSecure_AesIpiHandler(XPlmi_Cmd *Cmd)
 	case XSECURE_API(XSECURE_API_AES_DECRYPT_CM_KAT):
 		Status = XSecure_AesExecuteDecCmKat();
 		break;
+	case XSECURE_API(XSECURE_API_AES_ENCRYPT_STREAM):
+		Status = XSecure_AesEncStream(Pload[0], Pload[1]);
+		break;
+	case XSECURE_API(XSECURE_API_AES_DECRYPT_STREAM):
+		Status = XSecure_AesDecStream(Pload[0], Pload[1]);
+		break;
 	default:
 		XSecure_Printf(XSECURE_DEBUG_GENERAL, "CMD: INVALID PARAM\r\n");
 		Status = XST_INVALID_PARAM;
@@ -581,3 +590,71 @@ static int XSecure_AesExecuteDecCmKat(void)
 END:
 	return Status;
 }
+
+/*****************************************************************************/
+/**
+ * @brief       This function handler calls XSecure_AesEncryptStream server API
+ *
+ * @param	SrcAddrLow	- Lower 32 bit address of the
+ * 				XSecure_AesStreamParams structure.
+ * 		SrcAddrHigh	- Higher 32 bit address of the
+ * 				XSecure_AesStreamParams structure.
+ *
+ * @return
+ *	-	XST_SUCCESS - If the encrypt stream is successful
+ *	-	ErrorCode - If there is a failure
+ *
+ ******************************************************************************/
+static int XSecure_AesEncStream(u32 SrcAddrLow, u32 SrcAddrHigh)
+{
+	volatile int Status = XST_FAILURE;
+	u64 Addr = ((u64)SrcAddrHigh << 32U) | (u64)SrcAddrLow;
+	XSecure_AesStreamParams StreamParams;
+	XSecure_Aes *XSecureAesInstPtr = XSecure_GetAesInstance();
+
+	Status = XPlmi_MemCpy64((u64)(UINTPTR)&StreamParams, Addr,
+		sizeof(StreamParams));
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	Status = XSecure_AesEncryptStream(XSecureAesInstPtr,
+		StreamParams.InDataAddr, StreamParams.OutDataAddr,
+		StreamParams.Size, (u8)StreamParams.IsLast);
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief       This function handler calls XSecure_AesDecryptStream server API
+ *
+ * @param	SrcAddrLow	- Lower 32 bit address of the
+ * 				XSecure_AesStreamParams structure.
+ * 		SrcAddrHigh	- Higher 32 bit address of the
+ * 				XSecure_AesStreamParams structure.
+ *
+ * @return
+ *	-	XST_SUCCESS - If the decrypt stream is successful
+ *	-	ErrorCode - If there is a failure
+ *
+ ******************************************************************************/
+static int XSecure_AesDecStream(u32 SrcAddrLow, u32 SrcAddrHigh)
+{
+	volatile int Status = XST_FAILURE;
+	u64 Addr = ((u64)SrcAddrHigh << 32U) | (u64)SrcAddrLow;
+	XSecure_AesStreamParams StreamParams;
+	XSecure_Aes *XSecureAesInstPtr = XSecure_GetAesInstance();
+
+	Status = XPlmi_MemCpy64((u64)(UINTPTR)&StreamParams, Addr,
+		sizeof(StreamParams));
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	Status = XSecure_AesDecryptStream(XSecureAesInstPtr,
+		StreamParams.InDataAddr, StreamParams.OutDataAddr,
+		StreamParams.Size, (u8)StreamParams.IsLast);
+END:
+	return Status;
+}
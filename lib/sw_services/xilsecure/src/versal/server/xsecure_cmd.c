@@ -23,6 +23,8 @@
 *                       XSecure_FeaturesCmd API
 *       rb   08/11/2021 Fix compilation warnings
 * 4.7   am   03/08/2022 Fixed MISRA C violations
+* 4.8   agt  10/17/2026 Added AES encrypt and decrypt stream API IDs
+*       agt  10/17/2026 Added batched ECDSA signature verification API ID
 *
 * </pre>
 *
@@ -93,6 +95,7 @@ static int XSecure_FeaturesCmd(u32 ApiId)
 	case XSECURE_API(XSECURE_API_ELLIPTIC_VALIDATE_KEY):
 	case XSECURE_API(XSECURE_API_ELLIPTIC_VERIFY_SIGN):
 	case XSECURE_API(XSECURE_API_ELLIPTIC_KAT):
+	case XSECURE_API(XSECURE_API_ELLIPTIC_VERIFY_SIGN_BATCH):
 	case XSECURE_API(XSECURE_API_AES_INIT):
 	case XSECURE_API(XSECURE_API_AES_OP_INIT):
 	case XSECURE_API(XSECURE_API_AES_UPDATE_AAD):
@@ -106,6 +109,8 @@ static int XSecure_FeaturesCmd(u32 ApiId)
 	case XSECURE_API(XSECURE_API_AES_SET_DPA_CM):
 	case XSECURE_API(XSECURE_API_AES_DECRYPT_KAT):
 	case XSECURE_API(XSECURE_API_AES_DECRYPT_CM_KAT):
+	case XSECURE_API(XSECURE_API_AES_ENCRYPT_STREAM):
+	case XSECURE_API(XSECURE_API_AES_DECRYPT_STREAM):
 #endif
 		Status = XST_SUCCESS;
 		break;
@@ -148,6 +153,7 @@ static int XSecure_ProcessCmd(XPlmi_Cmd *Cmd)
 	case XSECURE_API(XSECURE_API_ELLIPTIC_VALIDATE_KEY):
 	case XSECURE_API(XSECURE_API_ELLIPTIC_VERIFY_SIGN):
 	case XSECURE_API(XSECURE_API_ELLIPTIC_KAT):
+	case XSECURE_API(XSECURE_API_ELLIPTIC_VERIFY_SIGN_BATCH):
 		Status = XSecure_EllipticIpiHandler(Cmd);
 		break;
 	case XSECURE_API(XSECURE_API_AES_INIT):
@@ -163,6 +169,8 @@ static int XSecure_ProcessCmd(XPlmi_Cmd *Cmd)
 	case XSECURE_API(XSECURE_API_AES_SET_DPA_CM):
 	case XSECURE_API(XSECURE_API_AES_DECRYPT_KAT):
 	case XSECURE_API(XSECURE_API_AES_DECRYPT_CM_KAT):
+	case XSECURE_API(XSECURE_API_AES_ENCRYPT_STREAM):
+	case XSECURE_API(XSECURE_API_AES_DECRYPT_STREAM):
 		Status = XSecure_AesIpiHandler(Cmd);
 		break;
 #endif
@@ -41,6 +41,8 @@
 *                     XSecure_EllipticGenerateKey_64Bit() and
 *                     XSecure_EllipticGenerateSignature_64Bit()
 *       har  02/16/22 Updated Status with ClearStatus only in case of success
+* 4.8   agt  10/17/26 Added XSecure_EllipticVerifySignBatch_64Bit to verify
+*                     several signatures against one public key
 *
 *
 * </pre>
@@ -80,6 +82,9 @@
 static EcdsaCrvInfo* XSecure_EllipticGetCrvData(XSecure_EllipticCrvTyp CrvTyp);
 static void XSecure_PutData(const u32 Size, u8 *Dst, const u64 SrcAddr);
 static void XSecure_GetData(const u32 Size, const u8 *Src, const u64 DstAddr);
+static int XSecure_EllipticVerifyOne(EcdsaCrvInfo *Crv, EcdsaKey *Key,
+	const u32 Size, const u32 OffSet, const XSecure_EllipticHashData *HashInfo,
+	const XSecure_EllipticSignAddr *SignAddr);
 
 /************************** Variable Definitions *****************************/
 
@@ -521,19 +526,11 @@ int XSecure_EllipticVerifySign_64Bit(XSecure_EllipticCrvTyp CrvType,
 	XSecure_EllipticSignAddr *SignAddr)
 {
 	volatile int Status = (int)XSECURE_ELLIPTIC_NON_SUPPORTED_CRV;
-	volatile int VerifyStatus = XST_FAILURE;
-	volatile int VerifyStatusTmp = XST_FAILURE;
 	EcdsaCrvInfo *Crv = NULL;
-	u8 PaddedHash[XSECURE_ECC_P521_SIZE_IN_BYTES] = {0U};
-	volatile u32 HashLenTmp = 0xFFFFFFFFU;
 	u8 PubKey[XSECURE_ECC_P521_SIZE_IN_BYTES +
 	XSECURE_ECDSA_P521_ALIGN_BYTES +
 	XSECURE_ECC_P521_SIZE_IN_BYTES] = {0U};
-	u8 Signature[XSECURE_ECC_P521_SIZE_IN_BYTES +
-	XSECURE_ECDSA_P521_ALIGN_BYTES +
-	XSECURE_ECC_P521_SIZE_IN_BYTES] = {0U};
 	EcdsaKey Key;
-	EcdsaSign Sign;
 	u32 OffSet = 0U;
 	u32 Size = 0U;
 
@@ -548,14 +545,7 @@ int XSecure_EllipticVerifySign_64Bit(XSecure_EllipticCrvTyp CrvType,
 		goto END;
 	}
 
-	HashLenTmp = HashInfo->Len;
-	if ((HashInfo->Len > XSECURE_ECC_P521_SIZE_IN_BYTES) ||
-		(HashLenTmp > XSECURE_ECC_P521_SIZE_IN_BYTES)) {
-		Status = (int)XSECURE_ELLIPTIC_INVALID_PARAM;
-		goto END;
-	}
-
-	/* Store Pub key(Qx,Qy) and Sign(SignR, SignS) to local buffers */
+	/* Store Pub key(Qx,Qy) to local buffer */
 	if (CrvType == XSECURE_ECC_NIST_P521) {
 		Size = XSECURE_ECC_P521_SIZE_IN_BYTES;
 		OffSet = Size + XSECURE_ECDSA_P521_ALIGN_BYTES;
@@ -566,59 +556,16 @@ int XSecure_EllipticVerifySign_64Bit(XSecure_EllipticCrvTyp CrvType,
 	XSecure_PutData(Size, (u8 *)PubKey, KeyAddr->Qx);
 	XSecure_PutData(Size, (u8 *)(PubKey + OffSet), KeyAddr->Qy);
 
-	XSecure_PutData(Size, (u8 *)Signature, SignAddr->SignR);
-	XSecure_PutData(Size, (u8 *)(Signature + OffSet),
-			SignAddr->SignS);
-
-
-	/* Store Hash to local buffer */
-	XSecure_PutData(HashInfo->Len, (u8 *)PaddedHash, HashInfo->Addr);
-
 	Key.Qx = (u8 *)(UINTPTR)PubKey;
 	Key.Qy = (u8 *)(UINTPTR)(PubKey + OffSet);
 
-	Sign.r = (u8 *)(UINTPTR)Signature;
-	Sign.s = (u8 *)(UINTPTR)(Signature + OffSet);
-
 	XSecure_ReleaseReset(XSECURE_ECDSA_RSA_BASEADDR,
 		XSECURE_ECDSA_RSA_RESET_OFFSET);
 
 	Crv = XSecure_EllipticGetCrvData(CrvType);
 	if(Crv != NULL) {
-		XSECURE_TEMPORAL_IMPL(VerifyStatus, VerifyStatusTmp, Ecdsa_VerifySign,
-			Crv, PaddedHash, Crv->Bits, (EcdsaKey *)&Key, (EcdsaSign *)&Sign);
-
-		if ((ELLIPTIC_BAD_SIGN == VerifyStatus) ||
-			(ELLIPTIC_BAD_SIGN == VerifyStatusTmp)) {
-			Status = (int)XSECURE_ELLIPTIC_BAD_SIGN;
-		}
-		else if ((ELLIPTIC_VER_SIGN_INCORRECT_HASH_LEN == VerifyStatus) ||
-			(ELLIPTIC_VER_SIGN_INCORRECT_HASH_LEN == VerifyStatusTmp)) {
-			Status = (int)XSECURE_ELLIPTIC_VER_SIGN_INCORRECT_HASH_LEN;
-		}
-		else if ((ELLIPTIC_VER_SIGN_R_ZERO == VerifyStatus) ||
-			(ELLIPTIC_VER_SIGN_R_ZERO == VerifyStatusTmp)) {
-			Status = (int)XSECURE_ELLIPTIC_VER_SIGN_R_ZERO;
-		}
-		else if ((ELLIPTIC_VER_SIGN_S_ZERO == VerifyStatus) ||
-			(ELLIPTIC_VER_SIGN_S_ZERO == VerifyStatusTmp)) {
-			Status = (int)XSECURE_ELLIPTIC_VER_SIGN_S_ZERO;
-		}
-		else if ((ELLIPTIC_VER_SIGN_R_ORDER_ERROR == VerifyStatus) ||
-			(ELLIPTIC_VER_SIGN_R_ORDER_ERROR == VerifyStatusTmp)) {
-			Status = (int)XSECURE_ELLIPTIC_VER_SIGN_R_ORDER_ERROR;
-		}
-		else if ((ELLIPTIC_VER_SIGN_S_ORDER_ERROR == VerifyStatus) ||
-			(ELLIPTIC_VER_SIGN_S_ORDER_ERROR == VerifyStatusTmp)) {
-			Status = (int)XSECURE_ELLIPTIC_VER_SIGN_S_ORDER_ERROR;
-		}
-		else if ((ELLIPTIC_SUCCESS != VerifyStatus) ||
-			(ELLIPTIC_SUCCESS != VerifyStatusTmp)) {
-			Status = XST_FAILURE;
-		}
-		else {
-			Status = XST_SUCCESS;
-		}
+		Status = XSecure_EllipticVerifyOne(Crv, &Key, Size, OffSet,
+			HashInfo, SignAddr);
 	}
 
 END:
@@ -668,6 +615,117 @@ int XSecure_EllipticVerifySign(XSecure_EllipticCrvTyp CrvType, const u8 *Hash,
 			(XSecure_EllipticSignAddr *) &SignAddr);
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function verifies a batch of signatures made with the same
+ *		public key and curve type where data is located at 64-bit address
+ *
+ * @param	CrvType - Type of elliptic curve
+ * @param	KeyAddr - Pointer to public key address
+ * @param	Req     - Pointer to an array of verification requests. Status
+ *			of each request is updated with its verification result
+ * @param	NumReq  - Number of requests in the array
+ *
+ * @return
+ *	-	XST_SUCCESS - When all signatures are verified successfully
+ *	-	XSECURE_ELLIPTIC_INVALID_PARAM - On invalid argument
+ *	-	Status of the first request which failed verification. Refer
+ *		XSecure_EllipticVerifySign_64Bit for the list of error codes
+ *	-	XST_FAILURE - On failure
+ *
+ * @note	The crypto check, curve lookup and public key copy are done once
+ *		and the ECDSA core is kept out of reset for the whole batch, so
+ *		the requests are issued to the core back to back.
+ *
+ *****************************************************************************/
+int XSecure_EllipticVerifySignBatch_64Bit(XSecure_EllipticCrvTyp CrvType,
+	XSecure_EllipticKeyAddr *KeyAddr, XSecure_EllipticVerifyReq *Req,
+	u32 NumReq)
+{
+	volatile int Status = (int)XSECURE_ELLIPTIC_NON_SUPPORTED_CRV;
+	volatile int ErrStatus = XST_SUCCESS;
+	volatile u32 Index = 0U;
+	u32 VerifiedCnt = 0U;
+	EcdsaCrvInfo *Crv = NULL;
+	u8 PubKey[XSECURE_ECC_P521_SIZE_IN_BYTES +
+	XSECURE_ECDSA_P521_ALIGN_BYTES +
+	XSECURE_ECC_P521_SIZE_IN_BYTES] = {0U};
+	EcdsaKey Key;
+	u32 OffSet = 0U;
+	u32 Size = 0U;
+
+	Status = XSecure_CryptoCheck();
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	Status = XST_FAILURE;
+	if ((CrvType != XSECURE_ECC_NIST_P384) && (CrvType != XSECURE_ECC_NIST_P521)) {
+		Status = (int)XSECURE_ELLIPTIC_INVALID_PARAM;
+		goto END;
+	}
+
+	if ((KeyAddr == NULL) || (Req == NULL) || (NumReq == 0U)) {
+		Status = (int)XSECURE_ELLIPTIC_INVALID_PARAM;
+		goto END;
+	}
+
+	for (Index = 0U; Index < NumReq; Index++) {
+		Req[Index].Status = XST_FAILURE;
+	}
+
+	/* Store Pub key(Qx,Qy) to local buffer once for all the requests */
+	if (CrvType == XSECURE_ECC_NIST_P521) {
+		Size = XSECURE_ECC_P521_SIZE_IN_BYTES;
+		OffSet = Size + XSECURE_ECDSA_P521_ALIGN_BYTES;
+	} else {
+		Size = XSECURE_ECC_P384_SIZE_IN_BYTES;
+		OffSet = Size;
+	}
+	XSecure_PutData(Size, (u8 *)PubKey, KeyAddr->Qx);
+	XSecure_PutData(Size, (u8 *)(PubKey + OffSet), KeyAddr->Qy);
+
+	Key.Qx = (u8 *)(UINTPTR)PubKey;
+	Key.Qy = (u8 *)(UINTPTR)(PubKey + OffSet);
+
+	XSecure_ReleaseReset(XSECURE_ECDSA_RSA_BASEADDR,
+		XSECURE_ECDSA_RSA_RESET_OFFSET);
+
+	Crv = XSecure_EllipticGetCrvData(CrvType);
+	if (Crv == NULL) {
+		goto END;
+	}
+
+	for (Index = 0U; Index < NumReq; Index++) {
+		Req[Index].Status = XSecure_EllipticVerifyOne(Crv, &Key, Size,
+			OffSet, &Req[Index].HashInfo, &Req[Index].SignAddr);
+		if (Req[Index].Status == XST_SUCCESS) {
+			VerifiedCnt++;
+		}
+		else if (ErrStatus == XST_SUCCESS) {
+			ErrStatus = Req[Index].Status;
+		}
+		else {
+			/* Keep the status of the first failed request */
+		}
+	}
+
+	if (ErrStatus != XST_SUCCESS) {
+		Status = ErrStatus;
+	}
+	else if ((Index == NumReq) && (VerifiedCnt == NumReq)) {
+		Status = XST_SUCCESS;
+	}
+	else {
+		Status = XST_FAILURE;
+	}
+
+END:
+	XSecure_SetReset(XSECURE_ECDSA_RSA_BASEADDR,
+		XSECURE_ECDSA_RSA_RESET_OFFSET);
+	return Status;
+}
+
 /*****************************************************************************/
 /**
  * @brief	This function performs known answer test(KAT) on ECC core
@@ -824,6 +882,93 @@ END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function copies the hash and signature to local buffers and
+ *		verifies the signature with the ECDSA core which is already out
+ *		of reset
+ *
+ * @param	Crv      - Pointer to the curve information
+ * @param	Key      - Pointer to the public key in local buffer
+ * @param	Size     - Size of the curve in bytes
+ * @param	OffSet   - Offset of the S component in the signature buffer
+ * @param	HashInfo - Pointer to Hash Data i.e. Hash Address and length
+ * @param	SignAddr - Pointer to signature address
+ *
+ * @return
+ *	-	XST_SUCCESS - On success
+ *	-	Error code - On failure. Refer XSecure_EllipticVerifySign_64Bit
+ *
+ *****************************************************************************/
+static int XSecure_EllipticVerifyOne(EcdsaCrvInfo *Crv, EcdsaKey *Key,
+	const u32 Size, const u32 OffSet, const XSecure_EllipticHashData *HashInfo,
+	const XSecure_EllipticSignAddr *SignAddr)
+{
+	volatile int Status = XST_FAILURE;
+	volatile int VerifyStatus = XST_FAILURE;
+	volatile int VerifyStatusTmp = XST_FAILURE;
+	u8 PaddedHash[XSECURE_ECC_P521_SIZE_IN_BYTES] = {0U};
+	volatile u32 HashLenTmp = 0xFFFFFFFFU;
+	u8 Signature[XSECURE_ECC_P521_SIZE_IN_BYTES +
+	XSECURE_ECDSA_P521_ALIGN_BYTES +
+	XSECURE_ECC_P521_SIZE_IN_BYTES] = {0U};
+	EcdsaSign Sign;
+
+	HashLenTmp = HashInfo->Len;
+	if ((HashInfo->Len > XSECURE_ECC_P521_SIZE_IN_BYTES) ||
+		(HashLenTmp > XSECURE_ECC_P521_SIZE_IN_BYTES)) {
+		Status = (int)XSECURE_ELLIPTIC_INVALID_PARAM;
+		goto END;
+	}
+
+	/* Store Sign(SignR, SignS) and Hash to local buffers */
+	XSecure_PutData(Size, (u8 *)Signature, SignAddr->SignR);
+	XSecure_PutData(Size, (u8 *)(Signature + OffSet),
+			SignAddr->SignS);
+	XSecure_PutData(HashInfo->Len, (u8 *)PaddedHash, HashInfo->Addr);
+
+	Sign.r = (u8 *)(UINTPTR)Signature;
+	Sign.s = (u8 *)(UINTPTR)(Signature + OffSet);
+
+	XSECURE_TEMPORAL_IMPL(VerifyStatus, VerifyStatusTmp, Ecdsa_VerifySign,
+		Crv, PaddedHash, Crv->Bits, Key, (EcdsaSign *)&Sign);
+
+	if ((ELLIPTIC_BAD_SIGN == VerifyStatus) ||
+		(ELLIPTIC_BAD_SIGN == VerifyStatusTmp)) {
+		Status = (int)XSECURE_ELLIPTIC_BAD_SIGN;
+	}
+	else if ((ELLIPTIC_VER_SIGN_INCORRECT_HASH_LEN == VerifyStatus) ||
+		(ELLIPTIC_VER_SIGN_INCORRECT_HASH_LEN == VerifyStatusTmp)) {
+		Status = (int)XSECURE_ELLIPTIC_VER_SIGN_INCORRECT_HASH_LEN;
+	}
+	else if ((ELLIPTIC_VER_SIGN_R_ZERO == VerifyStatus) ||
+		(ELLIPTIC_VER_SIGN_R_ZERO == VerifyStatusTmp)) {
+		Status = (int)XSECURE_ELLIPTIC_VER_SIGN_R_ZERO;
+	}
+	else if ((ELLIPTIC_VER_SIGN_S_ZERO == VerifyStatus) ||
+		(ELLIPTIC_VER_SIGN_S_ZERO == VerifyStatusTmp)) {
+		Status = (int)XSECURE_ELLIPTIC_VER_SIGN_S_ZERO;
+	}
+	else if ((ELLIPTIC_VER_SIGN_R_ORDER_ERROR == VerifyStatus) ||
+		(ELLIPTIC_VER_SIGN_R_ORDER_ERROR == VerifyStatusTmp)) {
+		Status = (int)XSECURE_ELLIPTIC_VER_SIGN_R_ORDER_ERROR;
+	}
+	else if ((ELLIPTIC_VER_SIGN_S_ORDER_ERROR == VerifyStatus) ||
+		(ELLIPTIC_VER_SIGN_S_ORDER_ERROR == VerifyStatusTmp)) {
+		Status = (int)XSECURE_ELLIPTIC_VER_SIGN_S_ORDER_ERROR;
+	}
+	else if ((ELLIPTIC_SUCCESS != VerifyStatus) ||
+		(ELLIPTIC_SUCCESS != VerifyStatusTmp)) {
+		Status = XST_FAILURE;
+	}
+	else {
+		Status = XST_SUCCESS;
+	}
+
+END:
+	return Status;
+}
+
 /*****************************************************************************/
 /**
  * @brief	This function gets the curve related information
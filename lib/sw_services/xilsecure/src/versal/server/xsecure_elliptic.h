@@ -29,6 +29,7 @@
 * 4.5   har  01/18/21 Updated prototype for XSecure_EllipticKat
 * 4.6   har  07/14/21 Fixed doxygen warnings
 *       gm   07/16/21 Added support for 64-bit address
+* 4.8   agt  10/17/26 Added XSecure_EllipticVerifySignBatch_64Bit
 *
 * </pre>
 *
@@ -80,6 +81,12 @@ typedef struct {
 	u32 Len;		/**< Length of the hash */
 } XSecure_EllipticHashData;
 
+typedef struct {
+	XSecure_EllipticHashData HashInfo;	/**< Hash address and length */
+	XSecure_EllipticSignAddr SignAddr;	/**< Address of the signature */
+	int Status;		/**< Verification status of this request */
+} XSecure_EllipticVerifyReq;
+
 /***************************** Function Prototypes ***************************/
 int XSecure_EllipticGenerateKey(XSecure_EllipticCrvTyp CrvType, const u8* D,
 	XSecure_EllipticKey *Key);
@@ -102,6 +109,9 @@ int XSecure_EllipticValidateKey_64Bit(XSecure_EllipticCrvTyp CrvType,
 int XSecure_EllipticVerifySign_64Bit(XSecure_EllipticCrvTyp CrvType,
 	XSecure_EllipticHashData *HashInfo, XSecure_EllipticKeyAddr *KeyAddr,
 	XSecure_EllipticSignAddr *SignAddr);
+int XSecure_EllipticVerifySignBatch_64Bit(XSecure_EllipticCrvTyp CrvType,
+	XSecure_EllipticKeyAddr *KeyAddr, XSecure_EllipticVerifyReq *Req,
+	u32 NumReq);
 
 #ifdef __cplusplus
 }
@@ -19,6 +19,7 @@
 * 4.6  gm    07/16/2021 Added support for 64-bit address
 *      rb    08/11/2021 Fix compilation warnings
 * 4.7  kpt   03/18/2022 Replaced XPlmi_Dmaxfr with XPlmi_MemCpy64
+* 4.8  agt   10/17/2026 Added handler for batched signature verification
 *
 * </pre>
 *
@@ -32,9 +33,12 @@
 #include "xsecure_defs.h"
 #include "xsecure_elliptic.h"
 #include "xsecure_elliptic_ipihandler.h"
+#include "xsecure_error.h"
 #include "xstatus.h"
 
 /************************** Constant Definitions *****************************/
+#define XSECURE_ELLIPTIC_MAX_BATCH_REQ	(8U)
+			/**< Maximum number of signatures in one batch request */
 
 /************************** Function Prototypes *****************************/
 static int XSecure_EllipticGenKey(u32 CurveType, u32 SrcAddrLow,
@@ -45,6 +49,8 @@ static int XSecure_EllipticValidatePubKey(u32 CurveType,
 	u32 SrcAddrLow, u32 SrcAddrHigh);
 static int XSecure_EllipticVerifySignature(u32 SrcAddrLow, u32 SrcAddrHigh);
 static int XSecure_EllipticExecuteKat(u32 CurveType);
+static int XSecure_EllipticVerifySignatureBatch(u32 SrcAddrLow,
+	u32 SrcAddrHigh);
 
 /*************************** Function Definitions *****************************/
 
@@ -83,6 +89,9 @@ int XSecure_EllipticIpiHandler(XPlmi_Cmd *Cmd)
 	case XSECURE_API(XSECURE_API_ELLIPTIC_KAT):
 		Status = XSecure_EllipticExecuteKat(Pload[0]);
 		break;
+	case XSECURE_API(XSECURE_API_ELLIPTIC_VERIFY_SIGN_BATCH):
+		Status = XSecure_EllipticVerifySignatureBatch(Pload[0], Pload[1]);
+		break;
 	default:
 		XSecure_Printf(XSECURE_DEBUG_GENERAL, "CMD: INVALID PARAM\r\n");
 		Status = XST_INVALID_PARAM;
@@ -292,3 +301,79 @@ static int XSecure_EllipticExecuteKat(u32 CurveType)
 
 	return Status;
 }
+
+/*****************************************************************************/
+/**
+ * @brief       This function handler calls
+ * 		XSecure_EllipticVerifySignBatch_64Bit server API
+ *
+ * @param	SrcAddrLow	- Lower 32 bit address of the
+ * 				XSecure_EllipticVerifyBatchParams structure
+ * 		SrcAddrHigh	- Higher 32 bit address of the
+ * 				XSecure_EllipticVerifyBatchParams structure
+ *
+ * @return
+ *	-	XST_SUCCESS - If all the signatures are verified successfully
+ *	-	XSECURE_ELLIPTIC_INVALID_PARAM - If number of requests is invalid
+ *	-	ErrorCode - If there is a failure
+ *
+ * @note	Status of each request is written back to the request array of
+ *		the client
+ *
+ ******************************************************************************/
+static int XSecure_EllipticVerifySignatureBatch(u32 SrcAddrLow,
+	u32 SrcAddrHigh)
+{
+	volatile int Status = XST_FAILURE;
+	int CopyStatus = XST_FAILURE;
+	u64 Addr = ((u64)SrcAddrHigh << 32U) | (u64)SrcAddrLow;
+	XSecure_EllipticVerifyBatchParams EcdsaParams;
+	XSecure_EllipticVerifyBatchReq BatchReq[XSECURE_ELLIPTIC_MAX_BATCH_REQ];
+	XSecure_EllipticVerifyReq Req[XSECURE_ELLIPTIC_MAX_BATCH_REQ];
+	u32 Index;
+
+	Status = XPlmi_MemCpy64((UINTPTR)&EcdsaParams, Addr, sizeof(EcdsaParams));
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	if ((EcdsaParams.NumReq == 0U) ||
+		(EcdsaParams.NumReq > XSECURE_ELLIPTIC_MAX_BATCH_REQ)) {
+		Status = (int)XSECURE_ELLIPTIC_INVALID_PARAM;
+		goto END;
+	}
+
+	Status = XPlmi_MemCpy64((UINTPTR)BatchReq, EcdsaParams.ReqAddr,
+		EcdsaParams.NumReq * sizeof(XSecure_EllipticVerifyBatchReq));
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	for (Index = 0U; Index < EcdsaParams.NumReq; Index++) {
+		Req[Index].HashInfo.Addr = BatchReq[Index].HashAddr;
+		Req[Index].HashInfo.Len = EcdsaParams.Size;
+		Req[Index].SignAddr.SignR = BatchReq[Index].SignAddr;
+		Req[Index].SignAddr.SignS = BatchReq[Index].SignAddr +
+			(u64)EcdsaParams.Size;
+	}
+
+	XSecure_EllipticKeyAddr KeyAddr = {EcdsaParams.PubKeyAddr,
+			(EcdsaParams.PubKeyAddr + (u64)EcdsaParams.Size)};
+	Status = XSecure_EllipticVerifySignBatch_64Bit(
+			(XSecure_EllipticCrvTyp)EcdsaParams.CurveType,
+			(XSecure_EllipticKeyAddr *) &KeyAddr, Req,
+			EcdsaParams.NumReq);
+
+	for (Index = 0U; Index < EcdsaParams.NumReq; Index++) {
+		BatchReq[Index].Status = (u32)Req[Index].Status;
+	}
+
+	CopyStatus = XPlmi_MemCpy64(EcdsaParams.ReqAddr, (UINTPTR)BatchReq,
+		EcdsaParams.NumReq * sizeof(XSecure_EllipticVerifyBatchReq));
+	if (CopyStatus != XST_SUCCESS) {
+		Status = CopyStatus;
+	}
+
+END:
+	return Status;
+}
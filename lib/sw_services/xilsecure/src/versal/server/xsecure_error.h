@@ -28,6 +28,7 @@
  *       kpt  02/04/2021 Added error code for tamper response
  *       har  05/18/2021 Added error code XSECURE_IPI_ACCESS_NOT_ALLOWED
  *                       Added error code XSECURE_AES_DEVICE_KEY_NOT_ALLOWED
+ * 4.8   agt  10/17/2026 Added error code XSECURE_SHA3_CTX_UNAVAILABLE
  *
  * </pre>
  *
@@ -155,7 +156,8 @@ typedef enum {
 						Kat can't be executed */
 	XSECURE_AES_KAT_BUSY,			/**< 0xF3 - AES busy with earlier operation,
 						Kat can't be executed */
-	XSECURE_ERR_CRYPTO_ACCELERATOR_DISABLED /**< 0xF4 - Crypto Accelerators are disabled */
+	XSECURE_ERR_CRYPTO_ACCELERATOR_DISABLED, /**< 0xF4 - Crypto Accelerators are disabled */
+	XSECURE_SHA3_CTX_UNAVAILABLE		/**< 0xF5 - All SHA3 contexts are in use */
 } XSecure_ErrorCodes;
 /**
  * @}
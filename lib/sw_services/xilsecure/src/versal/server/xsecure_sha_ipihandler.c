@@ -24,6 +24,9 @@
 *       am    05/22/2021 Resolved MISRA C violation rule 17.8
 * 4.6   har   07/14/2021 Fixed doxygen warnings
 *       gm    07/16/2021 Added support for 64-bit address
+* 4.8   agt   10/17/2026 Added per requester SHA3 contexts. A requester
+*                        which does not get the SHA3 engine continues on a
+*                        SHA3 state saved in its context
 *
 * </pre>
 *
@@ -36,23 +39,108 @@
 #include "xplmi_dma.h"
 #include "xsecure_defs.h"
 #include "xsecure_sha.h"
+#include "xsecure_sha_hw.h"
 #include "xsecure_sha_ipihandler.h"
 #include "xsecure_init.h"
 #include "xsecure_error.h"
 #include "xplmi_hw.h"
+#include "xplmi_proc.h"
+#include "xsecure_utils.h"
+#include "xil_util.h"
 
 /************************** Constant Definitions *****************************/
 #define XSECURE_IPI_CONTINUE_MASK		(0x80000000U)
 					/**< IPI Continue Mask */
 #define XSECURE_IPI_FIRST_PACKET_MASK		(0x40000000U)
 					/**< IPI First packet Mask */
+#ifndef XSECURE_SHA3_MAX_CTX
+#define XSECURE_SHA3_MAX_CTX			(4U)
+					/**< Maximum number of requesters
+					  *  which can have a SHA3 context */
+#endif
+#define XSECURE_SHA3_INVALID_CTX		(0xFFU)
+					/**< Invalid context index */
+#ifndef XSECURE_SHA3_CTX_TIMEOUT_MS
+#define XSECURE_SHA3_CTX_TIMEOUT_MS		(1000U)
+					/**< Idle time in milliseconds after
+					  *  which the context of a requester
+					  *  can be taken by a new requester */
+#endif
+#define XSECURE_SHA3_NUM_LANES			(25U)
+					/**< Number of 64 bit lanes in the
+					  *  Keccak state */
+#define XSECURE_SHA3_NUM_ROUNDS			(24U)
+					/**< Number of Keccak-f[1600] rounds */
+#define XSECURE_SHA3_NIST_PAD_START		(0x06U)
+					/**< First byte of the NIST padding */
+#define XSECURE_SHA3_NIST_PAD_END		(0x80U)
+					/**< Last byte of the NIST padding */
+
+/**************************** Type Definitions *******************************/
+/* Sha3 context states */
+typedef enum {
+	XSECURE_SHA3_CTX_FREE = 0,	/**< Context is not in use */
+	XSECURE_SHA3_CTX_ENGINE,	/**< Context owns the SHA3 engine */
+	XSECURE_SHA3_CTX_SAVED		/**< Context hashes on its saved state */
+} XSecure_Sha3CtxState;
+
+/**
+ * SHA3 context of a requester. The SHA3 engine state can not be read back,
+ * so a message which starts while the engine hashes the message of another
+ * requester is absorbed into the Keccak state saved in its context. The
+ * requests of all requesters are therefore served as they arrive.
+ */
+typedef struct {
+	u32 IpiMask;			/**< IPI mask of the requester */
+	XSecure_Sha3CtxState State;	/**< Context state */
+	u32 Offset;			/**< Byte offset in the current block
+					  *  of the saved state */
+	u64 LastTime;			/**< Timer value of the last request */
+	u64 Lane[XSECURE_SHA3_NUM_LANES]; /**< Saved Keccak state */
+} XSecure_Sha3Ctx;
 
 /************************** Function Prototypes *****************************/
 
 static int XSecure_ShaInitialize(void);
-static int XSecure_ShaUpdate(u32 SrcAddrLow, u32 SrcAddrHigh, u32 Size,
-	u32 DstAddrLow, u32 DstAddrHigh);
+static int XSecure_ShaUpdate(u32 IpiMask, u32 SrcAddrLow, u32 SrcAddrHigh,
+	u32 Size, u32 DstAddrLow, u32 DstAddrHigh);
 static int XSecure_ShaKat(void);
+static XSecure_Sha3Ctx *XSecure_ShaGetCtx(void);
+static u32 XSecure_ShaFindCtx(const XSecure_Sha3Ctx *Ctx, u32 IpiMask);
+static int XSecure_ShaAllocCtx(XSecure_Sha3Ctx *Ctx, u32 IpiMask,
+	u32 *CtxIdx);
+static int XSecure_ShaReleaseCtx(XSecure_Sha3Ctx *Ctx);
+static void XSecure_ShaCtxAbsorb(XSecure_Sha3Ctx *Ctx, const u8 *Data,
+	u32 Size);
+static int XSecure_ShaCtxUpdate(XSecure_Sha3Ctx *Ctx, u64 DataAddr, u32 Size);
+static void XSecure_ShaCtxFinish(XSecure_Sha3Ctx *Ctx,
+	XSecure_Sha3Hash *Sha3Hash);
+static void XSecure_ShaKeccakF(u64 *Lane);
+
+/************************** Variable Definitions *****************************/
+/* Keccak-f[1600] round constants */
+static const u64 XSecure_ShaRoundConst[XSECURE_SHA3_NUM_ROUNDS] = {
+	0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808AULL,
+	0x8000000080008000ULL, 0x000000000000808BULL, 0x0000000080000001ULL,
+	0x8000000080008081ULL, 0x8000000000008009ULL, 0x000000000000008AULL,
+	0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000AULL,
+	0x000000008000808BULL, 0x800000000000008BULL, 0x8000000000008089ULL,
+	0x8000000000008003ULL, 0x8000000000008002ULL, 0x8000000000000080ULL,
+	0x000000000000800AULL, 0x800000008000000AULL, 0x8000000080008081ULL,
+	0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL
+};
+
+/* Rotation of the lanes in the order they are visited by the pi step */
+static const u8 XSecure_ShaRotation[XSECURE_SHA3_NUM_LANES - 1U] = {
+	1U, 3U, 6U, 10U, 15U, 21U, 28U, 36U, 45U, 55U, 2U, 14U,
+	27U, 41U, 56U, 8U, 25U, 43U, 62U, 18U, 39U, 61U, 20U, 44U
+};
+
+/* Lanes in the order they are visited by the pi step */
+static const u8 XSecure_ShaPiLane[XSECURE_SHA3_NUM_LANES - 1U] = {
+	10U, 7U, 11U, 17U, 18U, 3U, 5U, 16U, 8U, 21U, 24U, 4U,
+	15U, 23U, 19U, 13U, 12U, 2U, 20U, 14U, 22U, 9U, 6U, 1U
+};
 
 /*************************** Function Definitions *****************************/
 
@@ -74,7 +162,7 @@ int XSecure_Sha3IpiHandler(XPlmi_Cmd *Cmd)
 
 	if ((Cmd->CmdId & XSECURE_API_ID_MASK) ==
 		XSECURE_API(XSECURE_API_SHA3_UPDATE)) {
-		Status = XSecure_ShaUpdate(Pload[0], Pload[1],
+		Status = XSecure_ShaUpdate(Cmd->IpiMask, Pload[0], Pload[1],
 				Pload[2], Pload[3], Pload[4]);
 	}
 	else if ((Cmd->CmdId & XSECURE_API_ID_MASK) ==
@@ -119,10 +207,13 @@ END:
 
 /*****************************************************************************/
 /**
- * @brief       This function handler calls XSecure_Sha3Update64Bit or
- * 		XSecure_Sha3Finish based on the Continue bit in the command
+ * @brief       This function handler updates or finishes the SHA3 context of
+ * 		the requester based on the Continue bit in the command. The
+ * 		first packet of a requester allocates its context, which gets
+ * 		the SHA3 engine if no other context owns it.
  *
- * @param	SrcAddrLow	- Lower 32 bit address of the input data
+ * @param	IpiMask		- IPI mask of the requester
+ * 		SrcAddrLow	- Lower 32 bit address of the input data
  * 				on which hash has to be calculated
  * 		SrcAddrHigh	- Higher 32 bit address of the input data
  * 				on which hash has to be calculated
@@ -138,44 +229,381 @@ END:
  *	-	ErrorCode - If there is a failure
  *
  ******************************************************************************/
-static int XSecure_ShaUpdate(u32 SrcAddrLow, u32 SrcAddrHigh, u32 Size,
-				u32 DstAddrLow, u32 DstAddrHigh)
+static int XSecure_ShaUpdate(u32 IpiMask, u32 SrcAddrLow, u32 SrcAddrHigh,
+	u32 Size, u32 DstAddrLow, u32 DstAddrHigh)
 {
 	int Status = XST_FAILURE;
+	int SStatus = XST_FAILURE;
 	u32 InputSize = Size;
 	XSecure_Sha3 *XSecureSha3InstPtr = XSecure_GetSha3Instance();
+	XSecure_Sha3Ctx *Ctx = XSecure_ShaGetCtx();
 	u64 DataAddr = ((u64)SrcAddrHigh << 32) | (u64)SrcAddrLow;
 	u64 DstAddr = ((u64)DstAddrHigh << 32) | (u64)DstAddrLow;
 	XSecure_Sha3Hash Hash = {0U};
 	u32 Index = 0U;
+	u32 CtxIdx;
 
 	if ((InputSize & XSECURE_IPI_FIRST_PACKET_MASK) != 0x0U) {
-		Status = XSecure_ShaInitialize();
+		Status = XSecure_ShaAllocCtx(Ctx, IpiMask, &CtxIdx);
 		if (Status != XST_SUCCESS) {
 			goto END;
 		}
 	}
+	else {
+		CtxIdx = XSecure_ShaFindCtx(Ctx, IpiMask);
+		if (CtxIdx == XSECURE_SHA3_INVALID_CTX) {
+			Status = (int)XSECURE_SHA3_STATE_MISMATCH_ERROR;
+			goto END;
+		}
+	}
+	Ctx = &Ctx[CtxIdx];
+	Ctx->LastTime = XPlmi_GetTimerValue();
 
 	if ((InputSize & XSECURE_IPI_CONTINUE_MASK) != 0x0U) {
 		InputSize = InputSize & (~XSECURE_IPI_CONTINUE_MASK) &
 			(~XSECURE_IPI_FIRST_PACKET_MASK);
-		Status = XSecure_Sha3Update64Bit(XSecureSha3InstPtr, DataAddr, InputSize);
+		if (Ctx->State == XSECURE_SHA3_CTX_ENGINE) {
+			Status = XSecure_Sha3Update64Bit(XSecureSha3InstPtr,
+				DataAddr, InputSize);
+		}
+		else {
+			Status = XSecure_ShaCtxUpdate(Ctx, DataAddr, InputSize);
+		}
+		if (Status != XST_SUCCESS) {
+			(void)XSecure_ShaReleaseCtx(Ctx);
+		}
 	}
 	else {
-		Status = XSecure_Sha3Finish(XSecureSha3InstPtr,
+		if (Ctx->State == XSECURE_SHA3_CTX_ENGINE) {
+			Status = XSecure_Sha3Finish(XSecureSha3InstPtr,
 				(XSecure_Sha3Hash *)&Hash);
+		}
+		else {
+			XSecure_ShaCtxFinish(Ctx, (XSecure_Sha3Hash *)&Hash);
+			Status = XST_SUCCESS;
+		}
 		if (XST_SUCCESS == Status) {
 			for (Index = 0U; Index < XSECURE_HASH_SIZE_IN_BYTES; Index++) {
 				XPlmi_OutByte64((DstAddr + Index),
 						Hash.Hash[Index]);
 			}
 		}
+		SStatus = XSecure_ShaReleaseCtx(Ctx);
+		if (Status == XST_SUCCESS) {
+			Status = SStatus;
+		}
 	}
 
 END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief       This function provides the pointer to the SHA3 contexts
+ *
+ * @return	Pointer to the array of XSECURE_SHA3_MAX_CTX contexts
+ *
+ ******************************************************************************/
+static XSecure_Sha3Ctx *XSecure_ShaGetCtx(void)
+{
+	static XSecure_Sha3Ctx Sha3Ctx[XSECURE_SHA3_MAX_CTX] = {0U};
+
+	return &Sha3Ctx[0U];
+}
+
+/*****************************************************************************/
+/**
+ * @brief       This function finds the context of the requester
+ *
+ * @param	Ctx	- Pointer to the SHA3 contexts
+ * 		IpiMask	- IPI mask of the requester
+ *
+ * @return
+ *	-	Index of the context
+ *	-	XSECURE_SHA3_INVALID_CTX - If requester has no context
+ *
+ ******************************************************************************/
+static u32 XSecure_ShaFindCtx(const XSecure_Sha3Ctx *Ctx, u32 IpiMask)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < XSECURE_SHA3_MAX_CTX; Index++) {
+		if ((Ctx[Index].State != XSECURE_SHA3_CTX_FREE) &&
+			(Ctx[Index].IpiMask == IpiMask)) {
+			break;
+		}
+	}
+
+	return (Index < XSECURE_SHA3_MAX_CTX) ? Index :
+		XSECURE_SHA3_INVALID_CTX;
+}
+
+/*****************************************************************************/
+/**
+ * @brief       This function allocates a context for the requester. An
+ * 		unfinished context of the requester is discarded. When all
+ * 		contexts are in use, the context which is idle for more than
+ * 		XSECURE_SHA3_CTX_TIMEOUT_MS is taken over, its requester gets
+ * 		XSECURE_SHA3_STATE_MISMATCH_ERROR on its next request. The
+ * 		new context gets the SHA3 engine if it is free, and a zero
+ * 		Keccak state otherwise.
+ *
+ * @param	Ctx	- Pointer to the SHA3 contexts
+ * 		IpiMask	- IPI mask of the requester
+ * 		CtxIdx	- Pointer to store the index of the allocated context
+ *
+ * @return
+ *	-	XST_SUCCESS - If the context is allocated
+ *	-	XSECURE_SHA3_CTX_UNAVAILABLE - If all contexts are in use
+ *	-	ErrorCode - If there is a failure in starting the engine
+ *
+ ******************************************************************************/
+static int XSecure_ShaAllocCtx(XSecure_Sha3Ctx *Ctx, u32 IpiMask,
+	u32 *CtxIdx)
+{
+	int Status = XST_FAILURE;
+	XPlmi_PerfTime IdleTime = {0U};
+	u32 IsEngineOwned = FALSE;
+	u32 Index = XSecure_ShaFindCtx(Ctx, IpiMask);
+
+	if (Index != XSECURE_SHA3_INVALID_CTX) {
+		Status = XSecure_ShaReleaseCtx(&Ctx[Index]);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+	}
+
+	for (Index = 0U; Index < XSECURE_SHA3_MAX_CTX; Index++) {
+		if (Ctx[Index].State == XSECURE_SHA3_CTX_FREE) {
+			break;
+		}
+	}
+	if (Index == XSECURE_SHA3_MAX_CTX) {
+		for (Index = 0U; Index < XSECURE_SHA3_MAX_CTX; Index++) {
+			XPlmi_MeasurePerfTime(Ctx[Index].LastTime, &IdleTime);
+			if (IdleTime.TPerfMs >=
+				(u64)XSECURE_SHA3_CTX_TIMEOUT_MS) {
+				break;
+			}
+		}
+		if (Index == XSECURE_SHA3_MAX_CTX) {
+			Status = (int)XSECURE_SHA3_CTX_UNAVAILABLE;
+			goto END;
+		}
+		Status = XSecure_ShaReleaseCtx(&Ctx[Index]);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+	}
+	*CtxIdx = Index;
+
+	for (Index = 0U; Index < XSECURE_SHA3_MAX_CTX; Index++) {
+		if (Ctx[Index].State == XSECURE_SHA3_CTX_ENGINE) {
+			IsEngineOwned = TRUE;
+		}
+	}
+
+	Ctx[*CtxIdx].IpiMask = IpiMask;
+	Ctx[*CtxIdx].Offset = 0U;
+	if (IsEngineOwned == FALSE) {
+		Status = XSecure_ShaInitialize();
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+		Ctx[*CtxIdx].State = XSECURE_SHA3_CTX_ENGINE;
+	}
+	else {
+		Ctx[*CtxIdx].State = XSECURE_SHA3_CTX_SAVED;
+	}
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief       This function releases the context. If the context owns the
+ * 		engine, the engine is put under reset. The saved state is
+ * 		cleared.
+ *
+ * @param	Ctx	- Pointer to the context to be released
+ *
+ * @return
+ *	-	XST_SUCCESS - If the context is released
+ *	-	ErrorCode - If there is a failure in clearing the saved state
+ *
+ ******************************************************************************/
+static int XSecure_ShaReleaseCtx(XSecure_Sha3Ctx *Ctx)
+{
+	int Status = XST_FAILURE;
+	XSecure_Sha3 *XSecureSha3InstPtr = XSecure_GetSha3Instance();
+
+	if ((Ctx->State == XSECURE_SHA3_CTX_ENGINE) &&
+		(XSecureSha3InstPtr->Sha3State == XSECURE_SHA3_ENGINE_STARTED)) {
+		XSecure_SetReset(XSecureSha3InstPtr->BaseAddress,
+			XSECURE_SHA3_RESET_OFFSET);
+		XSecureSha3InstPtr->Sha3State = XSECURE_SHA3_INITIALIZED;
+	}
+
+	Status = Xil_SMemSet(Ctx->Lane, sizeof(Ctx->Lane), 0U,
+		sizeof(Ctx->Lane));
+	Ctx->Offset = 0U;
+	Ctx->IpiMask = 0U;
+	Ctx->State = XSECURE_SHA3_CTX_FREE;
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief       This function reads the input data block by block and
+ * 		absorbs it into the saved state of the context
+ *
+ * @param	Ctx		- Pointer to the SHA3 context
+ * 		DataAddr	- 64 bit address of the input data
+ * 		Size		- Size of the input data in bytes
+ *
+ * @return
+ *	-	XST_SUCCESS - If the update is successful
+ *	-	ErrorCode - If there is a failure in clearing the local copy
+ *
+ ******************************************************************************/
+static int XSecure_ShaCtxUpdate(XSecure_Sha3Ctx *Ctx, u64 DataAddr, u32 Size)
+{
+	int Status = XST_FAILURE;
+	u8 Block[XSECURE_SHA3_BLOCK_LEN];
+	u32 Offset = 0U;
+	u32 Len;
+
+	while (Offset < Size) {
+		Len = Size - Offset;
+		if (Len > XSECURE_SHA3_BLOCK_LEN) {
+			Len = XSECURE_SHA3_BLOCK_LEN;
+		}
+		XSecure_MemCpy64((u64)(UINTPTR)Block, DataAddr + Offset, Len);
+		XSecure_ShaCtxAbsorb(Ctx, Block, Len);
+		Offset += Len;
+	}
+
+	Status = Xil_SMemSet(Block, sizeof(Block), 0U, sizeof(Block));
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief       This function absorbs the data into the saved state of the
+ * 		context, and permutes the state after every full block
+ *
+ * @param	Ctx	- Pointer to the SHA3 context
+ * 		Data	- Pointer to the data
+ * 		Size	- Size of the data in bytes
+ *
+ ******************************************************************************/
+static void XSecure_ShaCtxAbsorb(XSecure_Sha3Ctx *Ctx, const u8 *Data,
+	u32 Size)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < Size; Index++) {
+		Ctx->Lane[Ctx->Offset >> 3U] ^= (u64)Data[Index] <<
+			((Ctx->Offset & 7U) << 3U);
+		Ctx->Offset++;
+		if (Ctx->Offset == XSECURE_SHA3_BLOCK_LEN) {
+			XSecure_ShaKeccakF(Ctx->Lane);
+			Ctx->Offset = 0U;
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief       This function applies the NIST SHA3 padding to the saved
+ * 		state of the context and reads out the SHA3-384 hash
+ *
+ * @param	Ctx		- Pointer to the SHA3 context
+ * 		Sha3Hash	- Pointer to store the hash
+ *
+ ******************************************************************************/
+static void XSecure_ShaCtxFinish(XSecure_Sha3Ctx *Ctx,
+	XSecure_Sha3Hash *Sha3Hash)
+{
+	u32 Index;
+
+	Ctx->Lane[Ctx->Offset >> 3U] ^= (u64)XSECURE_SHA3_NIST_PAD_START <<
+		((Ctx->Offset & 7U) << 3U);
+	Ctx->Lane[(XSECURE_SHA3_BLOCK_LEN - 1U) >> 3U] ^=
+		(u64)XSECURE_SHA3_NIST_PAD_END <<
+		(((XSECURE_SHA3_BLOCK_LEN - 1U) & 7U) << 3U);
+	XSecure_ShaKeccakF(Ctx->Lane);
+
+	for (Index = 0U; Index < XSECURE_HASH_SIZE_IN_BYTES; Index++) {
+		Sha3Hash->Hash[Index] = (u8)(Ctx->Lane[Index >> 3U] >>
+			((Index & 7U) << 3U));
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief       This function applies the Keccak-f[1600] permutation to the
+ * 		state
+ *
+ * @param	Lane	- Pointer to the 25 lanes of the state
+ *
+ ******************************************************************************/
+static void XSecure_ShaKeccakF(u64 *Lane)
+{
+	u64 Column[5U];
+	u64 Cur;
+	u64 Tmp;
+	u32 Round;
+	u32 X;
+	u32 Y;
+
+	for (Round = 0U; Round < XSECURE_SHA3_NUM_ROUNDS; Round++) {
+		/* Theta */
+		for (X = 0U; X < 5U; X++) {
+			Column[X] = Lane[X] ^ Lane[X + 5U] ^ Lane[X + 10U] ^
+				Lane[X + 15U] ^ Lane[X + 20U];
+		}
+		for (X = 0U; X < 5U; X++) {
+			Tmp = Column[(X + 4U) % 5U] ^
+				((Column[(X + 1U) % 5U] << 1U) |
+				(Column[(X + 1U) % 5U] >> 63U));
+			for (Y = 0U; Y < XSECURE_SHA3_NUM_LANES; Y += 5U) {
+				Lane[Y + X] ^= Tmp;
+			}
+		}
+
+		/* Rho and pi */
+		Cur = Lane[1U];
+		for (X = 0U; X < (XSECURE_SHA3_NUM_LANES - 1U); X++) {
+			Y = XSecure_ShaPiLane[X];
+			Tmp = Lane[Y];
+			Lane[Y] = (Cur << XSecure_ShaRotation[X]) |
+				(Cur >> (64U - XSecure_ShaRotation[X]));
+			Cur = Tmp;
+		}
+
+		/* Chi */
+		for (Y = 0U; Y < XSECURE_SHA3_NUM_LANES; Y += 5U) {
+			for (X = 0U; X < 5U; X++) {
+				Column[X] = Lane[Y + X];
+			}
+			for (X = 0U; X < 5U; X++) {
+				Lane[Y + X] = Column[X] ^
+					((~Column[(X + 1U) % 5U]) &
+					Column[(X + 2U) % 5U]);
+			}
+		}
+
+		/* Iota */
+		Lane[0U] ^= XSecure_ShaRoundConst[Round];
+	}
+}
+
 /*****************************************************************************/
 /**
  * @brief       This function handler calls XSecure_ShaKat server API
@@ -210,4 +638,4 @@ static int XSecure_ShaKat(void)
 
 END:
 	return Status;
-}
\ No newline at end of file
+}
@@ -51,6 +51,9 @@
 * 7.2   am      07/13/21 Fixed doxygen warnings
 * 7.3   har     11/15/21 Removed local variable ErrorCode in
 *                        XilSKey_EfusePl_GetRowData_Ultra()
+* 7.4   agt     10/17/26 Verify all programmed bits of an Ultrascale row with
+*                        one read per margin in
+*                        XilSKey_EfusePl_ProgramRow_Ultra()
 *
 * </pre>
 *
@@ -412,6 +415,8 @@ static INLINE u8 XilSKey_EfusePl_ProgramControlReg_Ultra(u8 *CtrlData);
 
 static INLINE u8 XilSkey_EfusePl_VerifyBit_Ultra(u8 Row, u8 Bit, u8 Redundant,
 								u8 Page);
+static INLINE u8 XilSkey_EfusePl_VerifyRow_Ultra(u8 Row, const u8 *RowData,
+					u32 MaxBits, u8 Redundant, u8 Page);
 static INLINE u32 XilSkey_EfusePl_UserFuses_TobeProgrammed(u8 *UserFuses_Write,
 					u8 *UserFuses_TobePrgrmd, u8 Size);
 static INLINE u8 XilSKey_EfusePl_ProgramControlReg_Ultra_Plus(u8 *CtrlData);
@@ -2128,6 +2133,7 @@ static INLINE u8 XilSKey_EfusePl_ProgramRow_Ultra(u8 Row, u8 *RowData,
 	u32 MaxBits;
 	u8 AesStartRow;
 	u8 AesEndRow;
+	u8 Programmed = 0U;
 
 	/**
 	 * check if row_data is not NULL
@@ -2167,25 +2173,26 @@ static INLINE u8 XilSKey_EfusePl_ProgramRow_Ultra(u8 Row, u8 *RowData,
 				Bit, Redundant, Page) != XST_SUCCESS) {
 				return XST_FAILURE;
 			}
-			/*
-			 * If programming bit is other than AES key's
-			 * bit verify using all 3 margin reads
-			 */
+			Programmed = 1U;
+		}
+	}
 
-			if (! ((Row >= AesStartRow) &&
-				(Row <= AesEndRow) &&
-				(Page == XSK_EFUSEPL_PAGE_0_ULTRA))) {
+	/*
+	 * If programmed row is other than AES key's row verify all
+	 * programmed bits together using all 3 margin reads
+	 */
+	if ((Programmed != 0U) && (! ((Row >= AesStartRow) &&
+		(Row <= AesEndRow) &&
+		(Page == XSK_EFUSEPL_PAGE_0_ULTRA)))) {
 #ifndef DEBUG_FUSE_WRITE_DISABLE
-				if (XilSkey_EfusePl_VerifyBit_Ultra(Row,
-					Bit, Redundant, Page) != XST_SUCCESS) {
-					return XST_FAILURE;
-				}
+		if (XilSkey_EfusePl_VerifyRow_Ultra(Row, RowData,
+				MaxBits, Redundant, Page) != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
 #else
-				XilsKey_DbgPrint("Skipping XilSkey_EfusePl_VerifyBit_Ultra "
-									"as DEBUG_FUSE_WRITE_DISABLE defined\n\r");
+		XilsKey_DbgPrint("Skipping XilSkey_EfusePl_VerifyRow_Ultra "
+							"as DEBUG_FUSE_WRITE_DISABLE defined\n\r");
 #endif
-			}
-		}
 	}
 
 	return XST_SUCCESS;
@@ -3427,6 +3434,62 @@ static INLINE u8 XilSkey_EfusePl_VerifyBit_Ultra(u8 Row, u8 Bit, u8 Redundant,
 
 }
 
+/****************************************************************************/
+/**
+* Verifies that all requested bits of given normal or redundant row of PL
+* efuse are programmed. The row is read once in normal, margin 1 and
+* margin 2 read modes and every requested bit is checked in each read.
+*
+* @param	Row is the row number of Fuse array.
+* @param	RowData is a pointer to the bits requested to be programmed,
+*		one byte per bit.
+* @param	MaxBits is the number of bits in the row.
+* @param	Redundant is the option to be selected either redundant row
+*		or normal row.
+* @param	Page is the page of Fuse array in which row has to be read
+*
+* @return
+*	- XST_FAILURE - In case of failure
+*	- XST_SUCCESS - In case of Success
+*
+* @note		None.
+*
+*****************************************************************************/
+static INLINE u8 XilSkey_EfusePl_VerifyRow_Ultra(u8 Row, const u8 *RowData,
+					u32 MaxBits, u8 Redundant, u8 Page)
+{
+	u32 ReadRow = 0U;
+	u8 RowDataBits[XSK_EFUSEPL_ARRAY_MAX_COL] = {0};
+	const u8 MarginOption[] = {XSK_EFUSEPL_READ_NORMAL,
+			XSK_EFUSEPL_READ_MARGIN_1, XSK_EFUSEPL_READ_MARGIN_2};
+	u32 Offset = 0U;
+	u32 Index;
+	u32 Bit;
+
+	if ((PlFpgaFlag == XSK_FPGA_SERIES_ULTRA_PLUS) && (Redundant == 1U)) {
+		Offset = XSK_EFUSEPL_ARRAY_MAX_COL_ULTRA_PLUS;
+	}
+
+	for (Index = 0U; Index < (sizeof(MarginOption) / sizeof(MarginOption[0]));
+							Index++) {
+		ReadRow = 0U;
+		if (XilSKey_EfusePl_ReadRow_Ultra(Row, MarginOption[Index],
+			(u8 *)&ReadRow, Redundant, Page) != XST_SUCCESS) {
+			return XST_FAILURE;
+		}
+		XilSKey_Efuse_ConvertBitsToBytes((u8 *)&ReadRow, RowDataBits,
+						XSK_EFUSEPL_ARRAY_MAX_COL);
+		for (Bit = 0U; Bit < MaxBits; Bit++) {
+			if ((RowData[Bit] != 0U) &&
+				(RowDataBits[Offset + Bit] != 0x1U)) {
+				return XST_FAILURE;
+			}
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
 /*****************************************************************************/
 /**
 * This function throws an error if user requests already programmed User FUSE